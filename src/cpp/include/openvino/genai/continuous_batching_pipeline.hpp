@@ -64,6 +64,12 @@ struct PipelineMetrics {
      * distinguish between used and unused portions in dynamic KV cache configurations.
      */
     size_t kv_cache_size_in_bytes = 0;
+
+    /**
+     * Size of KV cache blocks copied in the last generation step in bytes, e.g. for copy-on-write of beams or
+     * sequences forked for parallel sampling.
+     */
+    size_t copied_kv_cache_size_in_bytes = 0;
 };
 
 class OPENVINO_GENAI_EXPORTS ContinuousBatchingPipeline {
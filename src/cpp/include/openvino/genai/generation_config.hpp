@@ -624,6 +624,12 @@ operator|(const StructuredOutputConfig::StructuralTag& lhs,
  * @param structured_output_config if set, the output will be a string constrained by the specified json_schema, regex, or EBNF grammar.
  * 
  * @param apply_chat_template whether or not to apply chat_template for non-chat scenarios
+ *
+ * Continuous batching scheduling parameters:
+ * @param priority the priority of the request, requests with a higher value are scheduled first and are preempted last.
+ *        Used by ContinuousBatching backend when SchedulerConfig::scheduling_policy is SchedulingPolicy::PRIORITY.
+ * @param deadline_ms optional latency target of the request in milliseconds counted from its arrival, 0 means no deadline.
+ *        Used by ContinuousBatching backend when SchedulerConfig::scheduling_policy is SchedulingPolicy::EARLIEST_DEADLINE_FIRST.
  */
 class OPENVINO_GENAI_EXPORTS GenerationConfig {
 public:
@@ -683,6 +689,9 @@ public:
     // set to true if chat template should be applied for non-chat scenarios, set to false otherwise
     bool apply_chat_template = true;
 
+    // Continuous batching scheduling parameters
+    size_t priority = 0;
+    size_t deadline_ms = 0;
 
     /** @brief sets eos_token_id to tokenizer_eos_token_id if eos_token_id is less than 0.
      * Otherwise verifies eos_token_id == tokenizer_eos_token_id.
@@ -758,5 +767,8 @@ static constexpr ov::Property<std::string> backend{"backend"};
 
 static constexpr ov::Property<bool> apply_chat_template{"apply_chat_template"};
 
+static constexpr ov::Property<size_t> priority{"priority"};
+static constexpr ov::Property<size_t> deadline_ms{"deadline_ms"};
+
 }  // namespace genai
 }  // namespace ov
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <filesystem>
+#include <optional>
 #include <vector>
 #include <string>
 
@@ -14,6 +15,7 @@
 
 #include "openvino/genai/visibility.hpp"
 #include "openvino/genai/image_generation/generation_config.hpp"
+#include "openvino/genai/vae_tiling_config.hpp"
 
 namespace ov {
 namespace genai {
@@ -133,6 +135,13 @@ public:
 
     ov::Tensor encode(ov::Tensor image, std::shared_ptr<Generator> generator);
 
+    /**
+     * @brief Makes decode() and encode() process images by overlapping tiles, which bounds memory consumed by the VAE
+     * for high resolution images. VAE models must have dynamic spatial dimensions.
+     * @param tiling_config tiling configuration, std::nullopt processes whole images
+     */
+    void set_tiling_config(const std::optional<VAETilingConfig>& tiling_config);
+
     const Config& get_config() const;
 
     size_t get_vae_scale_factor() const;
@@ -152,6 +161,9 @@ private:
     Config m_config;
     ov::InferRequest m_encoder_request, m_decoder_request;
     std::shared_ptr<ov::Model> m_encoder_model = nullptr, m_decoder_model = nullptr;
+    std::optional<VAETilingConfig> m_tiling_config;
+    // requests which process tiles in parallel, the first ones are m_encoder_request and m_decoder_request
+    std::vector<ov::InferRequest> m_encoder_tile_requests, m_decoder_tile_requests;
 };
 
 } // namespace genai
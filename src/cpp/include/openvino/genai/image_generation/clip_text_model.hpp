@@ -6,6 +6,7 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/genai/visibility.hpp"
 #include "openvino/genai/tokenizer.hpp"
@@ -87,10 +88,28 @@ public:
 
     void set_adapters(const std::optional<AdapterConfig>& adapters);
 
+    /**
+     * @brief Encodes the positive prompt, preceded by the negative one in case of classifier free guidance. If
+     * TEXT_ENCODER_CACHE_SIZE_MB environment variable is set, outputs of each prompt are cached in a process-wide LRU
+     * cache of that size, shared by all pipelines and their clones, so that only prompts missing in the cache are
+     * encoded. Models with LoRA adapters bypass the cache.
+     * @return the first output of the model
+     */
     ov::Tensor infer(const std::string& pos_prompt, const std::string& neg_prompt, bool do_classifier_free_guidance);
 
     ov::Tensor get_output_tensor(const size_t idx);
 
+    /**
+     * @brief Returns the number of prompts of the last infer() call whose outputs were taken from the text encoder cache.
+     */
+    size_t get_num_cache_hits() const;
+
+    /**
+     * @brief Returns the number of prompts of the last infer() call which were encoded while the text encoder cache is
+     * enabled.
+     */
+    size_t get_num_cache_misses() const;
+
     /**
      * @brief Exports compiled model to a specified directory.
      * @param export_path A path to a directory to export compiled model to
@@ -103,7 +122,18 @@ private:
     Config m_config;
     AdapterController m_adapter_controller;
     Tokenizer m_clip_tokenizer;
-    bool m_slice_batch1_output = false;
+    // the number of prompts of the last inference, which fill the last rows of the model batch
+    size_t m_num_encoded_prompts = 0;
+    // identifies the model in keys of the text encoder cache, e.g. by its path
+    std::string m_cache_base_model_id;
+    // identifies the compiled model, its device and compile properties in keys of the text encoder cache
+    std::string m_cache_model_id;
+    // outputs of the last infer() call assembled from the text encoder cache, empty if they are taken from m_request
+    std::vector<ov::Tensor> m_cached_outputs;
+    size_t m_num_cache_hits = 0, m_num_cache_misses = 0;
+
+    void encode(const std::vector<std::string>& prompts);
+    ov::Tensor get_request_output_tensor(size_t idx);
 
 protected:
     ov::InferRequest m_request;
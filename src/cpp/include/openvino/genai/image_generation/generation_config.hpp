@@ -13,6 +13,7 @@
 #include "openvino/genai/lora_adapter.hpp"
 #include "openvino/genai/visibility.hpp"
 #include "openvino/genai/taylorseer_config.hpp"
+#include "openvino/genai/vae_tiling_config.hpp"
 
 namespace ov {
 namespace genai {
@@ -128,6 +129,12 @@ struct OPENVINO_GENAI_EXPORTS ImageGenerationConfig {
      */
     std::optional<TaylorSeerCacheConfig> taylorseer_config;
 
+    /**
+     * VAE tiling configuration, which makes VAE encode and decode images by overlapping tiles to bound memory
+     * consumption for high resolution images. std::nullopt processes whole images.
+     */
+    std::optional<VAETilingConfig> vae_tiling_config;
+
     /**
      * Checks whether image generation config is valid, otherwise throws an exception.
      */
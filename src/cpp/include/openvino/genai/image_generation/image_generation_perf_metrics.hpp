@@ -29,6 +29,8 @@ struct OPENVINO_GENAI_EXPORTS ImageGenerationPerfMetrics {
     MeanStdPair transformer_inference_duration; // inference duration for transformer model, should be filled with zeros if we don't have transformer, ms
     float vae_encoder_inference_duration; // inference duration of vae_encoder model, should be filled with zeros if we don't use it, ms
     float vae_decoder_inference_duration; // inference duration of vae_decoder model, ms
+    size_t text_encoder_cache_hits = 0; // number of prompts whose text encoder outputs were taken from the text encoder cache
+    size_t text_encoder_cache_misses = 0; // number of prompts encoded by text encoders while the text encoder cache is enabled
 
     bool m_evaluated = false;
 
@@ -6,6 +6,7 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/genai/visibility.hpp"
 #include "openvino/genai/tokenizer.hpp"
@@ -68,6 +69,13 @@ public:
         return compile(device, ov::AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * @brief Encodes the positive prompt, preceded by the negative one in case of classifier free guidance. If
+     * TEXT_ENCODER_CACHE_SIZE_MB environment variable is set, outputs and attention masks of each prompt are cached in
+     * a process-wide LRU cache of that size, shared by all pipelines and their clones, so that only prompts missing in
+     * the cache are encoded.
+     * @return the first output of the model
+     */
     ov::Tensor infer(const std::string& pos_prompt,
                      const std::string& neg_prompt,
                      bool do_classifier_free_guidance,
@@ -78,6 +86,17 @@ public:
 
     ov::Tensor get_prompt_attention_mask() const;
 
+    /**
+     * @brief Returns the number of prompts of the last infer() call whose outputs were taken from the text encoder cache.
+     */
+    size_t get_num_cache_hits() const;
+
+    /**
+     * @brief Returns the number of prompts of the last infer() call which were encoded while the text encoder cache is
+     * enabled.
+     */
+    size_t get_num_cache_misses() const;
+
 private:
     AdapterController m_adapter_controller;
     ov::InferRequest m_request;
@@ -86,6 +105,16 @@ private:
     ov::Tensor m_prompt_attention_mask;
 
     Tokenizer m_tokenizer;
+
+    // identifies the model in keys of the text encoder cache, e.g. by its path
+    std::string m_cache_base_model_id;
+    // identifies the compiled model, its device and compile properties in keys of the text encoder cache
+    std::string m_cache_model_id;
+    // outputs of the last infer() call assembled from the text encoder cache, empty if they are taken from m_request
+    std::vector<ov::Tensor> m_cached_outputs;
+    size_t m_num_cache_hits = 0, m_num_cache_misses = 0;
+
+    void encode(const std::vector<std::string>& prompts, int max_sequence_length, const ov::AnyMap& tokenization_params);
 };
 
 } // namespace genai
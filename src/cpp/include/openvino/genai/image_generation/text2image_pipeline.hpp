@@ -9,6 +9,10 @@
 namespace ov {
 namespace genai {
 
+// forward declaration
+class StepBatchingEngine;
+class PipelinedGenerationEngine;
+
 /**
  * Text to image pipelines which provides unified API to all supported models types.
  * Models specific aspects are hidden in image generation config, which includes multiple prompts support or
@@ -230,6 +234,39 @@ public:
                        vae_device, ov::AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * Enables step-level batching of generate() calls made concurrently by several threads, which then share this
+     * pipeline instead of using its clones. A background thread denoises the latents of all requests with the same
+     * resolution by one UNet inference per step, while each request keeps its own scheduler state, timesteps, guidance
+     * scale and random generator. Requests join and leave the batch between denoising steps, callbacks are called
+     * from the background thread.
+     *
+     * Supported for Stable Diffusion and Latent Consistency Model pipelines whose UNet accepts dynamic batch size,
+     * i.e. isn't reshaped or compiled for NPU. LoRA adapters can't be set per request, TaylorSeer caching isn't
+     * supported. Requests use clones of the current scheduler, so set_scheduler() and set_generation_config() must
+     * be called before this method; they, as well as reshape() and compile(), throw once step batching is enabled.
+     * @param max_batch_size Maximum batch size of UNet inference. A request takes 2 * num_images_per_prompt rows with
+     * classifier free guidance and num_images_per_prompt rows otherwise, generate() fails for requests taking more rows.
+     */
+    void enable_step_batching(size_t max_batch_size = 8);
+
+    /**
+     * Enables pipelined execution of generate() calls made concurrently by several threads, which then share this
+     * pipeline instead of using its clones. Text encoding, denoising and VAE decoding run in background threads with
+     * their own infer requests, so that the VAE decoding of a request overlaps the denoising of the next one and the
+     * text encoding of the one after it. It improves throughput when the stages are compiled for different devices,
+     * see compile(text_encode_device, denoise_device, vae_device, properties), or for CPU with several streams.
+     * Callbacks are called from the denoising thread.
+     *
+     * Must be called after the pipeline is compiled and can't be combined with enable_step_batching(). The pipeline
+     * can't be reshaped or compiled afterwards. set_generation_config(), set_scheduler() and get_performance_metrics()
+     * may be called while other threads generate: they wait for the requests in flight to be done and hold new ones
+     * back meanwhile. get_performance_metrics() reports the denoising stage of the last request only.
+     * @param max_in_flight_requests Maximum number of requests processed by all stages at once, further generate()
+     * calls wait for one of them to be done.
+     */
+    void enable_pipelined_generation(size_t max_in_flight_requests = 4);
+
     /**
      * Generates image(s) based on prompt and other image generation parameters
      * @param positive_prompt Prompt to generate image(s) from
@@ -264,6 +301,8 @@ public:
 
 private:
     std::shared_ptr<DiffusionPipeline> m_impl;
+    std::shared_ptr<StepBatchingEngine> m_step_batching_engine;
+    std::shared_ptr<PipelinedGenerationEngine> m_pipelined_generation_engine;
 
     explicit Text2ImagePipeline(const std::shared_ptr<DiffusionPipeline>& impl);
 };
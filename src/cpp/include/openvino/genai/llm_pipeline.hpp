@@ -344,6 +344,32 @@ public:
         "Please, use generate() with ChatHistory argument.")
     void finish_chat();
 
+    /**
+    * @brief Starts a new chat session, which is continued by subsequent generate() calls.
+    * The KV cache of the current session, if any, is saved to a host store, so that the session can be resumed
+    * without processing its history again. The store budget and precision are set by ov::genai::session_cache_size
+    * and ov::genai::session_cache_precision properties. Sessions are supported by the stateful pipeline only, which is
+    * selected by ATTENTION_BACKEND set to SDPA.
+    *
+    * @param session_id id of the new session, must differ from ids of open sessions.
+    */
+    void create_session(const std::string& session_id);
+
+    /**
+    * @brief Switches to a previously created session restoring its chat history and KV cache.
+    * If the KV cache of the session was evicted from the store, the history is processed again by the next generate() call.
+    *
+    * @param session_id id of an open session.
+    */
+    void resume_session(const std::string& session_id);
+
+    /**
+    * @brief Closes a session releasing its saved KV cache. Closing the current session clears the KV cache and finishes the chat.
+    *
+    * @param session_id id of an open session.
+    */
+    void close_session(const std::string& session_id);
+
 private:
     std::string m_device;
     std::unique_ptr<LLMPipelineImplBase> m_pimpl;
@@ -403,6 +429,20 @@ static constexpr ov::Property<bool> prompt_lookup{"prompt_lookup"};
 */
 static constexpr ov::Property<bool> enable_save_ov_model{"enable_save_ov_model"};
 
+/**
+* @brief session_cache_size property sets the max size in MB of the host store of KV caches of inactive chat sessions
+* (see LLMPipeline::create_session()). The least recently used sessions are evicted from the store when it's exceeded.
+* Requires ATTENTION_BACKEND to be set to SDPA.
+*/
+static constexpr ov::Property<size_t> session_cache_size{"session_cache_size"};
+
+/**
+* @brief session_cache_precision property sets the precision KV caches of inactive chat sessions are compressed to
+* in the store: ov::element::f16 or ov::element::u8. KV caches are stored in their original precision by default.
+* Requires ATTENTION_BACKEND to be set to SDPA.
+*/
+static constexpr ov::Property<ov::element::Type> session_cache_precision{"session_cache_precision"};
+
 
 }  // namespace genai
 }  // namespace ov
@@ -191,9 +191,22 @@ public:
 
     AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device);
 
+    // If `per_token_adapters` is true and one of the dynamic modes is used, then the model gets an additional state to select
+    // adapters for each token of the input, so that different adapters can be applied within one inference, see apply_per_token.
+    // Adapters targeting lm_head aren't supported in this case, as lm_head may compute logits of a part of the tokens only.
+    AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device, bool per_token_adapters);
+
     // Apply adapters configured in the current config set last time, or set and use new config given as optional `config` argument
     void apply(ov::InferRequest request, const std::optional<AdapterConfig>& config = std::nullopt);
 
+    // Apply different adapters to different tokens of the next inference, e.g. for requests with different adapters in one
+    // continuous batching step. `token_ranges` splits the input tokens into consecutive ranges given as
+    // {index of a config in `configs`, number of tokens}. All adapters of the configs are kept in the model state at once,
+    // so it is changed only when a new adapter appears. Requires the controller to be created with `per_token_adapters`.
+    void apply_per_token(ov::InferRequest request,
+                         const std::vector<AdapterConfig>& configs,
+                         const std::vector<std::pair<size_t, size_t>>& token_ranges);
+
     // Returns true if a given name is one of the state names created by this adapter controller for dynamic LoRA
     // Helps to distinguish LoRA states from other states (e.g. KV cache state) in the model for a partial state reset.
     bool has_state_name(const std::string& name);
@@ -74,6 +74,13 @@ public:
          */
         std::optional<size_t> batch_size;
 
+        /**
+         * @brief Max number of tokens, including padding, in a single inference of the embedding model.
+         * If set, documents are sorted by length and split into micro batches fitting the budget, which run
+         * concurrently on several infer requests. Not compatible with batch_size and pad_to_max_length.
+         */
+        std::optional<size_t> max_batch_tokens;
+
         /**
          * @brief Pooling strategy applied to model output tensor
          */
@@ -220,5 +227,11 @@ static constexpr ov::Property<std::string> embed_instruction{"embed_instruction"
  */
 static constexpr ov::Property<size_t> batch_size{"batch_size"};
 
+/**
+ * @brief Max number of tokens, including padding, in a single inference of the model.
+ * If set, inputs are sorted by length and split into micro batches fitting the budget to reduce padding.
+ */
+static constexpr ov::Property<size_t> max_batch_tokens{"max_batch_tokens"};
+
 }  // namespace genai
 }  // namespace ov
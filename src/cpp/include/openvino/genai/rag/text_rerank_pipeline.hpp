@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "openvino/genai/rag/text_embedding_pipeline.hpp"
 #include "openvino/genai/tokenizer.hpp"
 
 namespace ov {
@@ -31,6 +32,13 @@ public:
          */
         std::optional<std::string> padding_side;
 
+        /**
+         * @brief Max number of tokens, including padding, in a single inference of the rerank model.
+         * If set, documents are sorted by length and split into micro batches fitting the budget, which run
+         * concurrently on several infer requests. Not compatible with pad_to_max_length.
+         */
+        std::optional<size_t> max_batch_tokens;
+
         /**
          * @brief Constructs text rerank pipeline configuration
          */
@@ -47,6 +55,12 @@ public:
          * ov::genai::TextRerankPipeline::Config config({{"top_n", 3}});
          */
         explicit Config(const ov::AnyMap& properties);
+
+        /**
+         * @brief checks that are no conflicting parameters
+         * @throws Exception if config is invalid.
+         */
+        void validate() const;
     };
 
     /**
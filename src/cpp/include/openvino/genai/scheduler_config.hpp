@@ -5,11 +5,23 @@
 
 #include <cstddef>
 #include <sstream>
+#include <string>
 
 #include "openvino/genai/cache_eviction.hpp"
 #include "openvino/genai/sparse_attention.hpp"
 
 namespace ov::genai {
+
+/**
+ * @brief Order in which the continuous batching scheduler serves requests and selects the ones to be preempted.
+ */
+enum class SchedulingPolicy {
+    FIFO,                               // requests are served in the order of their arrival
+    PRIORITY,                           // requests with higher GenerationConfig::priority are served first
+    EARLIEST_DEADLINE_FIRST,            // requests with the closest GenerationConfig::deadline_ms are served first
+    SHORTEST_REMAINING_PROMPT_FIRST     // requests with the smallest number of not yet processed prompt tokens are served first
+};
+
 struct SchedulerConfig {
     // a maximum number of tokens to batch
     // (in contrast to max_batch_size which combines independent sequences, we consider total amount of tokens in a batch)
@@ -68,11 +80,34 @@ struct SchedulerConfig {
      */
     SparseAttentionConfig sparse_attention_config;
 
+    // Order in which requests are scheduled. Lower priority requests are preempted first when KV-cache is exhausted,
+    // within the same priority the ones which are cheaper to recompute are preempted first.
+    SchedulingPolicy scheduling_policy = SchedulingPolicy::FIFO;
+
+    // size of host memory in GB used to keep KV-cache of preempted sequences.
+    // When set, a preempted sequence with a long context is swapped out to host memory and swapped back in on resume
+    // instead of dropping its KV-cache and recomputing the whole context.
+    // Swapping is supported for KV-cache placed in host memory (CPU). 0 means that preempted sequences are always recomputed.
+    std::size_t swap_space = 0;
+
+    // Lower tiers of prefix cache, used only when enable_prefix_caching is turned on and KV-cache is placed in host memory (CPU).
+    // Prefix cache blocks which are overwritten in KV-cache are spilled to the host memory tier, blocks evicted from it are
+    // spilled to the disk tier. Prompts whose prefix is found in these tiers are restored from them instead of being recomputed.
+    // size of host memory tier of prefix cache in GB, 0 means that host memory tier is not used
+    std::size_t prefix_cache_host_size = 0;
+    // path to a file used for disk tier of prefix cache, the file is overwritten and removed at pipeline destruction
+    std::string prefix_cache_disk_path;
+    // size of disk tier of prefix cache in GB, 0 means that disk tier is not used
+    std::size_t prefix_cache_disk_size = 0;
+
     bool operator==(const SchedulerConfig& other) const {
         return max_num_batched_tokens == other.max_num_batched_tokens && num_kv_blocks == other.num_kv_blocks &&
                cache_size == other.cache_size &&
                dynamic_split_fuse == other.dynamic_split_fuse && use_cache_eviction == other.use_cache_eviction &&
-               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching;
+               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching &&
+               scheduling_policy == other.scheduling_policy && swap_space == other.swap_space &&
+               prefix_cache_host_size == other.prefix_cache_host_size && prefix_cache_disk_path == other.prefix_cache_disk_path &&
+               prefix_cache_disk_size == other.prefix_cache_disk_size;
     }
 
     /**
@@ -99,6 +134,20 @@ struct SchedulerConfig {
         if (use_sparse_attention) {
             oss << sparse_attention_config.to_string() << "\n";
         }
+        oss << "  scheduling_policy: ";
+        switch (scheduling_policy) {
+            case SchedulingPolicy::FIFO: oss << "FIFO"; break;
+            case SchedulingPolicy::PRIORITY: oss << "PRIORITY"; break;
+            case SchedulingPolicy::EARLIEST_DEADLINE_FIRST: oss << "EARLIEST_DEADLINE_FIRST"; break;
+            case SchedulingPolicy::SHORTEST_REMAINING_PROMPT_FIRST: oss << "SHORTEST_REMAINING_PROMPT_FIRST"; break;
+        }
+        oss << "\n";
+        oss << "  swap_space: " << swap_space << "\n";
+        if (enable_prefix_caching) {
+            oss << "  prefix_cache_host_size: " << prefix_cache_host_size << "\n";
+            oss << "  prefix_cache_disk_path: " << prefix_cache_disk_path << "\n";
+            oss << "  prefix_cache_disk_size: " << prefix_cache_disk_size << "\n";
+        }
         oss << " }";
         return oss.str();
     }
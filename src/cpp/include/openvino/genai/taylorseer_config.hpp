@@ -19,6 +19,7 @@ public:
             << "  cache_interval: " << cache_interval << "\n"
             << "  disable_cache_before_step: " << disable_cache_before_step << "\n"
             << "  disable_cache_after_step: " << disable_cache_after_step << "\n"
+            << "  order: " << order << "\n"
             << "}";
         return oss.str();
     }
@@ -32,6 +33,10 @@ public:
     /** The denoising step index after which caching is disabled.
      *  If negative, calculated as num_inference_steps + disable_cache_after_step */
     int disable_cache_after_step = -2;
+
+    /** The order of the Taylor expansion which predicts the denoiser output at the cached steps.
+     *  0 reuses the output of the last computed step, 1 extrapolates the last two computed outputs linearly. */
+    std::size_t order = 1;
 };
 
 } // namespace ov::genai
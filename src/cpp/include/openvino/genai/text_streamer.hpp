@@ -36,6 +36,13 @@ protected:
     size_t m_printed_len = 0;
     ov::AnyMap m_additional_detokenization_params;
 
+    // Incremental detokenization state: on each write only the tokens starting from m_window_begin are decoded,
+    // the text of the tokens before m_window_anchor (m_anchor_decoded_len characters) is already known.
+    size_t m_window_begin = 0;
+    size_t m_window_anchor = 0;
+    size_t m_window_anchor_text_len = 0;
+    size_t m_anchor_decoded_len = 0;
+
     StreamingStatus set_streaming_status(CallbackTypeVariant callback_status);
 
     std::function<CallbackTypeVariant(std::string)> m_subword_callback = [](std::string words) -> bool {
@@ -45,6 +52,12 @@ protected:
     StreamingStatus run_callback_if_needed(const std::string& text);
 
     void compute_decoded_length_for_position(size_t cache_position);
+
+    std::string decode_window(size_t end);
+    int64_t get_decoded_length(const std::string& window_text) const;
+    size_t get_window_text_offset(size_t decoded_len) const;
+    void move_decoding_window();
+    void reset_decoding_window();
 };
 
 class OPENVINO_GENAI_EXPORTS TextParserStreamer : public TextStreamer {
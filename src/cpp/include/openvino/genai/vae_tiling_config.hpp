@@ -0,0 +1,47 @@
+// Copyright (C) 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <sstream>
+
+namespace ov::genai {
+
+/**
+ * Configuration of tiled VAE inference: the VAE processes overlapping tiles of an image or a video and blends them
+ * linearly over the overlaps, so VAE memory consumption is bounded by the tile size rather than the output size.
+ * The VAE models must have dynamic spatial (and temporal for video) dimensions.
+ */
+class VAETilingConfig {
+public:
+    std::string to_string() const {
+        std::ostringstream oss;
+        oss << "VAETilingConfig {\n"
+            << "  tile_size: " << tile_size << "\n"
+            << "  tile_overlap: " << tile_overlap << "\n"
+            << "  tile_num_frames: " << tile_num_frames << "\n"
+            << "  frame_overlap: " << frame_overlap << "\n"
+            << "  num_infer_requests: " << num_infer_requests << "\n"
+            << "}";
+        return oss.str();
+    }
+
+    /** The height and width of tiles in pixels. Images and video frames which fit a tile are processed at once. */
+    std::size_t tile_size = 512;
+
+    /** The minimal overlap of neighbouring tiles in pixels. Must be less than tile_size. */
+    std::size_t tile_overlap = 128;
+
+    /** The number of video frames per tile, used by video VAEs only. */
+    std::size_t tile_num_frames = 33;
+
+    /** The minimal overlap of neighbouring tiles in video frames, used by video VAEs only. */
+    std::size_t frame_overlap = 8;
+
+    /** The number of infer requests which process tiles in parallel. */
+    std::size_t num_infer_requests = 1;
+};
+
+} // namespace ov::genai
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <filesystem>
+#include <functional>
+#include <optional>
 #include <vector>
 #include <string>
 
@@ -14,6 +16,7 @@
 
 #include "openvino/genai/visibility.hpp"
 #include "openvino/genai/image_generation/generation_config.hpp"
+#include "openvino/genai/vae_tiling_config.hpp"
 
 namespace ov::genai {
 
@@ -52,6 +55,20 @@ public:
 
     ov::Tensor decode(const ov::Tensor& latent);
 
+    /**
+     * @brief Decodes latent and passes decoded frames to a callback as soon as they are ready. With tiling, frames are
+     * passed in chunks as tiles along frames axis are decoded, so the whole video doesn't have to be kept in memory.
+     * @param frames_callback called with consecutive frames [B, F, H, W, C] of the video
+     */
+    void decode(const ov::Tensor& latent, const std::function<void(const ov::Tensor&)>& frames_callback);
+
+    /**
+     * @brief Makes decode() process videos by overlapping spatio-temporal tiles, which bounds memory consumed by the VAE
+     * for long and high resolution videos. The VAE decoder must have dynamic frames and spatial dimensions.
+     * @param tiling_config tiling configuration, std::nullopt processes whole videos
+     */
+    void set_tiling_config(const std::optional<VAETilingConfig>& tiling_config);
+
     const Config& get_config() const;
 
     size_t get_vae_scale_factor() const;
@@ -60,10 +77,15 @@ public:
 
 private:
     void merge_vae_video_post_processing() const;
+    size_t get_spatial_compression_ratio() const;
+    size_t get_temporal_compression_ratio() const;
 
     Config m_config;
     ov::InferRequest m_encoder_request, m_decoder_request;
     std::shared_ptr<ov::Model> m_encoder_model = nullptr, m_decoder_model = nullptr;
+    std::optional<VAETilingConfig> m_tiling_config;
+    // requests which process tiles in parallel, the first one is m_decoder_request
+    std::vector<ov::InferRequest> m_decoder_tile_requests;
 
     int64_t m_transformer_patch_size = -1, m_transformer_patch_size_t = -1;
 };
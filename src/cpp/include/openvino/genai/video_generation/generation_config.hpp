@@ -56,6 +56,12 @@ struct VideoGenerationConfig {
     /// Video frame rate. Affects rope_interpolation_scale. Any value can be used although positive
     /// non-infinity makes the most sense. NaN corresponds to model default which is 25.0f for LTX-Video.
     std::optional<float> frame_rate = std::nullopt;
+    /// TaylorSeer configuration which predicts the transformer output at some of the denoising steps instead of
+    /// computing it. std::nullopt runs the transformer at every step.
+    std::optional<TaylorSeerCacheConfig> taylorseer_config = std::nullopt;
+    /// VAE tiling configuration, which makes VAE decode videos by overlapping spatio-temporal tiles to bound memory
+    /// consumption for long and high resolution videos. std::nullopt decodes whole videos.
+    std::optional<VAETilingConfig> vae_tiling_config = std::nullopt;
 };
 
 /**
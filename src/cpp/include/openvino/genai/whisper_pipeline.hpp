@@ -98,6 +98,28 @@ struct WhisperDecodedResults {
     }
 };
 
+struct WhisperStreamingConfig {
+    // length of new audio in seconds after which the stream is transcribed again, bounds the latency of results.
+    // Each step runs the encoder on a full 30 s input whatever the window length is, and the decoder on the tokens past
+    // the stable ones, so a step costs about as much as transcribing a 30 s chunk offline and the stream takes
+    // 30 / step_length encoder inferences per 30 s of audio. step_length must exceed the duration of a step on the
+    // target device for the stream to keep up with real time, 1-2 s suits most devices.
+    float step_length = 1.0f;
+
+    // once the transcribed window of audio is longer than this length in seconds, its start moves past the stable
+    // segments, the rest of the window is transcribed again with the new audio
+    float max_window_length = 15.0f;
+};
+
+struct WhisperStreamingResult {
+    // text which became stable since the previous result, it continues the stable text of the previous results and
+    // isn't revised by the later audio
+    std::string stable_text;
+
+    // hypothesis for the rest of the received audio, it's replaced by the partial text of the next result
+    std::string partial_text;
+};
+
 /**
  * @brief Automatic speech recognition pipeline
  */
@@ -164,6 +186,45 @@ public:
     }
     WhisperDecodedResults generate(const RawSpeechInput& raw_speech_input, const ov::AnyMap& config_map);
 
+    /**
+     * @brief Transcribes a batch of audio inputs. Encoder and decoder run on dynamic batches made of the next 30s
+     * chunks of the inputs, the inputs whose transcription is finished drop out of the batch.
+     *
+     * @param raw_speech_inputs raw speech inputs. Required to be normalized to near [-1, 1] range and have 16k Hz
+     * sampling rate.
+     * @param generation_config optional GenerationConfig, word-level timestamps are not supported for a batch
+     * @return std::vector<WhisperDecodedResults> transcription of each input, performance metrics are the ones of
+     * the whole batch
+     */
+    std::vector<WhisperDecodedResults> generate(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                OptionalWhisperGenerationConfig generation_config = std::nullopt);
+
+    /**
+     * @brief Starts transcription of an audio stream, which receives audio with push_audio() and is finished with
+     * finish_stream(). A previous stream is dropped. Supported by the stateful pipeline only.
+     *
+     * @param generation_config optional GenerationConfig, word-level timestamps are not supported for streams
+     * @param streaming_config latency and window settings of the stream
+     */
+    void start_stream(OptionalWhisperGenerationConfig generation_config = std::nullopt,
+                      const WhisperStreamingConfig& streaming_config = {});
+
+    /**
+     * @brief Appends audio to the stream and transcribes the received audio once step_length of new audio has arrived.
+     *
+     * @param raw_speech_input next raw speech samples of the stream. Required to be normalized to near [-1, 1] range
+     * and have 16k Hz sampling rate.
+     * @return WhisperStreamingResult text which became stable and the current partial text
+     */
+    WhisperStreamingResult push_audio(const RawSpeechInput& raw_speech_input);
+
+    /**
+     * @brief Transcribes the rest of the stream and finishes it.
+     *
+     * @return WhisperStreamingResult the rest of the stable text with empty partial text
+     */
+    WhisperStreamingResult finish_stream();
+
     ov::genai::Tokenizer get_tokenizer();
     WhisperGenerationConfig get_generation_config() const;
     void set_generation_config(const WhisperGenerationConfig& config);
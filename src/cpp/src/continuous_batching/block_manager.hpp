@@ -6,9 +6,11 @@
 #include <memory>
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <algorithm>
 #include <fstream>
 #include <chrono>
+#include <utility>
 
 #include "sequence_group.hpp"
 
@@ -80,8 +82,41 @@ using BlocksPerLayer = std::vector<KVCacheBlock::Ptr>;
  * runs out of fresh blocks, or reused if their contents match to the prefix-based requested hash.
  */
 class OverwritableBlocksHashStore {
-    std::map<size_t, BlocksPerLayer> m_blocks;
+    std::unordered_map<size_t, BlocksPerLayer> m_blocks;
     size_t m_num_layers;
+
+    struct LRUEntry {
+        std::chrono::time_point<std::chrono::steady_clock> timestamp;
+        size_t hash;
+        int block_index;
+    };
+    // Min-heap of the stored blocks by their timestamps. Entries are removed lazily: entries of blocks which already
+    // left the store are skipped, and entries of blocks whose timestamps were updated are pushed again when popped.
+    std::vector<LRUEntry> m_lru_heap;
+
+    static bool _is_more_recent(const LRUEntry& lhs, const LRUEntry& rhs) {
+        return lhs.timestamp > rhs.timestamp;
+    }
+
+    void _push_lru_entry(const LRUEntry& entry) {
+        m_lru_heap.push_back(entry);
+        std::push_heap(m_lru_heap.begin(), m_lru_heap.end(), _is_more_recent);
+    }
+
+    void _compact_lru_heap() {
+        // drop entries of the blocks which left the store, so that the heap size stays proportional to the store size
+        if (m_lru_heap.size() <= 2 * m_blocks.size() + 16)
+            return;
+        m_lru_heap.clear();
+        for (const auto& [hash, blocks_for_all_layers] : m_blocks) {
+            m_lru_heap.push_back({blocks_for_all_layers[0]->get_timestamp(), hash, blocks_for_all_layers[0]->get_index()});
+        }
+        std::make_heap(m_lru_heap.begin(), m_lru_heap.end(), _is_more_recent);
+    }
+
+    // blocks given away for overwriting, along with their previous hashes, to be spilled to lower prefix cache tiers
+    bool m_track_overwritten_blocks = false;
+    std::vector<std::pair<size_t, std::vector<size_t>>> m_overwritten_blocks;
     public:
     /**
      * Constructs the BlockHashStore.
@@ -106,6 +141,8 @@ class OverwritableBlocksHashStore {
         }
         OPENVINO_ASSERT(m_blocks.count(hash) == 0);
         m_blocks[hash] = blocks_for_all_layers;
+        _push_lru_entry({blocks_for_all_layers[0]->get_timestamp(), hash, blocks_for_all_layers[0]->get_index()});
+        _compact_lru_heap();
     }
 
 
@@ -141,17 +178,63 @@ class OverwritableBlocksHashStore {
         if (m_blocks.empty()) {
             return {};
         }
-        auto hash_and_blocks_for_all_layers = std::min_element(std::begin(m_blocks), std::end(m_blocks), [](const auto& lhs, const auto& rhs) -> bool { return lhs.second[0]->get_timestamp() < rhs.second[0]->get_timestamp(); });
+        auto hash_and_blocks_for_all_layers = m_blocks.end();
+        while (hash_and_blocks_for_all_layers == m_blocks.end()) {
+            OPENVINO_ASSERT(!m_lru_heap.empty(), "internal error - LRU heap is out of sync with block hash store");
+            std::pop_heap(m_lru_heap.begin(), m_lru_heap.end(), _is_more_recent);
+            LRUEntry entry = m_lru_heap.back();
+            m_lru_heap.pop_back();
+
+            auto it = m_blocks.find(entry.hash);
+            if (it == m_blocks.end() || it->second[0]->get_index() != entry.block_index) {
+                // the block has been restored or removed from the store since the entry was pushed
+                continue;
+            }
+            auto timestamp = it->second[0]->get_timestamp();
+            if (timestamp != entry.timestamp) {
+                entry.timestamp = timestamp;
+                _push_lru_entry(entry);
+                continue;
+            }
+            hash_and_blocks_for_all_layers = it;
+        }
         auto blocks_for_all_layers = hash_and_blocks_for_all_layers->second;
+        if (m_track_overwritten_blocks) {
+            std::vector<size_t> block_indices;
+            block_indices.reserve(blocks_for_all_layers.size());
+            for (const auto& block_ptr : blocks_for_all_layers) {
+                block_indices.push_back(block_ptr->get_index());
+            }
+            m_overwritten_blocks.emplace_back(hash_and_blocks_for_all_layers->first, std::move(block_indices));
+        }
         auto timestamp = std::chrono::steady_clock::now();
         for (auto& block_ptr : blocks_for_all_layers) {
             block_ptr->set_timestamp(timestamp);
             block_ptr->increment();
         }
-        m_blocks.erase(hash_and_blocks_for_all_layers->first);
+        m_blocks.erase(hash_and_blocks_for_all_layers);
         return blocks_for_all_layers;
     }
 
+    /**
+     * Enables tracking of blocks returned by get_lru_block_to_overwrite, so that their contents can be saved
+     * before being overwritten.
+     */
+    void set_track_overwritten_blocks(bool track_overwritten_blocks) {
+        m_track_overwritten_blocks = track_overwritten_blocks;
+        if (!track_overwritten_blocks) {
+            m_overwritten_blocks.clear();
+        }
+    }
+
+    /**
+     * Returns and forgets the blocks given away for overwriting since the previous call.
+     * @return A vector of pairs of the previous block hash and the block indices (one for each decoder layer).
+     */
+    std::vector<std::pair<size_t, std::vector<size_t>>> pop_overwritten_blocks() {
+        return std::exchange(m_overwritten_blocks, {});
+    }
+
     /**
      *
      * @return Number of blocks (per layer) currently in the store.
@@ -181,26 +264,101 @@ class OverwritableBlocksHashStore {
 
     void clear() {
         m_blocks.clear();
+        m_lru_heap.clear();
+        m_overwritten_blocks.clear();
     }
 };
 
 class CacheStateDumper;
 
+/**
+ * @brief FIFO queue of free KV cache block indices kept in a flat ring buffer, so that allocating and freeing blocks
+ * neither allocates memory nor walks list nodes.
+ */
+class FreeBlockQueue {
+    std::vector<int> m_indices;
+    size_t m_head = 0;
+    size_t m_size = 0;
+
+public:
+    /**
+     * Grows the queue capacity preserving the order of the queued indices.
+     * @param capacity New capacity, must be not less than the current one.
+     */
+    void reserve(size_t capacity) {
+        OPENVINO_ASSERT(capacity >= m_indices.size());
+        if (capacity == m_indices.size())
+            return;
+        std::vector<int> indices(capacity);
+        for (size_t i = 0; i < m_size; ++i) {
+            indices[i] = m_indices[(m_head + i) % m_indices.size()];
+        }
+        m_indices = std::move(indices);
+        m_head = 0;
+    }
+
+    void push_back(int index) {
+        OPENVINO_ASSERT(m_size < m_indices.size(), "internal error - free block queue overflow");
+        m_indices[(m_head + m_size) % m_indices.size()] = index;
+        ++m_size;
+    }
+
+    int pop_front() {
+        OPENVINO_ASSERT(m_size > 0, "internal error - free block queue is empty");
+        int index = m_indices[m_head];
+        m_head = (m_head + 1) % m_indices.size();
+        --m_size;
+        return index;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    void clear() {
+        m_indices.clear();
+        m_head = 0;
+        m_size = 0;
+    }
+};
+
 /**
  * @brief Maintains a pool of KV cache block descriptors (layered as configured at initialization), freeing or allocating
  * them as requested.
  */
 class BlockAllocator {
-    std::vector<std::list<KVCacheBlock::Ptr>> m_free_blocks;
-    // We keep m_free_blocks_num instead of m_free_blocks[X].size() to WA old CXX library implementation issue for std::list::size()
-    // see https://stackoverflow.com/questions/13157164/why-isnt-stdlist-size-constant-time
-    std::vector<size_t> m_free_blocks_num;
+    // descriptors of all blocks for each layer, indexed by block index
+    std::vector<std::vector<KVCacheBlock::Ptr>> m_blocks;
+    // indices of free blocks for each layer
+    std::vector<FreeBlockQueue> m_free_blocks;
     size_t m_total_num_blocks;
     friend class CacheStateDumper;
     size_t m_num_layers;
     bool m_enable_prefix_caching;
     ov::genai::OverwritableBlocksHashStore m_overwriteable_blocks;
 
+    /**
+     * Creates descriptors for blocks in range [begin, end) and adds them to the free pool of each layer.
+     */
+    void _add_blocks(size_t begin, size_t end) {
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+            m_blocks[layer_idx].reserve(end);
+            m_free_blocks[layer_idx].reserve(end);
+            for (size_t block_id = begin; block_id < end; ++block_id) {
+                m_blocks[layer_idx].push_back(std::make_shared<KVCacheBlock>(static_cast<int>(block_id)));
+                m_free_blocks[layer_idx].push_back(static_cast<int>(block_id));
+            }
+        }
+    }
+
+    void _push_free_block(const KVCacheBlock::Ptr& block_ptr, size_t layer_idx) {
+        m_free_blocks[layer_idx].push_back(block_ptr->get_index());
+    }
+
+    const KVCacheBlock::Ptr& _pop_free_block(size_t layer_idx) {
+        return m_blocks[layer_idx][m_free_blocks[layer_idx].pop_front()];
+    }
+
 public:
     /**
      * Constructs the BlockAllocator.
@@ -213,38 +371,22 @@ public:
     BlockAllocator(size_t num_blocks, bool enable_prefix_caching, size_t num_layers = 1) :
             m_total_num_blocks(num_blocks), m_num_layers(num_layers), m_enable_prefix_caching(enable_prefix_caching), m_overwriteable_blocks(num_layers) {
         OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero");
+        m_blocks.resize(m_num_layers);
         m_free_blocks.resize(m_num_layers);
-        if (num_blocks > 0) {
-            m_free_blocks_num = std::vector<size_t>(num_layers, num_blocks);
-            for (auto& per_layer_block_list : m_free_blocks) {
-                for (int block_id = 0; block_id < m_total_num_blocks; ++block_id) {
-                    per_layer_block_list.push_back(std::make_shared<KVCacheBlock>(block_id));
-                }
-            }
-        } else {
-            m_free_blocks_num = std::vector<size_t>(m_num_layers, 0);
-        }
+        _add_blocks(0, m_total_num_blocks);
     }
 
     ~BlockAllocator() {
         // sanity check to validate that all blocks are freed
-        for (auto& free_block : m_free_blocks_num) {
-            size_t free_and_overwritable_block_cnt = free_block + num_overwriteable_blocks();
+        for (auto& free_blocks : m_free_blocks) {
+            size_t free_and_overwritable_block_cnt = free_blocks.size() + num_overwriteable_blocks();
             OPENVINO_ASSERT(m_total_num_blocks == free_and_overwritable_block_cnt, "Expected num free blocks: ", m_total_num_blocks, ", actual: ", free_and_overwritable_block_cnt);
         }
     }
 
     void increase_kv_blocks_number(size_t new_kv_blocks_count) {
         OPENVINO_ASSERT(new_kv_blocks_count > m_total_num_blocks, "New blocks number should be more than previous blocks number.");
-        size_t added_blocks = new_kv_blocks_count - m_total_num_blocks;
-        for (auto idx = 0; idx < m_free_blocks_num.size(); idx++) {
-            m_free_blocks_num[idx] += added_blocks;
-        }
-        for (auto& per_layer_block_list : m_free_blocks) {
-            for (int block_id = m_total_num_blocks; block_id < new_kv_blocks_count; ++block_id) {
-                per_layer_block_list.push_back(std::make_shared<KVCacheBlock>(block_id));
-            }
-        }
+        _add_blocks(m_total_num_blocks, new_kv_blocks_count);
         m_total_num_blocks = new_kv_blocks_count;
     }
 
@@ -255,7 +397,7 @@ public:
      * @return Number of free blocks for this layer.
      */
     size_t num_free_blocks(size_t layer_idx) const {
-        return m_free_blocks_num[layer_idx] + num_overwriteable_blocks();
+        return m_free_blocks[layer_idx].size() + num_overwriteable_blocks();
     }
 
     /**
@@ -300,8 +442,7 @@ public:
         OPENVINO_ASSERT(layer_idx < m_num_layers);
         block_ptr->release();
         if (block_ptr->is_free()) {
-            m_free_blocks[layer_idx].push_back(block_ptr);
-            ++m_free_blocks_num[layer_idx];
+            _push_free_block(block_ptr, layer_idx);
         }
     }
 
@@ -356,8 +497,7 @@ public:
 
                         // actual collision case
                         for (size_t layer_idx = 0; layer_idx < colliding_blocks_per_layer.size(); layer_idx++) {
-                            m_free_blocks[layer_idx].push_back(colliding_blocks_per_layer[layer_idx]);
-                            ++m_free_blocks_num[layer_idx];
+                            _push_free_block(colliding_blocks_per_layer[layer_idx], layer_idx);
                         }
                     }
                     m_overwriteable_blocks.add(blocks_for_all_layers);
@@ -365,15 +505,13 @@ public:
                     // This set of blocks to be freed corresponds to blocks from different time steps, and thus not eligible for caching
                     // TODO (vshampor): more fine-grained hash store control
                     for (size_t layer_idx = 0; layer_idx < blocks_for_all_layers.size(); layer_idx++) {
-                        m_free_blocks[layer_idx].push_back(blocks_for_all_layers[layer_idx]);
-                        ++m_free_blocks_num[layer_idx];
+                        _push_free_block(blocks_for_all_layers[layer_idx], layer_idx);
                     }
                 }
             }
             else {
                 for (size_t layer_idx = 0; layer_idx < blocks_for_all_layers.size(); layer_idx++) {
-                    m_free_blocks[layer_idx].push_back(blocks_for_all_layers[layer_idx]);
-                    ++m_free_blocks_num[layer_idx];
+                    _push_free_block(blocks_for_all_layers[layer_idx], layer_idx);
                 }
             }
         }
@@ -400,10 +538,8 @@ public:
         OPENVINO_ASSERT(layer_idx < m_free_blocks.size());
         OPENVINO_ASSERT(!m_enable_prefix_caching);
         OPENVINO_ASSERT(can_allocate_blocks(1, layer_idx));
-        KVCacheBlock::Ptr allocated_block = m_free_blocks[layer_idx].front();
+        KVCacheBlock::Ptr allocated_block = _pop_free_block(layer_idx);
         allocated_block->increment();
-        m_free_blocks[layer_idx].pop_front();
-        --m_free_blocks_num[layer_idx];
         return allocated_block;
     }
 
@@ -418,21 +554,20 @@ public:
      * @return A vector of blocks (one for each layer), either freshly allocated or reused for overwriting,
      * or an empty vector if cache is exhausted.
      */
-    BlocksPerLayer allocate_block(size_t hash, std::map<uint64_t, BlocksPerLayer>& cached_blocks) {
+    template <typename CachedBlocksMap>
+    BlocksPerLayer allocate_block(size_t hash, CachedBlocksMap& cached_blocks) {
         OPENVINO_ASSERT(m_enable_prefix_caching);
         OPENVINO_ASSERT(can_allocate_blocks(1));
 
-        if (m_free_blocks_num[0] > 0) {
+        if (m_free_blocks[0].size() > 0) {
             // allocate new empty block
             BlocksPerLayer allocated_blocks;
             allocated_blocks.reserve(m_num_layers);
             for (size_t i = 0; i < m_num_layers; i++) {
-                KVCacheBlock::Ptr allocated_block = m_free_blocks[i].front();
+                KVCacheBlock::Ptr allocated_block = _pop_free_block(i);
                 allocated_block->increment();
                 allocated_block->set_hash(hash);
                 allocated_blocks.push_back(allocated_block);
-                m_free_blocks[i].pop_front();
-                --m_free_blocks_num[i];
             }
             cached_blocks[hash] = allocated_blocks;
             return allocated_blocks;
@@ -461,7 +596,8 @@ public:
      * @param cached_blocks The map of known hashes to already allocated and filled blocks.
      * @return A vector of blocks (one for each layer) corresponding to this hash, or an empty vector if the hash is not found in the map.
      */
-    BlocksPerLayer get_cached_block(size_t hash, std::map<uint64_t, BlocksPerLayer>& cached_blocks) {
+    template <typename CachedBlocksMap>
+    BlocksPerLayer get_cached_block(size_t hash, CachedBlocksMap& cached_blocks) {
         auto blocks_for_all_layers = m_overwriteable_blocks.get_block_to_restore(hash);
         if (!blocks_for_all_layers.empty()) {
             // use cached block from internal store
@@ -472,7 +608,7 @@ public:
             // use cached block from cached_blocks
             // TODO: add tokens validation in case of hash collision
             blocks_for_all_layers = it->second;
-            for (auto& block_ptr : cached_blocks[hash]) {
+            for (auto& block_ptr : it->second) {
                 block_ptr->increment();
             }
             return blocks_for_all_layers;
@@ -480,6 +616,14 @@ public:
         return {};
     }
 
+    void set_track_overwritten_blocks(bool track_overwritten_blocks) {
+        m_overwriteable_blocks.set_track_overwritten_blocks(track_overwritten_blocks);
+    }
+
+    std::vector<std::pair<size_t, std::vector<size_t>>> pop_overwritten_blocks() {
+        return m_overwriteable_blocks.pop_overwritten_blocks();
+    }
+
     /**
      * @return The percentage of the allocator's free block pool utilization.
      */
@@ -498,9 +642,9 @@ public:
 
     void clear() {
         m_total_num_blocks = 0;
-        m_free_blocks_num = std::vector<size_t>(m_num_layers, 0);
-        for (auto& per_layer_block_list : m_free_blocks) {
-            per_layer_block_list.clear();
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+            m_blocks[layer_idx].clear();
+            m_free_blocks[layer_idx].clear();
         }
         m_overwriteable_blocks.clear();
     }
@@ -519,13 +663,27 @@ class BlockManager {
     size_t m_block_size;
     size_t m_num_layers;
     // TODO: caching time can probably be improved if we use the prefix tree
-    std::map<uint64_t, BlocksPerLayer> m_prefix_hash_to_occupied_block_map;
+    std::unordered_map<uint64_t, BlocksPerLayer> m_prefix_hash_to_occupied_block_map;
 
     // stores blocks for each sequence (not sequence group)
     // the same block can be seen in multiple block_tables for different sequences
-    std::map<uint64_t, std::vector<BlocksPerLayer>> m_block_table;
+    std::unordered_map<uint64_t, std::vector<BlocksPerLayer>> m_block_table;
+
+    // sequence ID -> version of its block tables, changed each time blocks are replaced or removed from the block tables
+    std::unordered_map<uint64_t, size_t> m_block_table_versions;
+    size_t m_last_block_table_version = 0;
 
     std::mutex m_cached_blocks_map_mutex;
+
+    void _update_block_table_version(uint64_t seq_id) {
+        // versions are never reused, so that a re-created block table can't be confused with an earlier one
+        m_block_table_versions[seq_id] = ++m_last_block_table_version;
+    }
+
+    void _erase_block_table(uint64_t seq_id) {
+        OPENVINO_ASSERT(m_block_table.erase(seq_id) == 1);
+        m_block_table_versions.erase(seq_id);
+    }
 public:
     /**
      * Constructs the BlockManager.
@@ -557,6 +715,65 @@ public:
         return m_block_table.at(seq_id);
     }
 
+    /**
+     * Enables tracking of prefix cache blocks which are reused for overwriting, so that their contents can be
+     * spilled to lower prefix cache tiers before being overwritten.
+     */
+    void set_track_overwritten_blocks(bool track_overwritten_blocks) {
+        OPENVINO_ASSERT(m_enable_prefix_caching, "Overwritten blocks can only be tracked with prefix caching enabled");
+        m_allocator.set_track_overwritten_blocks(track_overwritten_blocks);
+    }
+
+    /**
+     * @return Prefix cache blocks reused for overwriting since the previous call, as pairs of the previous block hash
+     * and the block indices (one for each decoder layer).
+     */
+    std::vector<std::pair<size_t, std::vector<size_t>>> pop_overwritten_blocks() {
+        return m_allocator.pop_overwritten_blocks();
+    }
+
+    /**
+     * Gets the version of the block tables for a given sequence. The version changes each time blocks in the block tables
+     * are replaced or removed, but stays the same when new blocks are appended, so that the users keeping a copy of the
+     * block tables contents only need to copy the blocks appended at the end while the version is unchanged.
+     * @param seq_id The identifier of an ov::genai::Sequence.
+     * @return The version of the block tables, unique across all sequences tracked by this BlockManager.
+     */
+    size_t get_block_table_version(uint64_t seq_id) const {
+        return m_block_table_versions.at(seq_id);
+    }
+
+    /**
+     * Gets the physical indices of the blocks occupied by a given sequence.
+     * @param seq_id The identifier of an ov::genai::Sequence.
+     * @return A vector of physical block indices for each layer.
+     */
+    std::vector<std::vector<size_t>> get_block_indices_per_layer(uint64_t seq_id) const {
+        const auto& block_tables = m_block_table.at(seq_id);
+        std::vector<std::vector<size_t>> block_indices(block_tables.size());
+        for (size_t layer_idx = 0; layer_idx < block_tables.size(); layer_idx++) {
+            block_indices[layer_idx].reserve(block_tables[layer_idx].size());
+            for (const auto& block : block_tables[layer_idx]) {
+                block_indices[layer_idx].push_back(block->get_index());
+            }
+        }
+        return block_indices;
+    }
+
+    /**
+     * Allocates fresh blocks for a sequence whose KV cache was swapped out to host memory on preemption,
+     * so that the swapped out content can be copied into them.
+     * @param sequence The sequence to be restored. It must not have any blocks allocated.
+     * @param num_blocks The number of blocks the sequence occupied before being swapped out.
+     * @param prompt_size Prompt size for this sequence.
+     * @return A vector of physical indices of the allocated blocks for each layer, in logical block order.
+     */
+    std::vector<std::vector<size_t>> restore_swapped_sequence(ov::genai::Sequence::Ptr sequence, size_t num_blocks, size_t prompt_size) {
+        OPENVINO_ASSERT(!has_block_table(sequence->get_id()), "Sequence ", sequence->get_id(), " to be swapped in already has blocks allocated");
+        allocate(sequence, num_blocks, prompt_size);
+        return get_block_indices_per_layer(sequence->get_id());
+    }
+
     /**
      * Gets the block table for a given sequence and given layer.
      * @param seq_id The identifier of an ov::genai::Sequence.
@@ -623,8 +840,10 @@ public:
         }
 
         if (block_table[0].size() == 0) {
-            OPENVINO_ASSERT(m_block_table.erase(seq_id) == 1);
-         }
+            _erase_block_table(seq_id);
+        } else {
+            _update_block_table_version(seq_id);
+        }
         return blocks_to_free[0]->is_free();
     }
 
@@ -654,10 +873,11 @@ public:
         std::set<size_t> indices;
         for (size_t idx = 0; idx < running_sequences.size(); ++idx) {
             auto seq_id = running_sequences[idx]->get_id();
-            if (m_block_table.count(seq_id) == 0) {
+            auto it = m_block_table.find(seq_id);
+            if (it == m_block_table.end()) {
                 continue;
             }
-            auto block_table = m_block_table[seq_id][0];  // assuming all layers always have equal sets of blocks
+            const auto& block_table = it->second[0];  // assuming all layers always have equal sets of blocks
             for (const auto& block : block_table) {
                 indices.insert(block->get_index());
             }
@@ -704,6 +924,7 @@ public:
         auto sequence_id = sequence->get_id();
         if (m_block_table.find(sequence_id) == m_block_table.end()) {
             m_block_table[sequence_id].resize(m_num_layers);
+            _update_block_table_version(sequence_id);
         }
 
         auto& block_table = m_block_table[sequence_id][0];
@@ -788,6 +1009,7 @@ public:
         std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
         OPENVINO_ASSERT(m_block_table.count(child_id) == 0);
         m_block_table[child_id].resize(m_num_layers);
+        _update_block_table_version(child_id);
         for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
             m_block_table[child_id][layer_idx].reserve(m_block_table[parent_id][layer_idx].size());
             for (KVCacheBlock::Ptr &block: m_block_table[parent_id][layer_idx]) {
@@ -817,7 +1039,7 @@ public:
             m_allocator.free(blocks_to_free);
         }
 
-        OPENVINO_ASSERT(m_block_table.erase(seq_id) == 1);
+        _erase_block_table(seq_id);
     }
 
     /**
@@ -857,7 +1079,9 @@ public:
             // The invariant must hold at BlockManager level that all per-layer block tables
             // must have the same size
             OPENVINO_ASSERT(all_freed_completely, "block tables across layers should only be empty all at once");
-            OPENVINO_ASSERT(m_block_table.erase(seq_id) == 1);
+            _erase_block_table(seq_id);
+        } else {
+            _update_block_table_version(seq_id);
         }
     }
 
@@ -922,6 +1146,7 @@ public:
 
             per_layer_block_table = new_sequence_blocks;
         }
+        _update_block_table_version(seq_id);
     }
 
     /**
@@ -941,16 +1166,19 @@ public:
         std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
         std::vector<Sequence::CPtr> running_sequences = seq_group->get_running_sequences();
         size_t blocks_count = 0; // total number of needed blocks for sequence group
-        std::set<size_t> last_block_ids; // unique last block indices
+        // unique last block indices, the number of running sequences is small, so a linear search is the cheapest
+        std::vector<int> last_block_ids;
+        last_block_ids.reserve(running_sequences.size());
 
-        for (auto seq: running_sequences) {
+        for (const auto& seq: running_sequences) {
             auto seq_id = seq->get_id();
-            if (m_block_table.find(seq_id) == m_block_table.end()) {
+            auto block_table_it = m_block_table.find(seq_id);
+            if (block_table_it == m_block_table.end()) {
                 // the block table is empty, so we need to allocate the number of blocks equal to number of logical blocks
                 blocks_count += seq_group->get_num_logical_blocks();
                 continue;
             }
-            auto& block_table = m_block_table[seq_id][0];
+            const auto& block_table = block_table_it->second[0];
             size_t num_physical_blocks = block_table.size();
             OPENVINO_ASSERT(num_physical_blocks > 0);
 
@@ -961,16 +1189,16 @@ public:
                 // iteration
                 continue;
 
-            size_t last_block_id = block_table.back()->get_index();
+            const KVCacheBlock::Ptr& last_block = block_table.back();
+            int last_block_id = last_block->get_index();
 
-            if (last_block_ids.find(last_block_id) != last_block_ids.end())
+            if (std::find(last_block_ids.begin(), last_block_ids.end(), last_block_id) != last_block_ids.end())
                 // this block was already processed
                 continue;
-            last_block_ids.insert(last_block_id);
+            last_block_ids.push_back(last_block_id);
 
             size_t needed_blocks_per_sequence = seq_group->get_num_logical_blocks() - num_physical_blocks;
 
-            KVCacheBlock::Ptr last_block = block_table.back();
             if (last_block->copy_on_write()) {
                 // block is used only by multiple sequences
                 auto references_count = last_block->get_references_count();
@@ -1033,9 +1261,10 @@ public:
             auto seq_id = sequence->get_id();
             size_t num_physical_blocks = 0;
 
-            if (m_block_table.find(seq_id) != m_block_table.end())
+            auto block_table_it = m_block_table.find(seq_id);
+            if (block_table_it != m_block_table.end())
             {
-                num_physical_blocks = m_block_table[seq_id][0].size();
+                num_physical_blocks = block_table_it->second[0].size();
             }
 
             if (num_logical_blocks > num_physical_blocks) {
@@ -1044,11 +1273,12 @@ public:
             } else {
                 OPENVINO_ASSERT(num_logical_blocks == num_physical_blocks, "A number of physical and logic blocks must be the same in this code path");
 
-                size_t effective_num_layers = m_block_table[seq_id].size();
+                auto& seq_block_tables = block_table_it->second;
+                size_t effective_num_layers = seq_block_tables.size();
                 BlocksPerLayer last_blocks;
-                last_blocks.reserve(m_block_table[seq_id].size());
+                last_blocks.reserve(effective_num_layers);
                 for (size_t i = 0; i < effective_num_layers; i++) {
-                    last_blocks.push_back(m_block_table[seq_id][i].back());
+                    last_blocks.push_back(seq_block_tables[i].back());
                 }
 
                 bool is_copy_on_write = last_blocks[0]->copy_on_write();
@@ -1067,12 +1297,13 @@ public:
 
                     for (size_t i = 0; i < effective_num_layers; i++) {
                         auto& new_block = new_blocks_for_all_layers[i];
-                        auto& block_table = m_block_table[seq_id][i];
+                        auto& block_table = seq_block_tables[i];
                         block_table[num_physical_blocks - 1] = new_blocks_for_all_layers[i];
                         auto& last_block = last_blocks[i];
                         copy_blocks_map[last_block->get_index()].push_back(new_block->get_index());
                     }
                     m_allocator.free(last_blocks);
+                    _update_block_table_version(seq_id);
                 } else {
                     // we are the only users of this block
                     if (m_enable_prefix_caching) {
@@ -1106,6 +1337,7 @@ public:
 
         if (m_block_table.find(seq_id) == m_block_table.end()) {
             m_block_table[seq_id].resize(m_num_layers);
+            _update_block_table_version(seq_id);
         }
         auto& block_table = m_block_table[seq_id];
 
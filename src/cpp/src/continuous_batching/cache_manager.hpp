@@ -3,10 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 #include <list>
+#include <map>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "continuous_batching/reserved_host_memory.hpp"
 #include "utils.hpp"
 namespace ov::genai {
 
@@ -17,15 +21,129 @@ class CacheManager {
     std::vector<ov::element::Type> m_key_precisions, m_value_precisions;
     std::vector<ov::PartialShape> m_key_shapes, m_value_shapes;
     std::vector<ov::Tensor> m_key_cache, m_value_cache;
+    // address space reserved for host cache tensors of each decoder layer, the tensors are placed at its beginning
+    std::vector<std::shared_ptr<ReservedHostMemory>> m_key_memory, m_value_memory;
+    // limits address space reserved for host KV cache, when the system memory size is unknown or larger
+    static constexpr size_t MAX_HOST_CACHE_RESERVATION_IN_BYTES = size_t(1) << 40;
     size_t m_num_allocated_kv_blocks = 0, m_block_size_in_bytes = 0;
     ov::InferRequest m_request;
     ov::RemoteContext m_context;
 
+    // Host swap pool: KV cache blocks of preempted sequences, per sequence and per decoder layer
+    struct SwappedBlocks {
+        std::vector<ov::Tensor> m_key_blocks, m_value_blocks;
+        size_t m_num_blocks = 0;
+        size_t m_size_in_bytes = 0;
+    };
+    std::map<uint64_t, SwappedBlocks> m_swapped_blocks;
+    size_t m_swap_space_in_bytes = 0, m_used_swap_space_in_bytes = 0;
+
     static ov::Shape set_kv_blocks(ov::PartialShape pshape, size_t num_kv_blocks) {
         pshape[0] = num_kv_blocks;
         return pshape.get_shape();
     }
 
+    // computed from the shape of a block, so that it's known for caches without blocks as well
+    static size_t get_block_size_in_bytes(ov::element::Type precision, const ov::Shape& cache_shape) {
+        OPENVINO_ASSERT(!cache_shape.empty(), "KV cache shape must have the blocks dimension");
+        const size_t block_num_elements = ov::shape_size(cache_shape.begin() + 1, cache_shape.end());
+        // works for sub-byte precisions as well, since a block has an even number of elements
+        return (block_num_elements * precision.bitwidth() + 7) / 8;
+    }
+
+    static size_t get_cache_block_size_in_bytes(const ov::Tensor& cache) {
+        return get_block_size_in_bytes(cache.get_element_type(), cache.get_shape());
+    }
+
+    // copies blocks with given indices between a cache tensor and a dense host tensor with blocks placed one after another
+    static void copy_cache_blocks(const ov::Tensor& cache, const ov::Tensor& host_blocks, const std::vector<size_t>& block_ids,
+                                  size_t block_size_in_bytes, bool to_host) {
+        OPENVINO_SUPPRESS_DEPRECATED_START
+        uint8_t* cache_ptr = reinterpret_cast<uint8_t*>(cache.data());
+        uint8_t* host_ptr = reinterpret_cast<uint8_t*>(host_blocks.data());
+        OPENVINO_SUPPRESS_DEPRECATED_END
+        for (size_t i = 0; i < block_ids.size(); ++i) {
+            uint8_t* cache_block_ptr = cache_ptr + block_ids[i] * block_size_in_bytes;
+            uint8_t* host_block_ptr = host_ptr + i * block_size_in_bytes;
+            if (to_host) {
+                std::memcpy(host_block_ptr, cache_block_ptr, block_size_in_bytes);
+            } else {
+                std::memcpy(cache_block_ptr, host_block_ptr, block_size_in_bytes);
+            }
+        }
+    }
+
+    // places a tensor in the committed part of reserved memory, which is kept alive while the tensor is used
+    struct ReservedMemoryAllocator {
+        std::shared_ptr<ReservedHostMemory> memory;
+
+        void* allocate(const size_t bytes, const size_t /*alignment*/) {
+            OPENVINO_ASSERT(bytes <= memory->get_committed_size(), "Tensor doesn't fit committed memory");
+            return memory->data();
+        }
+
+        void deallocate(void* /*handle*/, const size_t /*bytes*/, const size_t /*alignment*/) {}
+
+        bool is_equal(const ReservedMemoryAllocator& other) const {
+            return memory == other.memory;
+        }
+    };
+
+    /**
+     * Grows a host cache tensor to a given shape keeping its contents. The tensor is placed in reserved address space,
+     * which is sized for the KV cache to take the whole system memory, so the tensor is moved (and copied) only if
+     * it outgrows the reservation.
+     * @param memory Reserved memory of the cache tensor, replaced with a larger reservation if needed.
+     * @param cache Current cache tensor, may be empty.
+     * @return Cache tensor of the new shape.
+     */
+    ov::Tensor grow_host_cache(std::shared_ptr<ReservedHostMemory>& memory, const ov::Tensor& cache,
+                               ov::element::Type precision, const ov::Shape& shape) {
+        const size_t num_kv_blocks = shape[0];
+        const size_t block_byte_size = get_block_size_in_bytes(precision, shape);
+        const size_t byte_size = block_byte_size * num_kv_blocks;
+        if (!memory || !memory->commit(byte_size)) {
+            const size_t max_cache_size = std::min(utils::get_available_cpu_memory(), MAX_HOST_CACHE_RESERVATION_IN_BYTES);
+            const size_t max_num_kv_blocks = std::max({size_t(1), 2 * num_kv_blocks, max_cache_size / m_block_size_in_bytes});
+            auto new_memory = std::make_shared<ReservedHostMemory>(block_byte_size * max_num_kv_blocks);
+            new_memory->commit(byte_size);
+            if (cache) {
+                std::memcpy(new_memory->data(), cache.data(), cache.get_byte_size());
+            }
+            memory = new_memory;
+        }
+        return ov::Tensor(precision, shape, ov::Allocator(ReservedMemoryAllocator{memory}));
+    }
+
+    // copies blocks of device KV cache tensors by ROI copies, which are executed by the device
+    size_t copy_remote_blocks(const std::map<size_t, std::list<size_t>>& block_copy_map) {
+        size_t copied_bytes = 0;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            for (const ov::Tensor& cache : {m_key_cache[decoder_layer_id], m_value_cache[decoder_layer_id]}) {
+                const auto precision = cache.get_element_type();
+                if (precision == ov::element::u4 || precision == ov::element::i4) {
+                    // ROIs of sub-byte precision tensors are not supported
+                    continue;
+                }
+                ov::Shape shape = cache.get_shape();
+                const size_t cache_block_size = get_cache_block_size_in_bytes(cache);
+                for (const auto& [src_block_id, dst_block_ids] : block_copy_map) {
+                    ov::Coordinate src_start_roi(shape.size(), 0), src_end_roi = shape;
+                    src_end_roi[0] = (src_start_roi[0] = src_block_id) + 1;
+                    ov::Tensor src_cache_roi(cache, src_start_roi, src_end_roi);
+                    for (size_t dst_block_id : dst_block_ids) {
+                        ov::Coordinate dst_start_roi(shape.size(), 0), dst_end_roi = shape;
+                        dst_end_roi[0] = (dst_start_roi[0] = dst_block_id) + 1;
+                        ov::Tensor dst_cache_roi(cache, dst_start_roi, dst_end_roi);
+                        src_cache_roi.copy_to(dst_cache_roi);
+                        copied_bytes += cache_block_size;
+                    }
+                }
+            }
+        }
+        return copied_bytes;
+    }
+
     void update_request_tensor(size_t decoder_layer_id) {
         m_request.set_tensor(std::string("key_cache.") + std::to_string(decoder_layer_id), m_key_cache[decoder_layer_id]);
         m_request.set_tensor(std::string("value_cache.") + std::to_string(decoder_layer_id), m_value_cache[decoder_layer_id]);
@@ -113,6 +231,10 @@ public:
         return m_value_precisions[decoder_layer_id];
     }
 
+    size_t get_num_allocated_kv_blocks() const {
+        return m_num_allocated_kv_blocks;
+    }
+
     size_t get_block_size_in_bytes() const {
         return m_block_size_in_bytes;
     }
@@ -164,61 +286,29 @@ public:
                     update_request_tensor(decoder_layer_id);
                 }
             } else {
+                // host caches grow in place within reserved address space, so that existing blocks are not copied
+                if (m_key_memory.size() < m_num_decoder_layers) {
+                    m_key_memory.resize(m_num_decoder_layers);
+                    m_value_memory.resize(m_num_decoder_layers);
+                    m_key_cache.resize(m_num_decoder_layers);
+                    m_value_cache.resize(m_num_decoder_layers);
+                }
                 for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
                     ov::Shape value_cache_shape = set_kv_blocks(m_value_shapes[decoder_layer_id], num_kv_blocks);
                     ov::Shape key_cache_shape = set_kv_blocks(m_key_shapes[decoder_layer_id], num_kv_blocks);
 
-                    ov::element::Type key_precision = get_key_cache_precision(decoder_layer_id);
-                    ov::element::Type value_precision = get_value_cache_precision(decoder_layer_id);
-
-                    ov::Tensor key_cache(key_precision, key_cache_shape);
-                    ov::Tensor value_cache(value_precision, value_cache_shape);
-
-                    auto key_cache_roi_end = static_cast<unsigned char*>(key_cache.data());
-                    auto value_cache_roi_end = static_cast<unsigned char*>(value_cache.data());
-                    size_t key_roi_size_byte = 0;
-                    size_t value_roi_size_byte = 0;
-
-                    if (m_key_cache.size() > decoder_layer_id && m_key_cache[decoder_layer_id]) {
-                        ov::Coordinate end_key = m_key_cache[decoder_layer_id].get_shape();
-                        ov::Coordinate end_value = m_value_cache[decoder_layer_id].get_shape();
-                        // copy current cache data
-                        if (key_precision == ov::element::u4) {
-                            size_t key_stride = std::accumulate(end_key.begin(), end_key.end(), 1, std::multiplies<size_t>());
-                            size_t key_roi_size_byte = key_stride + (key_stride & 1) / sub_byte_data_type_multiplier(key_precision);
-                            std::memcpy(reinterpret_cast<uint8_t*>(key_cache.data()), reinterpret_cast<uint8_t*>(m_key_cache[decoder_layer_id].data()), key_roi_size_byte);
-                        } else {
-                            key_roi_size_byte = m_key_cache[decoder_layer_id].get_byte_size();
-                            ov::Tensor dst_key_roi(key_cache, start_key, end_key);
-                            key_cache_roi_end = static_cast<unsigned char*>(key_cache.data()) + key_roi_size_byte;
-                            m_key_cache[decoder_layer_id].copy_to(dst_key_roi);
-                        }
-
-                        if (value_precision == ov::element::u4) {
-                            size_t value_stride = std::accumulate(end_value.begin(), end_value.end(), 1, std::multiplies<size_t>());
-                            size_t value_roi_size_byte = value_stride + (value_stride & 1) / sub_byte_data_type_multiplier(value_precision);
-                            std::memcpy(reinterpret_cast<uint8_t*>(value_cache.data()), reinterpret_cast<uint8_t*>(m_value_cache[decoder_layer_id].data()), value_roi_size_byte);
-                        } else {
-                            value_roi_size_byte = m_value_cache[decoder_layer_id].get_byte_size();
-                            value_cache_roi_end = static_cast<unsigned char*>(value_cache.data()) + value_roi_size_byte;
-                            ov::Tensor dst_value_roi(value_cache, start_value, end_value);
-                            m_value_cache[decoder_layer_id].copy_to(dst_value_roi);
-                        }
-                    }
-
-                    // set new cache tensors
-                    if (m_key_cache.size() > decoder_layer_id) {
-                        m_key_cache[decoder_layer_id] = key_cache;
-                        m_value_cache[decoder_layer_id] = value_cache;
-                    } else {
-                        m_key_cache.emplace_back(key_cache);
-                        m_value_cache.emplace_back(value_cache);
-                    }
+                    m_key_cache[decoder_layer_id] = grow_host_cache(m_key_memory[decoder_layer_id], m_key_cache[decoder_layer_id],
+                                                                    get_key_cache_precision(decoder_layer_id), key_cache_shape);
+                    m_value_cache[decoder_layer_id] = grow_host_cache(m_value_memory[decoder_layer_id], m_value_cache[decoder_layer_id],
+                                                                      get_value_cache_precision(decoder_layer_id), value_cache_shape);
 
                     update_request_tensor(decoder_layer_id);
                 }
             }
         }
+        catch (const std::bad_alloc&) {
+            OPENVINO_THROW("Requested KV-cache size is larger than available memory size on the system.");
+        }
         catch (ov::Exception& e) {
             if (std::string(e.what()).find("bad allocation") != std::string::npos) {
                 OPENVINO_THROW("Requested KV-cache size is larger than available memory size on the system.");
@@ -242,71 +332,222 @@ public:
         return m_value_shapes[layer_id][3].get_length();
     }
 
-    void copy_blocks(const std::map<size_t, std::list<size_t>>& block_copy_map) {
-        for (const auto & blocks_pair : block_copy_map) {
-            size_t src_block_id = blocks_pair.first;
-            const std::list<size_t>& dst_block_ids = blocks_pair.second;
-            for (size_t dst_block_id : dst_block_ids) {
-                for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
-                    ov::Shape key_shape = set_kv_blocks(m_key_shapes[decoder_layer_id], m_num_allocated_kv_blocks);
-                    ov::Shape value_shape = set_kv_blocks(m_value_shapes[decoder_layer_id], m_num_allocated_kv_blocks);
-                    ov::Coordinate key_src_start_roi(key_shape.size(), 0);
-                    ov::Coordinate key_src_end_roi = key_shape;
-                    ov::Coordinate key_dst_start_roi(key_shape.size(), 0);
-                    ov::Coordinate key_dst_end_roi = key_shape;
-
-                    ov::Coordinate value_src_start_roi(value_shape.size(), 0);
-                    ov::Coordinate value_src_end_roi = value_shape;
-                    ov::Coordinate value_dst_start_roi(value_shape.size(), 0);
-                    ov::Coordinate value_dst_end_roi = value_shape;
-                    key_src_end_roi[0] = (key_src_start_roi[0] = src_block_id) + 1;
-                    value_src_end_roi[0] = (value_src_start_roi[0] = src_block_id) + 1;
-                    key_dst_end_roi[0] = (key_dst_start_roi[0] = dst_block_id) + 1;
-                    value_dst_end_roi[0] = (value_dst_start_roi[0] = dst_block_id) + 1;
-
-                    auto copy_one_block = [&](ov::Tensor& dst, const ov::Tensor& src, size_t src_start, size_t dst_start, size_t stride) {
-                        const bool is_remote = dst.is<ov::RemoteTensor>() || src.is<ov::RemoteTensor>();
-                        if (is_remote) {
-                            return;
-                        }
-                        auto sub_byte_multipyer = sub_byte_data_type_multiplier(dst.get_element_type());
-                        OPENVINO_SUPPRESS_DEPRECATED_START
-                        const uint8_t* src_ptr = reinterpret_cast<const uint8_t*>(src.data()) + src_start * stride;
-                        uint8_t* dst_ptr = reinterpret_cast<uint8_t*>(dst.data()) + dst_start * stride;
-                        OPENVINO_SUPPRESS_DEPRECATED_END
-                        std::memcpy(dst_ptr, src_ptr, 1 * stride);
-                    };
-
-                    const auto& key_cache_prec = m_key_cache[decoder_layer_id].get_element_type();
-                    if (key_cache_prec == ov::element::u4 || key_cache_prec == ov::element::i4) {
-                        size_t stride = std::accumulate(std::next(key_shape.begin()), key_shape.end(), 1, std::multiplies<size_t>()) / 2;
-                        copy_one_block(m_key_cache[decoder_layer_id], m_key_cache[decoder_layer_id], key_src_start_roi[0], key_dst_start_roi[0], stride);
-                    } else {
-                        ov::Tensor key_src_cache_roi(m_key_cache[decoder_layer_id], key_src_start_roi, key_src_end_roi);
-                        ov::Tensor key_dst_cache_roi(m_key_cache[decoder_layer_id], key_dst_start_roi, key_dst_end_roi);
-                        key_src_cache_roi.copy_to(key_dst_cache_roi);
-                    }
+    /**
+     * Copies KV cache blocks to other blocks for all decoder layers, e.g. for copy-on-write of forked sequences.
+     * @param block_copy_map Destination blocks for each source block.
+     * @return Total size of the copied data in bytes.
+     */
+    size_t copy_blocks(const std::map<size_t, std::list<size_t>>& block_copy_map) {
+        if (block_copy_map.empty()) {
+            return 0;
+        }
+        if (!is_host_cache()) {
+            return copy_remote_blocks(block_copy_map);
+        }
 
-                    const auto& value_cache_prec = m_value_cache[decoder_layer_id].get_element_type();
-                    if (value_cache_prec == ov::element::u4 || value_cache_prec == ov::element::i4) {
-                        size_t stride = std::accumulate(std::next(value_shape.begin()), value_shape.end(), 1, std::multiplies<size_t>()) / 2;
-                        copy_one_block(m_value_cache[decoder_layer_id], m_value_cache[decoder_layer_id], value_src_start_roi[0], value_dst_start_roi[0], stride);
-                    } else {
-                        ov::Tensor value_src_cache_roi(m_value_cache[decoder_layer_id], value_src_start_roi, value_src_end_roi);
-                        ov::Tensor value_dst_cache_roi(m_value_cache[decoder_layer_id], value_dst_start_roi, value_dst_end_roi);
-                        value_src_cache_roi.copy_to(value_dst_cache_roi);
+        // all the block copies of all decoder layers form a single list of independent copies executed in parallel
+        struct BlockCopy {
+            const uint8_t* src;
+            uint8_t* dst;
+            size_t size;
+        };
+        std::vector<BlockCopy> block_copies;
+        size_t num_block_pairs = 0;
+        for (const auto& [src_block_id, dst_block_ids] : block_copy_map) {
+            num_block_pairs += dst_block_ids.size();
+        }
+        block_copies.reserve(2 * m_num_decoder_layers * num_block_pairs);
+
+        size_t copied_bytes = 0;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            for (const ov::Tensor& cache : {m_key_cache[decoder_layer_id], m_value_cache[decoder_layer_id]}) {
+                const size_t cache_block_size = get_cache_block_size_in_bytes(cache);
+                OPENVINO_SUPPRESS_DEPRECATED_START
+                uint8_t* cache_ptr = static_cast<uint8_t*>(cache.data());
+                OPENVINO_SUPPRESS_DEPRECATED_END
+                for (const auto& [src_block_id, dst_block_ids] : block_copy_map) {
+                    for (size_t dst_block_id : dst_block_ids) {
+                        block_copies.push_back({cache_ptr + src_block_id * cache_block_size, cache_ptr + dst_block_id * cache_block_size, cache_block_size});
                     }
                 }
+                copied_bytes += cache_block_size * num_block_pairs;
+            }
+        }
+
+        ov::parallel_for(block_copies.size(), [&](size_t i) {
+            std::memcpy(block_copies[i].dst, block_copies[i].src, block_copies[i].size);
+        });
+        return copied_bytes;
+    }
+
+    /**
+     * @return Whether KV cache tensors are placed in host memory, so that their blocks can be directly read and written.
+     */
+    bool is_host_cache() const {
+        return !m_context;
+    }
+
+    /**
+     * @return Size of the contents of a single KV cache block for all decoder layers, as read by read_block.
+     */
+    size_t get_block_data_size_in_bytes() const {
+        size_t block_data_size = 0;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            block_data_size += get_block_size_in_bytes(get_key_cache_precision(decoder_layer_id),
+                                                       set_kv_blocks(m_key_shapes[decoder_layer_id], 1));
+            block_data_size += get_block_size_in_bytes(get_value_cache_precision(decoder_layer_id),
+                                                       set_kv_blocks(m_value_shapes[decoder_layer_id], 1));
+        }
+        return block_data_size;
+    }
+
+    /**
+     * Reads the contents of a KV cache block for all decoder layers into a contiguous buffer.
+     * @param block_ids_per_layer Physical index of the block for each decoder layer.
+     * @param data Buffer to read the block contents into, resized as needed.
+     */
+    void read_block(const std::vector<size_t>& block_ids_per_layer, std::vector<uint8_t>& data) const {
+        OPENVINO_ASSERT(is_host_cache(), "Reading KV cache blocks is supported for host memory KV cache only");
+        OPENVINO_ASSERT(block_ids_per_layer.size() == m_num_decoder_layers, "Block index is expected for each decoder layer");
+        data.resize(get_block_data_size_in_bytes());
+        size_t offset = 0;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            for (const ov::Tensor& cache : {m_key_cache[decoder_layer_id], m_value_cache[decoder_layer_id]}) {
+                size_t cache_block_size = get_cache_block_size_in_bytes(cache);
+                ov::Tensor block_data(ov::element::u8, {cache_block_size}, data.data() + offset);
+                copy_cache_blocks(cache, block_data, {block_ids_per_layer[decoder_layer_id]}, cache_block_size, true);
+                offset += cache_block_size;
             }
         }
     }
 
+    /**
+     * Writes the contents of a KV cache block for all decoder layers, previously obtained by read_block.
+     * @param block_ids_per_layer Physical index of the block for each decoder layer.
+     * @param data Block contents.
+     */
+    void write_block(const std::vector<size_t>& block_ids_per_layer, const std::vector<uint8_t>& data) {
+        OPENVINO_ASSERT(is_host_cache(), "Writing KV cache blocks is supported for host memory KV cache only");
+        OPENVINO_ASSERT(block_ids_per_layer.size() == m_num_decoder_layers, "Block index is expected for each decoder layer");
+        OPENVINO_ASSERT(data.size() == get_block_data_size_in_bytes(), "Unexpected size of KV cache block contents");
+        size_t offset = 0;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            for (const ov::Tensor& cache : {m_key_cache[decoder_layer_id], m_value_cache[decoder_layer_id]}) {
+                size_t cache_block_size = get_cache_block_size_in_bytes(cache);
+                ov::Tensor block_data(ov::element::u8, {cache_block_size}, const_cast<uint8_t*>(data.data()) + offset);
+                copy_cache_blocks(cache, block_data, {block_ids_per_layer[decoder_layer_id]}, cache_block_size, false);
+                offset += cache_block_size;
+            }
+        }
+    }
+
+    /**
+     * Sets the size of the host swap pool which keeps KV cache blocks of sequences preempted by swapping.
+     * @param swap_space_in_bytes Max size of the pool, 0 disables swapping.
+     */
+    void set_swap_space(size_t swap_space_in_bytes) {
+        m_swap_space_in_bytes = swap_space_in_bytes;
+    }
+
+    /**
+     * @return Whether KV cache blocks of a sequence can be swapped out to the host swap pool.
+     * @param num_blocks Number of blocks per decoder layer occupied by the sequence.
+     */
+    bool can_swap_out(size_t num_blocks) const {
+        // swapping is implemented for host memory KV cache only
+        if (!is_host_cache() || m_num_allocated_kv_blocks == 0 || num_blocks == 0)
+            return false;
+        return m_used_swap_space_in_bytes + num_blocks * m_block_size_in_bytes <= m_swap_space_in_bytes;
+    }
+
+    /**
+     * Copies KV cache blocks of a sequence to the host swap pool. The blocks can be freed afterwards.
+     * @param seq_id Sequence ID.
+     * @param block_ids_per_layer Physical block indices occupied by the sequence, for each decoder layer.
+     */
+    void swap_out(uint64_t seq_id, const std::vector<std::vector<size_t>>& block_ids_per_layer) {
+        OPENVINO_ASSERT(block_ids_per_layer.size() == m_num_decoder_layers, "Block indices are expected for each decoder layer");
+        OPENVINO_ASSERT(m_swapped_blocks.find(seq_id) == m_swapped_blocks.end(), "Sequence ", seq_id, " is already swapped out");
+        OPENVINO_ASSERT(can_swap_out(block_ids_per_layer[0].size()), "Not enough swap space to swap out sequence ", seq_id);
+
+        SwappedBlocks& swapped = m_swapped_blocks[seq_id];
+        swapped.m_num_blocks = block_ids_per_layer[0].size();
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            const auto& block_ids = block_ids_per_layer[decoder_layer_id];
+            OPENVINO_ASSERT(block_ids.size() == swapped.m_num_blocks, "All decoder layers are expected to have the same number of blocks");
+
+            size_t key_block_size = get_cache_block_size_in_bytes(m_key_cache[decoder_layer_id]);
+            size_t value_block_size = get_cache_block_size_in_bytes(m_value_cache[decoder_layer_id]);
+            ov::Tensor key_blocks(ov::element::u8, {swapped.m_num_blocks * key_block_size});
+            ov::Tensor value_blocks(ov::element::u8, {swapped.m_num_blocks * value_block_size});
+            copy_cache_blocks(m_key_cache[decoder_layer_id], key_blocks, block_ids, key_block_size, true);
+            copy_cache_blocks(m_value_cache[decoder_layer_id], value_blocks, block_ids, value_block_size, true);
+
+            swapped.m_key_blocks.push_back(key_blocks);
+            swapped.m_value_blocks.push_back(value_blocks);
+        }
+        swapped.m_size_in_bytes = swapped.m_num_blocks * m_block_size_in_bytes;
+        m_used_swap_space_in_bytes += swapped.m_size_in_bytes;
+    }
+
+    /**
+     * Copies previously swapped out KV cache blocks of a sequence to the given blocks and releases its swap space.
+     * @param seq_id Sequence ID.
+     * @param block_ids_per_layer Physical block indices newly allocated for the sequence, for each decoder layer.
+     */
+    void swap_in(uint64_t seq_id, const std::vector<std::vector<size_t>>& block_ids_per_layer) {
+        auto it = m_swapped_blocks.find(seq_id);
+        OPENVINO_ASSERT(it != m_swapped_blocks.end(), "Sequence ", seq_id, " is not swapped out");
+        OPENVINO_ASSERT(block_ids_per_layer.size() == m_num_decoder_layers, "Block indices are expected for each decoder layer");
+        const SwappedBlocks& swapped = it->second;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            const auto& block_ids = block_ids_per_layer[decoder_layer_id];
+            OPENVINO_ASSERT(block_ids.size() == swapped.m_num_blocks, "Sequence ", seq_id, " is swapped out with ", swapped.m_num_blocks,
+                            " blocks, but ", block_ids.size(), " blocks are provided to swap it in");
+
+            size_t key_block_size = get_cache_block_size_in_bytes(m_key_cache[decoder_layer_id]);
+            size_t value_block_size = get_cache_block_size_in_bytes(m_value_cache[decoder_layer_id]);
+            copy_cache_blocks(m_key_cache[decoder_layer_id], swapped.m_key_blocks[decoder_layer_id], block_ids, key_block_size, false);
+            copy_cache_blocks(m_value_cache[decoder_layer_id], swapped.m_value_blocks[decoder_layer_id], block_ids, value_block_size, false);
+        }
+        release_swapped_blocks(seq_id);
+    }
+
+    /**
+     * Drops swapped out KV cache blocks of a sequence, e.g. when its request is cancelled.
+     */
+    void release_swapped_blocks(uint64_t seq_id) {
+        auto it = m_swapped_blocks.find(seq_id);
+        if (it == m_swapped_blocks.end())
+            return;
+        m_used_swap_space_in_bytes -= it->second.m_size_in_bytes;
+        m_swapped_blocks.erase(it);
+    }
+
+    bool is_swapped_out(uint64_t seq_id) const {
+        return m_swapped_blocks.find(seq_id) != m_swapped_blocks.end();
+    }
+
+    size_t get_num_swapped_blocks(uint64_t seq_id) const {
+        auto it = m_swapped_blocks.find(seq_id);
+        OPENVINO_ASSERT(it != m_swapped_blocks.end(), "Sequence ", seq_id, " is not swapped out");
+        return it->second.m_num_blocks;
+    }
+
+    size_t get_used_swap_space() const {
+        return m_used_swap_space_in_bytes;
+    }
+
     void clear() {
         for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
             m_key_cache[decoder_layer_id] = ov::Tensor();
             m_value_cache[decoder_layer_id] = ov::Tensor();
         }
+        m_key_memory.clear();
+        m_value_memory.clear();
         m_num_allocated_kv_blocks = 0;
+        m_swapped_blocks.clear();
+        m_used_swap_space_in_bytes = 0;
     }
 };
 
@@ -5,6 +5,7 @@
 
 #include <string>
 #include <filesystem>
+#include <map>
 #include <vector>
 
 #include "continuous_batching/block_manager.hpp"
@@ -57,7 +58,9 @@ public:
                 }
                 out_stream << std::endl;
             }
-            for (const auto &seq_id_and_blocks: block_mgr->m_block_table) {
+            // block tables are kept in a hash map, ordered by sequence ID to keep the dumps comparable
+            std::map<uint64_t, std::vector<BlocksPerLayer>> ordered_block_table(block_mgr->m_block_table.begin(), block_mgr->m_block_table.end());
+            for (const auto &seq_id_and_blocks: ordered_block_table) {
                 for (const auto &block: seq_id_and_blocks.second[layer_idx]) {
                     const size_t seq_id = seq_id_and_blocks.first;
                     out_stream << seq_id << " " << block->get_index() << " " << block->get_references_count()
@@ -214,6 +214,15 @@ class ModelRunner {
     std::vector<ov::Tensor> m_cache_rotation_deltas_for_each_layer;
     ov::Tensor m_cache_rotation_trig_lut;
 
+    struct SequenceBlockIndices {
+        // version of the block tables the indices were taken from, see BlockManager::get_block_table_version
+        size_t version = 0;
+        std::vector<std::vector<int32_t>> per_layer;
+    };
+    // sequence ID -> physical KV cache block indices of the sequence, kept between the steps while the sequence is scheduled,
+    // so that the block tables are not traversed for each layer and sequence on each step
+    std::unordered_map<uint64_t, SequenceBlockIndices> m_block_indices_per_sequence;
+
     bool m_is_aggregate_attention_scores;
 
     bool m_is_use_xattention_inputs;
@@ -962,69 +971,92 @@ private:
         return cached_tensor;
     }
 
-    // Fills indices for sequences in the order defined by scheduler_output
+    // Brings the physical block indices kept for each scheduled sequence in line with the scheduler output. While the version
+    // of the sequence block tables is unchanged, only the blocks appended since the previous step are read from the block tables.
+    void _update_block_indices_per_sequence(const Scheduler::Output& scheduler_output, size_t num_layers) {
+        for (auto it = m_block_indices_per_sequence.begin(); it != m_block_indices_per_sequence.end();) {
+            if (scheduler_output.m_block_tables.find(it->first) == scheduler_output.m_block_tables.end()) {
+                it = m_block_indices_per_sequence.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        for (const auto& [seq_id, kv_blocks_ptr] : scheduler_output.m_block_tables) {
+            const auto& kv_blocks = *kv_blocks_ptr;
+            OPENVINO_ASSERT(kv_blocks.size() >= num_layers);
+            auto& block_indices = m_block_indices_per_sequence[seq_id];
+            auto version_it = scheduler_output.m_block_table_versions.find(seq_id);
+            bool is_same_version = version_it != scheduler_output.m_block_table_versions.end() &&
+                                   block_indices.per_layer.size() == num_layers &&
+                                   block_indices.version == version_it->second;
+            if (!is_same_version) {
+                block_indices.version = version_it != scheduler_output.m_block_table_versions.end() ? version_it->second : 0;
+                block_indices.per_layer.resize(num_layers);
+                for (auto& layer_block_indices : block_indices.per_layer) {
+                    layer_block_indices.clear();
+                }
+            }
+
+            for (size_t layer_idx = 0; layer_idx < num_layers; layer_idx++) {
+                const auto& block_table = kv_blocks[layer_idx];
+                auto& layer_block_indices = block_indices.per_layer[layer_idx];
+                if (layer_block_indices.size() > block_table.size()) {
+                    // blocks are only removed along with a version change, keep going with a full refill just in case
+                    layer_block_indices.clear();
+                }
+                for (size_t block_id = layer_block_indices.size(); block_id < block_table.size(); ++block_id) {
+                    layer_block_indices.push_back(static_cast<int32_t>(block_table[block_id]->get_index()));
+                }
+            }
+        }
+    }
+
+    // Fills indices for sequences in the order defined by scheduler_output, skipping the logical blocks
+    // from seq_id_to_skipped_blocks_map
     void _fill_indices_from_block_tables(
         const std::vector<std::string>& dst_tensor_names,
         const std::vector<SequenceGroup::Ptr>& sequence_groups,
         const Scheduler::Output& scheduler_output,
-        const std::vector<std::map<size_t, std::vector<size_t>>>& seq_id_to_select_logical_idx_maps) {
-        OPENVINO_ASSERT(seq_id_to_select_logical_idx_maps.size() == dst_tensor_names.size() ||
-                        (dst_tensor_names.size() == 1 && !m_is_use_per_layer_cache_control) ||
-                        seq_id_to_select_logical_idx_maps.empty());
-        bool is_fill_all = seq_id_to_select_logical_idx_maps.empty();
+        const std::map<size_t, std::set<size_t>>& seq_id_to_skipped_blocks_map) {
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
-        std::vector<size_t> filled_blocks_per_layer(dst_tensor_names.size(), 0);
-
 
         for (size_t layer_idx = 0; layer_idx < dst_tensor_names.size(); layer_idx++) {
             auto input_tensor = m_request.get_tensor(dst_tensor_names[layer_idx]);
-            auto block_indices_data = input_tensor.data<int32_t>();
+            int32_t* block_indices_data = input_tensor.data<int32_t>();
+            int32_t* block_indices_end = block_indices_data + input_tensor.get_size();
             for (size_t i = 0; i < num_sequence_groups; ++i) {
                 size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
                 SequenceGroup::CPtr sequence_group = sequence_groups[seq_group_id];
-                std::vector<Sequence::CPtr> running_sequences = sequence_group->get_running_sequences();
-                size_t num_running_sequences = running_sequences.size();
+                size_t num_blocks = sequence_group->get_num_logical_blocks();
 
-                for (size_t i = 0; i < num_running_sequences; ++i) {
-                    Sequence::CPtr sequence = running_sequences[i];
+                for (const auto& sequence : sequence_group->get_running_sequences()) {
                     size_t seq_id = sequence->get_id();
-
-                    const auto& kv_blocks = scheduler_output.m_block_tables.at(seq_id);
-
-                    if (is_fill_all) {
-                        size_t num_blocks = sequence_group->get_num_logical_blocks();
-                        for (size_t block_id = 0; block_id < num_blocks; ++block_id) {
-                            // In case no cache eviction is requested, all per-layer block tables are expected to be
-                            // identical at all times
-                            block_indices_data[block_id] = kv_blocks[layer_idx][block_id]->get_index();
-                        }
+                    // In case no cache eviction is requested, all per-layer block tables are expected to be
+                    // identical at all times
+                    const auto& block_indices = m_block_indices_per_sequence.at(seq_id).per_layer[layer_idx];
+                    OPENVINO_ASSERT(num_blocks <= block_indices.size());
+
+                    auto skipped_blocks_it = seq_id_to_skipped_blocks_map.find(seq_id);
+                    if (skipped_blocks_it == seq_id_to_skipped_blocks_map.end()) {
+                        OPENVINO_ASSERT(block_indices_data + num_blocks <= block_indices_end);
+                        std::copy_n(block_indices.begin(), num_blocks, block_indices_data);
                         block_indices_data += num_blocks;
-                        filled_blocks_per_layer[layer_idx] += num_blocks;
-                    } else {
-                        auto seq_id_to_select_logical_idx_map = seq_id_to_select_logical_idx_maps[layer_idx];
-                        if (seq_id_to_select_logical_idx_map.find(seq_id) == seq_id_to_select_logical_idx_map.end()) {
-                            continue;  // sequence not being present in layer-specific map means it should be skipped entirely
-                        }
+                        continue;
+                    }
 
-                        const auto& select_logical_idxs = seq_id_to_select_logical_idx_maps[layer_idx].at(seq_id);
-                        const auto& block_table = kv_blocks[layer_idx];
-                        size_t block_table_size = block_table.size();
-                        for (size_t block_id = 0; block_id < select_logical_idxs.size(); ++block_id) {
-                            size_t logical_block_idx = select_logical_idxs[block_id];
-                            OPENVINO_ASSERT(logical_block_idx < block_table_size);
-                            block_indices_data[block_id] = block_table[logical_block_idx]->get_index();
+                    const auto& skip_set = skipped_blocks_it->second;
+                    for (size_t logical_block_idx = 0; logical_block_idx < num_blocks; ++logical_block_idx) {
+                        if (skip_set.find(logical_block_idx) == skip_set.end()) {
+                            OPENVINO_ASSERT(block_indices_data < block_indices_end);
+                            *block_indices_data++ = block_indices[logical_block_idx];
                         }
-                        block_indices_data += select_logical_idxs.size();
-                        filled_blocks_per_layer[layer_idx] += select_logical_idxs.size();
                     }
                 }
             }
-        }
-        for (size_t layer_idx = 0; layer_idx < dst_tensor_names.size(); layer_idx++) {
-            const auto& target_tensor_name = dst_tensor_names[layer_idx];
-            size_t tensor_size = m_request.get_tensor(target_tensor_name).get_size();
-            size_t last_filled_element_idx = filled_blocks_per_layer[layer_idx];
-            OPENVINO_ASSERT(tensor_size == last_filled_element_idx, "did not fill tensor ", target_tensor_name, " completely, tensor size in elements ", tensor_size, ", last filled idx ", last_filled_element_idx);
+            OPENVINO_ASSERT(block_indices_data == block_indices_end, "did not fill tensor ", dst_tensor_names[layer_idx],
+                            " completely, tensor size in elements ", input_tensor.get_size(),
+                            ", last filled idx ", input_tensor.get_size() - (block_indices_end - block_indices_data));
         }
     }
 
@@ -1046,7 +1078,7 @@ private:
                 size_t seq_id = kv.first;
                 const auto& select_logical_idxs = kv.second;
 
-                const auto& kv_blocks = scheduler_output.m_block_tables.at(seq_id);
+                const auto& kv_blocks = *scheduler_output.m_block_tables.at(seq_id);
                 const auto& block_table = kv_blocks[layer_idx];
                 size_t block_table_size = block_table.size();
                 for (size_t block_id = 0; block_id < select_logical_idxs.size(); ++block_id) {
@@ -1081,51 +1113,31 @@ private:
             }
         }
 
+        _update_block_indices_per_sequence(scheduler_output, num_layers);
 
-        std::vector<size_t> num_blocks_per_layer(num_layers);
-
-        std::vector<std::map<size_t, std::vector<size_t>>> seq_id_to_select_logical_idx_map(m_num_decoder_layers);
+        // the number of blocks is the same for all layers, since skipped blocks are not layer-specific
+        size_t num_blocks = 0;
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
-        for (size_t layer_idx = 0; layer_idx < num_layers; layer_idx++) {
-            for (size_t i = 0; i < num_sequence_groups; ++i) {
-                size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
-                SequenceGroup::CPtr sequence_group = sequence_groups[seq_group_id];
-                std::vector<Sequence::CPtr> running_sequences = sequence_group->get_running_sequences();
-                size_t num_running_sequences = running_sequences.size();
-                for (size_t k = 0; k < num_running_sequences; ++k) {
-                    Sequence::CPtr sequence = running_sequences[k];
-                    size_t num_blocks = sequence_group->get_num_logical_blocks();
-                    size_t seq_id = sequence->get_id();
-                    std::vector<size_t> remaining_logical_block_ids;
-                    if (seq_id_to_skipped_blocks_map.find(seq_id) != seq_id_to_skipped_blocks_map.end()) {
-                        const auto& skip_set = seq_id_to_skipped_blocks_map.at(seq_id);
-                        OPENVINO_ASSERT(num_blocks >= skip_set.size());
-                        remaining_logical_block_ids.reserve(num_blocks - skip_set.size());
-                        for (size_t j = 0; j < num_blocks; j++) {
-                            if (skip_set.find(j) == skip_set.end()) {
-                                remaining_logical_block_ids.push_back(j);
-                            }
-                        }
-                        seq_id_to_select_logical_idx_map[layer_idx][seq_id] = remaining_logical_block_ids;
-                        num_blocks_per_layer[layer_idx] += remaining_logical_block_ids.size();
-                    }
-                    else
-                    {
-                        auto& vec = seq_id_to_select_logical_idx_map[layer_idx][seq_id];
-                        vec.resize(num_blocks);
-                        std::iota(vec.begin(), vec.end(), 0);
-                        num_blocks_per_layer[layer_idx] += num_blocks;
-                    }
+        for (size_t i = 0; i < num_sequence_groups; ++i) {
+            size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
+            SequenceGroup::CPtr sequence_group = sequence_groups[seq_group_id];
+            size_t num_logical_blocks = sequence_group->get_num_logical_blocks();
+            for (const auto& sequence : sequence_group->get_running_sequences()) {
+                auto skipped_blocks_it = seq_id_to_skipped_blocks_map.find(sequence->get_id());
+                if (skipped_blocks_it != seq_id_to_skipped_blocks_map.end()) {
+                    const auto& skip_set = skipped_blocks_it->second;
+                    num_blocks += num_logical_blocks - std::distance(skip_set.begin(), skip_set.lower_bound(num_logical_blocks));
+                } else {
+                    num_blocks += num_logical_blocks;
                 }
-
             }
         }
 
         for (size_t i = 0; i < num_layers; i++) {
-            m_request.get_tensor(tensor_names[i]).set_shape({num_blocks_per_layer[i]});
+            m_request.get_tensor(tensor_names[i]).set_shape({num_blocks});
         }
 
-        _fill_indices_from_block_tables(tensor_names, sequence_groups, scheduler_output, seq_id_to_select_logical_idx_map);
+        _fill_indices_from_block_tables(tensor_names, sequence_groups, scheduler_output, seq_id_to_skipped_blocks_map);
     }
 
     void _set_cache_rotation_coefficients(const std::vector<SequenceGroup::Ptr>& sequence_groups,
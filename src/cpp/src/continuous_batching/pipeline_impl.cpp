@@ -1,18 +1,12 @@
 // Copyright (C) 2023-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
 #include <atomic>
 #include <thread>
 #include <optional>
 #include "openvino/genai/cache_eviction.hpp"
 
-#ifdef __APPLE__
-#include <sys/types.h>
-#include <sys/sysctl.h>
-#elif !defined(_WIN32)
-#include <sys/sysinfo.h>
-#endif
-
 #include "openvino/genai/text_streamer.hpp"
 #include "openvino/pass/sdpa_to_paged_attention.hpp"
 #include "continuous_batching/pipeline_impl.hpp"
@@ -21,44 +15,6 @@
 #include "lora/helper.hpp"
 #include "continuous_batching/cache_state_dumper.hpp"
 
-namespace {
-
-// Returns available RAM memory on system if possible, otherwise returns std::numeric_limits<std::streamsize>::max()
-size_t get_available_cpu_memory() {
-#ifdef __APPLE__ 
-    int64_t memsize;
-    size_t len = sizeof(memsize);
-    if (sysctlbyname("hw.memsize", &memsize, &len, NULL, 0) == 0) {
-        return memsize;
-    }
-#endif 
-
-#if !defined(_WIN32)
-    std::string token;
-    std::ifstream file("/proc/meminfo");
-    if(file.is_open()) {
-        while(file >> token) {
-            if(token == "MemTotal:") {
-                size_t mem;
-                if(file >> mem) {
-                    constexpr auto max_bytes = std::numeric_limits<size_t>::max() / 1024;
-                    if (mem > max_bytes) {
-                        return std::numeric_limits<size_t>::max();
-                    }
-                    return mem * 1024;
-                } else {
-                    return std::numeric_limits<size_t>::max();
-                }
-            }
-            file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-    }
-#endif
-    return std::numeric_limits<size_t>::max();
-}
-
-} // namespace
-
 namespace ov::genai {
 template<class... Ts> struct overloaded : Ts... {using Ts::operator()...;};
 template<class... Ts> overloaded(Ts...) -> overloaded<Ts...>;
@@ -132,7 +88,10 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     auto filtered_properties = extract_adapters_from_properties(properties, &m_generation_config.adapters);
     if (m_generation_config.adapters) {
         m_generation_config.adapters->set_tensor_name_prefix("base_model.model.");
-        m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device);   // TODO: Make the prefix name configurable
+        // requests of one step can use different adapters only when adapters are kept in the model state
+        const auto adapters_mode = m_generation_config.adapters->get_mode();
+        m_use_per_token_adapters = adapters_mode != AdapterConfig::MODE_STATIC && adapters_mode != AdapterConfig::MODE_FUSE;
+        m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device, m_use_per_token_adapters);   // TODO: Make the prefix name configurable
     }
     // Extract sampler_num_threads property if exists and remove it from properties
     size_t sampler_num_threads = std::thread::hardware_concurrency();
@@ -167,7 +126,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     if (execution_device.find("GPU") != std::string::npos) {
         total_mem_size = utils::get_available_gpu_memory(execution_device, m_num_decoder_layers);
     } else {
-        total_mem_size = get_available_cpu_memory();
+        total_mem_size = utils::get_available_cpu_memory();
     }
     if (normalized_config.num_kv_blocks == 0 && normalized_config.cache_size > 0) {
         size_t size_in_bytes = normalized_config.cache_size * 1024 * 1024 * 1024; // convert GBs to bytes
@@ -307,6 +266,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(
     }
 
     if (m_scheduler->get_config().enable_prefix_caching) {
+        sequence_group->set_prefix_cache_salt(_get_prefix_cache_salt(sampling_params_copy));
         m_scheduler->restore_cached_blocks(sequence_group);
     }
 
@@ -359,6 +319,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         scheduling_timer.end();
 
         m_pipeline_metrics.kv_cache_size_in_bytes = scheduler_output.m_cache_size_in_bytes;
+        m_pipeline_metrics.copied_kv_cache_size_in_bytes = scheduler_output.m_copied_cache_size_in_bytes;
         m_pipeline_metrics.scheduled_requests = scheduler_output.m_scheduled_sequence_groups_ids.size();
         m_pipeline_metrics.cache_usage = scheduler_output.m_cache_usage;
         m_pipeline_metrics.max_cache_usage = std::max(m_pipeline_metrics.max_cache_usage, scheduler_output.m_cache_usage);
@@ -394,6 +355,9 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         static ManualTimer timer("forward");
         const auto infer_start = std::chrono::steady_clock::now();
         timer.start();
+        if (m_use_per_token_adapters) {
+            _apply_adapters_per_token(scheduler_output);
+        }
         logits = m_model_runner->forward(m_requests, scheduler_output);
         const auto infer_end = std::chrono::steady_clock::now();
         m_pipeline_metrics.inference_duration = PerfMetrics::get_microsec(infer_end - infer_start);
@@ -484,6 +448,56 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::set_adapters(const std:
     }
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_apply_adapters_per_token(const Scheduler::Output& scheduler_output) {
+    // distinct adapter configs of the scheduled requests and { config index, number of tokens } ranges in the order
+    // of the model input
+    std::vector<AdapterConfig> configs;
+    std::vector<std::pair<size_t, size_t>> token_ranges;
+    for (size_t seq_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+        const SequenceGroup::CPtr sequence_group = m_requests[seq_group_id];
+        const AdapterConfig config = sequence_group->get_sampling_parameters().adapters.value_or(
+            m_generation_config.adapters.value_or(AdapterConfig{}));
+
+        auto config_it = std::find_if(configs.begin(), configs.end(), [&config](const AdapterConfig& other) {
+            return other.get_adapters_and_alphas() == config.get_adapters_and_alphas();
+        });
+        const size_t config_idx = config_it - configs.begin();
+        if (config_it == configs.end()) {
+            configs.push_back(config);
+        }
+
+        const size_t num_tokens = sequence_group->get_num_scheduled_tokens() * sequence_group->num_running_seqs();
+        if (!token_ranges.empty() && token_ranges.back().first == config_idx) {
+            token_ranges.back().second += num_tokens;
+        } else {
+            token_ranges.emplace_back(config_idx, num_tokens);
+        }
+    }
+
+    if (!configs.empty()) {
+        m_adapter_controller->apply_per_token(m_model_runner->get_infer_request(), configs, token_ranges);
+    }
+}
+
+size_t ContinuousBatchingPipeline::ContinuousBatchingImpl::_get_prefix_cache_salt(const GenerationConfig& sampling_params) {
+    // fused adapters are a part of the model weights and are the same for all requests
+    if (!m_adapter_controller || m_generation_config.adapters->get_mode() == AdapterConfig::MODE_FUSE) {
+        return 0;
+    }
+    const auto adapters_and_alphas = sampling_params.adapters.value_or(
+        m_generation_config.adapters.value_or(AdapterConfig{})).get_adapters_and_alphas();
+    if (adapters_and_alphas.empty()) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock{m_prefix_cache_salt_mutex};
+    auto it = std::find(m_prefix_cache_salt_adapters.begin(), m_prefix_cache_salt_adapters.end(), adapters_and_alphas);
+    if (it == m_prefix_cache_salt_adapters.end()) {
+        it = m_prefix_cache_salt_adapters.insert(it, adapters_and_alphas);
+    }
+    return static_cast<size_t>(it - m_prefix_cache_salt_adapters.begin()) + 1;
+}
+
 std::vector<EncodedGenerationResult>
 ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<ov::Tensor>& input_ids,
                                                              const std::vector<GenerationConfig>& sampling_params,
@@ -512,12 +526,15 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
     auto& raw_perf_counters = perf_metrics.raw_metrics;
     raw_perf_counters.m_inference_durations =  {{ MicroSeconds(0.0f) }};
 
-    // checks that all requests has the same LoRA adapters property value
-    for (size_t i = 1; i < sampling_params.size(); ++i) {
-        OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
-            "LoRA adapters value must be the same for all requests");
+    // adapters are applied at each step when requests can use different adapters
+    if (!m_use_per_token_adapters) {
+        // checks that all requests has the same LoRA adapters property value
+        for (size_t i = 1; i < sampling_params.size(); ++i) {
+            OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
+                "LoRA adapters value must be the same for all requests");
+        }
+        set_adapters(sampling_params[0].adapters);
     }
-    set_adapters(sampling_params[0].adapters);
 
     const auto streamer_ptr = std::make_shared<ThreadedStreamerWrapper>(streamer, m_tokenizer);
 
@@ -16,6 +16,11 @@ protected:
     std::shared_ptr<Scheduler> m_scheduler;
     std::shared_ptr<ModelRunner> m_model_runner;
     std::optional<AdapterController> m_adapter_controller;
+    // whether LoRA adapters are applied per request within a step rather than once for the whole generate() call
+    bool m_use_per_token_adapters = false;
+    // distinct adapters and alphas of requests, the index of a config plus one is the prefix cache salt of its requests
+    std::vector<std::vector<std::pair<Adapter, float>>> m_prefix_cache_salt_adapters;
+    std::mutex m_prefix_cache_salt_mutex;
     std::shared_ptr<Sampler> m_sampler;
 
     // current requests to process
@@ -98,6 +103,19 @@ protected:
     void _prepare_rotation_data_storage(const SchedulerConfig& normalized_config, size_t embedding_size);
     void _set_adaptive_rkv_diversity_blocks(const SchedulerConfig& sched_config, const Scheduler::Output& scheduler_output);
 
+    /**
+     * Applies LoRA adapters of each scheduled request to its tokens of the next inference.
+     * @param scheduler_output Output of the scheduler for the current step.
+     */
+    void _apply_adapters_per_token(const Scheduler::Output& scheduler_output);
+
+    /**
+     * Returns a prefix cache salt which differs for requests with different LoRA adapters, as their KV cache blocks
+     * can't be shared even for the same tokens. Requests without adapters get 0, i.e. the hashes of the base model.
+     * @param sampling_params Generation config of the request.
+     */
+    size_t _get_prefix_cache_salt(const GenerationConfig& sampling_params);
+
     virtual void drop_requests();
 
 public:
@@ -0,0 +1,270 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief A size-bounded store of KV cache block contents (for all layers) keyed by the prefix hash of the block.
+ * Used as a lower tier of the prefix cache to keep the blocks which were evicted from the device KV cache.
+ */
+class PrefixCacheTier {
+public:
+    using Ptr = std::shared_ptr<PrefixCacheTier>;
+    using Entry = std::pair<size_t, std::vector<uint8_t>>;
+
+    virtual ~PrefixCacheTier() = default;
+
+    /**
+     * @return Whether the contents of the block with a given hash are stored in this tier.
+     */
+    virtual bool contains(size_t hash) const = 0;
+
+    /**
+     * Stores the contents of a block, evicting the least recently used blocks if the tier is full.
+     * @param hash The prefix hash of the block.
+     * @param data The contents of the block.
+     * @return Blocks evicted from the tier to make room for the new one. Tiers which don't pass evicted blocks further
+     * return an empty vector.
+     */
+    virtual std::vector<Entry> put(size_t hash, std::vector<uint8_t> data) = 0;
+
+    /**
+     * Loads the contents of a block and marks it as most recently used.
+     * @param hash The prefix hash of the block.
+     * @param data Buffer to read the contents into.
+     * @return Whether the block was found in the tier.
+     */
+    virtual bool get(size_t hash, std::vector<uint8_t>& data) = 0;
+
+    /**
+     * @return Number of blocks stored in the tier.
+     */
+    virtual size_t num_blocks() const = 0;
+};
+
+/**
+ * @brief Prefix cache tier which keeps block contents in host memory.
+ */
+class HostPrefixCacheTier : public PrefixCacheTier {
+    size_t m_max_num_blocks;
+    // most recently used blocks are in the front
+    std::list<size_t> m_lru;
+    struct HostEntry {
+        std::vector<uint8_t> data;
+        std::list<size_t>::iterator lru_it;
+    };
+    std::unordered_map<size_t, HostEntry> m_entries;
+
+public:
+    /**
+     * @param max_num_blocks Max number of blocks to be kept in host memory.
+     */
+    explicit HostPrefixCacheTier(size_t max_num_blocks) : m_max_num_blocks(max_num_blocks) {}
+
+    bool contains(size_t hash) const override {
+        return m_entries.count(hash) > 0;
+    }
+
+    std::vector<Entry> put(size_t hash, std::vector<uint8_t> data) override {
+        std::vector<Entry> evicted;
+        auto it = m_entries.find(hash);
+        if (it != m_entries.end()) {
+            // contents are defined by the prefix hash, so only recency is updated
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lru_it);
+            return evicted;
+        }
+
+        if (m_max_num_blocks == 0) {
+            evicted.emplace_back(hash, std::move(data));
+            return evicted;
+        }
+
+        while (m_entries.size() >= m_max_num_blocks) {
+            size_t lru_hash = m_lru.back();
+            m_lru.pop_back();
+            auto lru_it = m_entries.find(lru_hash);
+            evicted.emplace_back(lru_hash, std::move(lru_it->second.data));
+            m_entries.erase(lru_it);
+        }
+
+        m_lru.push_front(hash);
+        m_entries[hash] = HostEntry{std::move(data), m_lru.begin()};
+        return evicted;
+    }
+
+    bool get(size_t hash, std::vector<uint8_t>& data) override {
+        auto it = m_entries.find(hash);
+        if (it == m_entries.end())
+            return false;
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lru_it);
+        data = it->second.data;
+        return true;
+    }
+
+    size_t num_blocks() const override {
+        return m_entries.size();
+    }
+};
+
+/**
+ * @brief Prefix cache tier which keeps block contents in fixed-size slots of a file on disk.
+ * The file is only valid during the lifetime of the tier and is removed on destruction.
+ */
+class DiskPrefixCacheTier : public PrefixCacheTier {
+    std::filesystem::path m_path;
+    size_t m_block_size_in_bytes;
+    size_t m_max_num_blocks;
+    std::fstream m_file;
+    // most recently used blocks are in the front
+    std::list<size_t> m_lru;
+    struct DiskEntry {
+        size_t slot;
+        std::list<size_t>::iterator lru_it;
+    };
+    std::unordered_map<size_t, DiskEntry> m_entries;
+    std::vector<size_t> m_free_slots;
+
+public:
+    /**
+     * @param path Path to the file to keep the blocks in. The file is overwritten.
+     * @param block_size_in_bytes Size of the contents of a single block.
+     * @param max_num_blocks Max number of blocks to be kept in the file.
+     */
+    DiskPrefixCacheTier(const std::filesystem::path& path, size_t block_size_in_bytes, size_t max_num_blocks) :
+        m_path(path),
+        m_block_size_in_bytes(block_size_in_bytes),
+        m_max_num_blocks(max_num_blocks) {
+        OPENVINO_ASSERT(block_size_in_bytes > 0, "Block size of prefix cache disk tier must be non-zero");
+        m_file.open(m_path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+        OPENVINO_ASSERT(m_file.is_open(), "Failed to open prefix cache file ", m_path.string());
+        m_free_slots.reserve(m_max_num_blocks);
+        for (size_t slot = m_max_num_blocks; slot > 0; --slot) {
+            m_free_slots.push_back(slot - 1);
+        }
+    }
+
+    ~DiskPrefixCacheTier() override {
+        m_file.close();
+        std::error_code ec;
+        std::filesystem::remove(m_path, ec);
+    }
+
+    bool contains(size_t hash) const override {
+        return m_entries.count(hash) > 0;
+    }
+
+    std::vector<Entry> put(size_t hash, std::vector<uint8_t> data) override {
+        OPENVINO_ASSERT(data.size() == m_block_size_in_bytes, "Unexpected size of block contents: ", data.size(), ", expected: ", m_block_size_in_bytes);
+        auto it = m_entries.find(hash);
+        if (it != m_entries.end()) {
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lru_it);
+            return {};
+        }
+        if (m_max_num_blocks == 0) {
+            return {};
+        }
+
+        if (m_free_slots.empty()) {
+            // the last tier, evicted blocks are dropped
+            size_t lru_hash = m_lru.back();
+            m_lru.pop_back();
+            auto lru_it = m_entries.find(lru_hash);
+            m_free_slots.push_back(lru_it->second.slot);
+            m_entries.erase(lru_it);
+        }
+
+        size_t slot = m_free_slots.back();
+        m_free_slots.pop_back();
+        m_file.seekp(static_cast<std::streamoff>(slot * m_block_size_in_bytes));
+        m_file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        OPENVINO_ASSERT(m_file.good(), "Failed to write to prefix cache file ", m_path.string());
+
+        m_lru.push_front(hash);
+        m_entries[hash] = DiskEntry{slot, m_lru.begin()};
+        return {};
+    }
+
+    bool get(size_t hash, std::vector<uint8_t>& data) override {
+        auto it = m_entries.find(hash);
+        if (it == m_entries.end())
+            return false;
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lru_it);
+
+        data.resize(m_block_size_in_bytes);
+        m_file.seekg(static_cast<std::streamoff>(it->second.slot * m_block_size_in_bytes));
+        m_file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        OPENVINO_ASSERT(m_file.good(), "Failed to read from prefix cache file ", m_path.string());
+        return true;
+    }
+
+    size_t num_blocks() const override {
+        return m_entries.size();
+    }
+};
+
+/**
+ * @brief Hierarchy of prefix cache tiers ordered from the fastest to the slowest one. Blocks are stored to the first tier,
+ * blocks evicted from a tier are passed to the next one, blocks loaded from a slower tier are promoted to the first one.
+ */
+class TieredPrefixCache {
+    std::vector<PrefixCacheTier::Ptr> m_tiers;
+
+    void _store(size_t tier_idx, size_t hash, std::vector<uint8_t> data) {
+        for (auto& [evicted_hash, evicted_data] : m_tiers[tier_idx]->put(hash, std::move(data))) {
+            if (tier_idx + 1 < m_tiers.size()) {
+                _store(tier_idx + 1, evicted_hash, std::move(evicted_data));
+            }
+        }
+    }
+
+public:
+    void add_tier(PrefixCacheTier::Ptr tier) {
+        OPENVINO_ASSERT(tier, "Prefix cache tier must not be empty");
+        m_tiers.push_back(std::move(tier));
+    }
+
+    bool empty() const {
+        return m_tiers.empty();
+    }
+
+    bool contains(size_t hash) const {
+        for (const auto& tier : m_tiers) {
+            if (tier->contains(hash))
+                return true;
+        }
+        return false;
+    }
+
+    void store(size_t hash, std::vector<uint8_t> data) {
+        if (!m_tiers.empty()) {
+            _store(0, hash, std::move(data));
+        }
+    }
+
+    bool load(size_t hash, std::vector<uint8_t>& data) {
+        for (size_t tier_idx = 0; tier_idx < m_tiers.size(); ++tier_idx) {
+            if (m_tiers[tier_idx]->get(hash, data)) {
+                if (tier_idx > 0) {
+                    _store(0, hash, data);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+}  // namespace ov::genai
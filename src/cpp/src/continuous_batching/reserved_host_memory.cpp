@@ -0,0 +1,93 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "continuous_batching/reserved_host_memory.hpp"
+
+#include <new>
+
+#ifdef _WIN32
+#    define NOMINMAX
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+namespace {
+
+size_t get_page_size() {
+#ifdef _WIN32
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    return system_info.dwPageSize;
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+size_t align_to_page(size_t size) {
+    static const size_t page_size = get_page_size();
+    return (size + page_size - 1) / page_size * page_size;
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+ReservedHostMemory::ReservedHostMemory(size_t reserved_size) :
+    m_reserved_size(align_to_page(reserved_size)) {
+    if (m_reserved_size == 0) {
+        return;
+    }
+#ifdef _WIN32
+    m_data = VirtualAlloc(nullptr, m_reserved_size, MEM_RESERVE, PAGE_NOACCESS);
+    if (m_data == nullptr) {
+        throw std::bad_alloc();
+    }
+#else
+    // pages are not accessible (and not backed by physical memory) until they are committed
+    m_data = mmap(nullptr, m_reserved_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (m_data == MAP_FAILED) {
+        m_data = nullptr;
+        throw std::bad_alloc();
+    }
+#endif
+}
+
+ReservedHostMemory::~ReservedHostMemory() {
+    if (m_data == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    VirtualFree(m_data, 0, MEM_RELEASE);
+#else
+    munmap(m_data, m_reserved_size);
+#endif
+}
+
+bool ReservedHostMemory::commit(size_t size) {
+    size = align_to_page(size);
+    if (size > m_reserved_size) {
+        return false;
+    }
+    if (size <= m_committed_size) {
+        return true;
+    }
+
+    void* commit_start = static_cast<char*>(m_data) + m_committed_size;
+    const size_t commit_size = size - m_committed_size;
+#ifdef _WIN32
+    if (VirtualAlloc(commit_start, commit_size, MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+        throw std::bad_alloc();
+    }
+#else
+    // physical pages are allocated by the system on the first access
+    if (mprotect(commit_start, commit_size, PROT_READ | PROT_WRITE) != 0) {
+        throw std::bad_alloc();
+    }
+#endif
+    m_committed_size = size;
+    return true;
+}
+
+}  // namespace ov::genai
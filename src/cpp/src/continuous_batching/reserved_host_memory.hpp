@@ -0,0 +1,53 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+
+namespace ov::genai {
+
+/**
+ * @brief Host memory region reserved in the virtual address space, whose beginning is committed to physical memory
+ * on demand. Growing the committed part keeps the data in place, so that a buffer placed in the region grows without
+ * reallocation and copying of its contents.
+ */
+class ReservedHostMemory {
+public:
+    /**
+     * Reserves the address space. Throws std::bad_alloc if the address space cannot be reserved.
+     * @param reserved_size Max size of the region in bytes.
+     */
+    explicit ReservedHostMemory(size_t reserved_size);
+    ~ReservedHostMemory();
+
+    ReservedHostMemory(const ReservedHostMemory&) = delete;
+    ReservedHostMemory& operator=(const ReservedHostMemory&) = delete;
+
+    /**
+     * Commits the beginning of the region to physical memory, if it is not committed yet.
+     * Throws std::bad_alloc if the memory cannot be committed.
+     * @param size Size of the region part to be committed in bytes.
+     * @return False if the size exceeds the reserved size, so that the region cannot be grown.
+     */
+    bool commit(size_t size);
+
+    void* data() const {
+        return m_data;
+    }
+
+    size_t get_reserved_size() const {
+        return m_reserved_size;
+    }
+
+    size_t get_committed_size() const {
+        return m_committed_size;
+    }
+
+private:
+    void* m_data = nullptr;
+    size_t m_reserved_size = 0;
+    size_t m_committed_size = 0;
+};
+
+}  // namespace ov::genai
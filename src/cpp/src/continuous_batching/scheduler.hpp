@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdlib>
 #include <vector>
 
@@ -16,8 +17,90 @@
 #include "continuous_batching/sparse_attention.hpp"
 #include "utils.hpp"
 #include "continuous_batching/cache_eviction.hpp"
+#include "continuous_batching/prefix_cache_tiers.hpp"
 
 namespace ov::genai {
+
+/**
+ * Defines the order in which the scheduler serves sequence groups. Sequence groups are stably sorted
+ * with the policy before each scheduling step, so the groups which go first get the tokens of the megabatch
+ * and KV-cache blocks first, while the groups which go last are preempted first.
+ */
+class ISchedulingPolicy {
+public:
+    using Ptr = std::shared_ptr<ISchedulingPolicy>;
+
+    virtual ~ISchedulingPolicy() = default;
+
+    /**
+     * @return Whether `lhs` has to be served strictly before `rhs`.
+     */
+    virtual bool has_higher_priority(const SequenceGroup::CPtr& lhs, const SequenceGroup::CPtr& rhs) const = 0;
+
+    /**
+     * @return Whether the policy keeps the arrival order of sequence groups, i.e. sorting can be skipped.
+     */
+    virtual bool keeps_arrival_order() const {
+        return false;
+    }
+};
+
+class FIFOSchedulingPolicy : public ISchedulingPolicy {
+public:
+    bool has_higher_priority(const SequenceGroup::CPtr& lhs, const SequenceGroup::CPtr& rhs) const override {
+        return false;
+    }
+
+    bool keeps_arrival_order() const override {
+        return true;
+    }
+};
+
+class PrioritySchedulingPolicy : public ISchedulingPolicy {
+public:
+    bool has_higher_priority(const SequenceGroup::CPtr& lhs, const SequenceGroup::CPtr& rhs) const override {
+        return lhs->get_sampling_parameters().priority > rhs->get_sampling_parameters().priority;
+    }
+};
+
+class EarliestDeadlineFirstSchedulingPolicy : public ISchedulingPolicy {
+public:
+    bool has_higher_priority(const SequenceGroup::CPtr& lhs, const SequenceGroup::CPtr& rhs) const override {
+        auto lhs_deadline = lhs->get_deadline(), rhs_deadline = rhs->get_deadline();
+        // requests without deadline are served after the ones with deadline
+        if (!lhs_deadline.has_value() || !rhs_deadline.has_value())
+            return lhs_deadline.has_value() && !rhs_deadline.has_value();
+        return *lhs_deadline < *rhs_deadline;
+    }
+};
+
+class ShortestRemainingPromptFirstSchedulingPolicy : public ISchedulingPolicy {
+public:
+    bool has_higher_priority(const SequenceGroup::CPtr& lhs, const SequenceGroup::CPtr& rhs) const override {
+        return get_remaining_prompt_len(lhs) < get_remaining_prompt_len(rhs);
+    }
+
+private:
+    static size_t get_remaining_prompt_len(const SequenceGroup::CPtr& sequence_group) {
+        size_t prompt_len = sequence_group->get_prompt_len();
+        return prompt_len - std::min(prompt_len, sequence_group->get_num_processed_tokens());
+    }
+};
+
+inline ISchedulingPolicy::Ptr create_scheduling_policy(SchedulingPolicy policy) {
+    switch (policy) {
+        case SchedulingPolicy::FIFO:
+            return std::make_shared<FIFOSchedulingPolicy>();
+        case SchedulingPolicy::PRIORITY:
+            return std::make_shared<PrioritySchedulingPolicy>();
+        case SchedulingPolicy::EARLIEST_DEADLINE_FIRST:
+            return std::make_shared<EarliestDeadlineFirstSchedulingPolicy>();
+        case SchedulingPolicy::SHORTEST_REMAINING_PROMPT_FIRST:
+            return std::make_shared<ShortestRemainingPromptFirstSchedulingPolicy>();
+    }
+    OPENVINO_THROW("Unknown scheduling policy");
+}
+
 class Scheduler {
     bool m_can_use_partial_preemption;
 
@@ -34,12 +117,24 @@ class Scheduler {
     std::shared_ptr<CacheManager> m_cache_manager;
 
     size_t m_snapkv_window_size = 1;
+
+    ISchedulingPolicy::Ptr m_scheduling_policy;
+
+    // request ID -> ID of the sequence whose KV-cache is swapped out to host memory
+    std::map<uint64_t, uint64_t> m_swapped_sequence_groups;
+
+    // host memory and disk tiers of prefix cache, created once KV-cache is allocated
+    bool m_use_prefix_cache_tiers = false;
+    std::shared_ptr<TieredPrefixCache> m_prefix_cache_tiers;
 public:
     struct Output {
         // IDs of scheduled groups
         std::vector<uint64_t> m_scheduled_sequence_groups_ids;
-        // block tables for scheduled sequences per each attention layer in the model
-        std::map<uint64_t, std::vector<BlocksPerLayer>> m_block_tables;
+        // block tables for scheduled sequences per each attention layer in the model, pointing to the block tables owned by
+        // the block manager instead of copying them on each step, valid until the next schedule() or free_sequence() call
+        std::map<uint64_t, const std::vector<BlocksPerLayer>*> m_block_tables;
+        // versions of the block tables above, see BlockManager::get_block_table_version
+        std::map<uint64_t, size_t> m_block_table_versions;
         // how many previous token scores to aggregate in the paged attention score output, per sequence
         std::map<uint64_t, size_t> m_score_aggregation_windows;
 
@@ -67,15 +162,27 @@ public:
         float m_cache_usage = 0.0;
         // cache usage size in bytes
         size_t m_cache_size_in_bytes = 0;
+        // size of KV cache blocks copied for copy-on-write at this step
+        size_t m_copied_cache_size_in_bytes = 0;
     };
 
     Scheduler(size_t block_size, std::shared_ptr<CacheManager> cache_manager, const SchedulerConfig & config = {}, size_t num_layers = 1, bool can_use_partial_preemption = true, size_t snapkv_window_size = 1) :
         m_can_use_partial_preemption(can_use_partial_preemption),
         m_config(config),
         m_cache_manager(cache_manager),
-        m_snapkv_window_size(snapkv_window_size) {
+        m_snapkv_window_size(snapkv_window_size),
+        m_scheduling_policy(create_scheduling_policy(config.scheduling_policy)) {
         m_block_manager = std::make_shared<BlockManager>(m_config.num_kv_blocks, m_config.enable_prefix_caching, block_size, num_layers);
         OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero");
+        if (m_cache_manager) {
+            m_cache_manager->set_swap_space(m_config.swap_space * 1024 * 1024 * 1024); // convert GBs to bytes
+        }
+        const bool has_prefix_cache_tiers = m_config.prefix_cache_host_size > 0 ||
+                                            (m_config.prefix_cache_disk_size > 0 && !m_config.prefix_cache_disk_path.empty());
+        if (m_config.enable_prefix_caching && has_prefix_cache_tiers && m_cache_manager && m_cache_manager->is_host_cache()) {
+            m_use_prefix_cache_tiers = true;
+            m_block_manager->set_track_overwritten_blocks(true);
+        }
     }
 
     void release() {
@@ -95,6 +202,23 @@ public:
             _initialize_cache(sequence_groups);
         }
 
+        const bool reorder_sequence_groups = !m_scheduling_policy->keeps_arrival_order();
+        if (reorder_sequence_groups) {
+            // serve groups in policy order; stable sort keeps arrival order within the same priority
+            std::stable_sort(sequence_groups.begin(), sequence_groups.end(),
+                [this] (const SequenceGroup::Ptr& lhs, const SequenceGroup::Ptr& rhs) {
+                    return m_scheduling_policy->has_higher_priority(lhs, rhs);
+                });
+        }
+
+        if (!m_swapped_sequence_groups.empty()) {
+            _swap_in_sequence_groups(sequence_groups);
+        }
+
+        if (m_use_prefix_cache_tiers) {
+            _restore_blocks_from_prefix_cache_tiers(sequence_groups);
+        }
+
         if (m_config.dynamic_split_fuse) {
             // deepspeed-mii case
             // generation phase is always scheduled first
@@ -113,14 +237,25 @@ public:
             }
         }
 
+        if (reorder_sequence_groups) {
+            // generation phase is scheduled before prompt phase, so high priority prompts can be scheduled after
+            // low priority generating groups; model inputs and sampler have to follow the order of sequence groups
+            std::sort(scheduler_output.m_scheduled_sequence_groups_ids.begin(), scheduler_output.m_scheduled_sequence_groups_ids.end());
+        }
+
         m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
         _clear_waiting_sequences(sequence_groups);
+
+        if (m_use_prefix_cache_tiers) {
+            // blocks reused for overwriting still keep their previous contents until inference and block copies
+            _spill_overwritten_blocks_to_prefix_cache_tiers();
+        }
         scheduler_output.m_cache_usage = m_block_manager->get_used_percentage();
         scheduler_output.m_cache_size_in_bytes = m_block_manager->get_total_number_of_kv_blocks() * m_cache_manager->get_block_size_in_bytes();
 
         static ManualTimer copy_blocks_timer("copy block");
         copy_blocks_timer.start();
-        m_cache_manager->copy_blocks(block_copy_map);
+        scheduler_output.m_copied_cache_size_in_bytes = m_cache_manager->copy_blocks(block_copy_map);
         copy_blocks_timer.end();
 
         return scheduler_output;
@@ -132,7 +267,8 @@ public:
      */
     void clean_empty_blocks(std::vector<SequenceGroup::Ptr>& seq_groups) {
         for (const auto& seq_group : seq_groups)
-            m_block_manager->free_empty_physical_blocks(seq_group);
+            if (!_is_swapped_out(seq_group))
+                m_block_manager->free_empty_physical_blocks(seq_group);
     }
 
     const std::vector<BlocksPerLayer>& get_block_tables(const Sequence& seq) const {
@@ -167,6 +303,11 @@ public:
         return m_config;
     }
 
+    void set_scheduling_policy(ISchedulingPolicy::Ptr scheduling_policy) {
+        OPENVINO_ASSERT(scheduling_policy, "Scheduling policy must not be empty");
+        m_scheduling_policy = std::move(scheduling_policy);
+    }
+
     void free_blocks_from_sequence(size_t seq_id, const std::vector<std::set<size_t>>& per_layer_logical_block_indices_to_free) {
         m_block_manager->free_blocks_from_sequence(seq_id, per_layer_logical_block_indices_to_free);
     }
@@ -175,6 +316,11 @@ public:
         OPENVINO_ASSERT(m_config.enable_prefix_caching == false, "KV-cache should not be cleared if prefix caching is enabled.");
         m_cache_manager->clear();
         m_block_manager->clear();
+        m_swapped_sequence_groups.clear();
+    }
+
+    bool is_swapped_out(const SequenceGroup::CPtr& sequence_group) const {
+        return _is_swapped_out(sequence_group);
     }
 
 private:
@@ -242,18 +388,223 @@ private:
         return m_block_manager->num_free_blocks() > prev_blocks_count;
     }
 
-    static size_t _get_low_priority_sequence_group_id(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+    bool _is_swapped_out(const SequenceGroup::CPtr& sequence_group) const {
+        return m_swapped_sequence_groups.count(sequence_group->get_request_id()) > 0;
+    }
+
+    /**
+     * Swapping is chosen over recompute when the whole KV-cache of a sequence group has to be dropped anyway and
+     * its recompute would take more than a single megabatch, while copying KV-cache blocks to host memory and back
+     * is cheap compared to running the model over the same number of tokens.
+     */
+    bool _can_preempt_by_swap(SequenceGroup::Ptr sequence_group, size_t blocks_needed) {
+        if (m_config.swap_space == 0 || sequence_group->get_num_evicted_tokens() != 0 || sequence_group->get_sampling_parameters().is_beam_search())
+            return false;
+
+        // swapping of sequences which share blocks is not supported
+        auto sequences = sequence_group->get_not_finished_sequences();
+        if (sequences.size() != 1 || !m_block_manager->has_block_table(sequences[0]->get_id()))
+            return false;
+
+        size_t num_blocks_occupied_by_sequence = m_block_manager->get_number_of_blocks_occupied_by_sequence(sequence_group);
+        bool is_full_preemption = num_blocks_occupied_by_sequence <= blocks_needed || !m_can_use_partial_preemption;
+        return is_full_preemption &&
+               sequence_group->get_num_processed_tokens() >= m_config.max_num_batched_tokens &&
+               m_cache_manager->can_swap_out(num_blocks_occupied_by_sequence);
+    }
+
+    bool _preempt_by_swap(SequenceGroup::Ptr sequence_group) {
+        size_t prev_blocks_count = m_block_manager->num_free_blocks();
+        auto seq_id = sequence_group->get_not_finished_sequences()[0]->get_id();
+
+        // blocks allocated on the current step are not backed by KV-cache tensors yet
+        m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
+        m_cache_manager->swap_out(seq_id, m_block_manager->get_block_indices_per_layer(seq_id));
+        m_block_manager->free_sequence(seq_id);
+        m_swapped_sequence_groups[sequence_group->get_request_id()] = seq_id;
+
+        // processed tokens are kept, so generation continues right after swap in
+        sequence_group->set_waiting();
+        return m_block_manager->num_free_blocks() > prev_blocks_count;
+    }
+
+    void _swap_in_sequence_groups(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        // release swap space of requests which were removed from the pipeline
+        std::set<uint64_t> request_ids;
+        for (const auto& sequence_group : sequence_groups)
+            request_ids.insert(sequence_group->get_request_id());
+        for (auto it = m_swapped_sequence_groups.begin(); it != m_swapped_sequence_groups.end();) {
+            if (request_ids.count(it->first) == 0) {
+                m_cache_manager->release_swapped_blocks(it->second);
+                it = m_swapped_sequence_groups.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        size_t num_running_sequence_groups = 0;
+        for (const auto& sequence_group : sequence_groups) {
+            if (sequence_group->can_generate_tokens() && !_is_swapped_out(sequence_group))
+                ++num_running_sequence_groups;
+        }
+
+        // swapped out groups are restored in scheduling order, so a lower priority group can't jump ahead
+        for (const auto& sequence_group : sequence_groups) {
+            auto it = m_swapped_sequence_groups.find(sequence_group->get_request_id());
+            if (it == m_swapped_sequence_groups.end())
+                continue;
+
+            uint64_t seq_id = it->second;
+            if (sequence_group->has_finished() || sequence_group->handle_stopped() || sequence_group->handle_cancelled()) {
+                m_cache_manager->release_swapped_blocks(seq_id);
+                m_swapped_sequence_groups.erase(it);
+                continue;
+            }
+
+            // keep a block for each running group, otherwise a swapped in group immediately preempts them
+            size_t num_blocks = m_cache_manager->get_num_swapped_blocks(seq_id);
+            while (!m_block_manager->can_allocate_blocks(num_blocks + num_running_sequence_groups)) {
+                if (!_try_increase_cache()) {
+                    break;
+                }
+            }
+            if (!m_block_manager->can_allocate_blocks(num_blocks + num_running_sequence_groups))
+                break;
+
+            Sequence::Ptr sequence = sequence_group->get_not_finished_sequences()[0];
+            OPENVINO_ASSERT(sequence->get_id() == seq_id, "Internal error: swapped out sequence ", seq_id, " is not found in its sequence group");
+            auto block_indices = m_block_manager->restore_swapped_sequence(sequence, num_blocks, sequence_group->get_prompt_len());
+            m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
+            if (m_use_prefix_cache_tiers) {
+                // restored blocks could be reused for overwriting, their previous contents are saved before swap in
+                _spill_overwritten_blocks_to_prefix_cache_tiers();
+            }
+            m_cache_manager->swap_in(seq_id, block_indices);
+            m_swapped_sequence_groups.erase(it);
+            ++num_running_sequence_groups;
+        }
+    }
+
+    TieredPrefixCache& _get_prefix_cache_tiers() {
+        if (!m_prefix_cache_tiers) {
+            OPENVINO_ASSERT(m_cache_manager->get_num_allocated_kv_blocks() > 0, "Internal error: KV-cache must be allocated before prefix cache tiers");
+            const size_t block_data_size = m_cache_manager->get_block_data_size_in_bytes();
+            m_prefix_cache_tiers = std::make_shared<TieredPrefixCache>();
+            if (m_config.prefix_cache_host_size > 0) {
+                size_t host_size_in_bytes = m_config.prefix_cache_host_size * 1024 * 1024 * 1024; // convert GBs to bytes
+                m_prefix_cache_tiers->add_tier(std::make_shared<HostPrefixCacheTier>(host_size_in_bytes / block_data_size));
+            }
+            if (m_config.prefix_cache_disk_size > 0 && !m_config.prefix_cache_disk_path.empty()) {
+                size_t disk_size_in_bytes = m_config.prefix_cache_disk_size * 1024 * 1024 * 1024; // convert GBs to bytes
+                m_prefix_cache_tiers->add_tier(std::make_shared<DiskPrefixCacheTier>(m_config.prefix_cache_disk_path, block_data_size,
+                                                                                     disk_size_in_bytes / block_data_size));
+            }
+        }
+        return *m_prefix_cache_tiers;
+    }
+
+    void _spill_overwritten_blocks_to_prefix_cache_tiers() {
+        auto overwritten_blocks = m_block_manager->pop_overwritten_blocks();
+        if (overwritten_blocks.empty())
+            return;
+
+        static ManualTimer spill_timer("spill prefix cache blocks");
+        spill_timer.start();
+        TieredPrefixCache& prefix_cache_tiers = _get_prefix_cache_tiers();
+        for (const auto& [hash, block_indices] : overwritten_blocks) {
+            std::vector<uint8_t> block_data;
+            m_cache_manager->read_block(block_indices, block_data);
+            prefix_cache_tiers.store(hash, std::move(block_data));
+        }
+        spill_timer.end();
+    }
+
+    /**
+     * Extends the prefix of prompts restored from KV-cache by BlockManager::restore_cached_blocks with full blocks
+     * found in host memory or disk tiers of prefix cache, before prompt phase is scheduled for them.
+     */
+    void _restore_blocks_from_prefix_cache_tiers(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        if (m_cache_manager->get_num_allocated_kv_blocks() == 0)
+            return;
+
+        const size_t block_size = get_block_size();
+        std::vector<uint8_t> block_data;
+        for (const auto& sequence_group : sequence_groups) {
+            if (sequence_group->can_generate_tokens() || sequence_group->is_waiting() || sequence_group->handle_stopped() ||
+                sequence_group->handle_cancelled() || _is_swapped_out(sequence_group) || sequence_group->get_num_evicted_tokens() != 0)
+                continue;
+            auto sequences = sequence_group->get_not_finished_sequences();
+            if (sequences.size() != 1)
+                continue;
+
+            Sequence::Ptr sequence = sequences[0];
+            const uint64_t seq_id = sequence->get_id();
+            const size_t prompt_len = sequence_group->get_prompt_len();
+            size_t content_len = sequence_group->get_num_processed_tokens();
+            size_t num_blocks = m_block_manager->has_block_table(seq_id) ? m_block_manager->get_block_table(seq_id, 0).size() : 0;
+
+            // restored blocks are appended right after processed ones, so there must be no partially filled blocks
+            while (num_blocks * block_size == content_len && content_len + block_size <= prompt_len) {
+                size_t hash = sequence->get_hash(content_len + block_size);
+                if (!_get_prefix_cache_tiers().contains(hash))
+                    break;
+                while (!m_block_manager->can_allocate_blocks(1)) {
+                    if (!_try_increase_cache()) {
+                        break;
+                    }
+                }
+                if (!m_block_manager->can_allocate_blocks(1))
+                    return;
+
+                m_block_manager->allocate(sequence, 1, prompt_len);
+                m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
+                // the allocated block could be reused for overwriting, its previous contents are saved first
+                _spill_overwritten_blocks_to_prefix_cache_tiers();
+
+                OPENVINO_ASSERT(_get_prefix_cache_tiers().load(hash, block_data), "Internal error: block is not found in prefix cache tiers");
+                std::vector<size_t> block_indices;
+                for (const auto& layer_blocks : m_block_manager->get_block_tables(seq_id)) {
+                    block_indices.push_back(layer_blocks.back()->get_index());
+                }
+                m_cache_manager->write_block(block_indices, block_data);
+
+                content_len += block_size;
+                ++num_blocks;
+                // the last prompt token is always recomputed to get logits
+                sequence_group->update_processed_tokens_num(content_len == prompt_len ? content_len - 1 : content_len);
+            }
+        }
+    }
+
+    size_t _get_low_priority_sequence_group_id(const std::vector<SequenceGroup::Ptr>& sequence_groups, size_t current_sequence_group_id) const {
+        size_t low_priority_group_idx = std::numeric_limits<size_t>::max();
         for (size_t seq_group_id = 0, num_groups = sequence_groups.size(); seq_group_id < num_groups; ++seq_group_id) {
             size_t group_idx = num_groups - seq_group_id - 1;
             SequenceGroup::CPtr sequence_group = sequence_groups[group_idx];
-            if (sequence_group->get_num_processed_tokens() > 0) {
+            if (sequence_group->get_num_processed_tokens() > 0 && !_is_swapped_out(sequence_group)) {
                 // we are here, because current sequence group has some reserved KV blocks in block manager
                 // which can be freed
-                return group_idx;
+                low_priority_group_idx = group_idx;
+                break;
+            }
+        }
+
+        if (m_scheduling_policy->keeps_arrival_order() || low_priority_group_idx == std::numeric_limits<size_t>::max())
+            return low_priority_group_idx;
+
+        // groups are sorted by the policy, so the last group with KV blocks has the lowest priority;
+        // among groups of the same priority evict the one which is the cheapest to recompute
+        SequenceGroup::CPtr low_priority_group = sequence_groups[low_priority_group_idx];
+        for (size_t group_idx = current_sequence_group_id + 1; group_idx < low_priority_group_idx; ++group_idx) {
+            SequenceGroup::CPtr sequence_group = sequence_groups[group_idx];
+            if (sequence_group->get_num_processed_tokens() > 0 && !_is_swapped_out(sequence_group) &&
+                !m_scheduling_policy->has_higher_priority(sequence_group, low_priority_group) &&
+                sequence_group->get_num_processed_tokens() < sequence_groups[low_priority_group_idx]->get_num_processed_tokens()) {
+                low_priority_group_idx = group_idx;
             }
         }
 
-        return std::numeric_limits<size_t>::max();
+        return low_priority_group_idx;
     }
 
     void _apply_preemption(size_t sequence_group_id, const std::vector<SequenceGroup::Ptr>& sequence_groups) {
@@ -262,14 +613,18 @@ private:
         // check whether current sequence requires a new slot / block
         while (!m_block_manager->can_append_slots(sequence_group)) {
             // let's run a sequence for eviction
-            size_t evicted_sequence_group_id = _get_low_priority_sequence_group_id(sequence_groups);
+            size_t evicted_sequence_group_id = _get_low_priority_sequence_group_id(sequence_groups, sequence_group_id);
 
             if (evicted_sequence_group_id <= sequence_group_id) {
                 // we have a cycle when current group need to evict itself to be in a running state
                 break;
             }
             size_t blocks_needed = m_block_manager->required_blocks_count(sequence_group);
-            if (!_preempt_by_recompute(sequence_groups[evicted_sequence_group_id], blocks_needed)){
+            SequenceGroup::Ptr evicted_sequence_group = sequence_groups[evicted_sequence_group_id];
+            bool preempted = _can_preempt_by_swap(evicted_sequence_group, blocks_needed) ?
+                _preempt_by_swap(evicted_sequence_group) :
+                _preempt_by_recompute(evicted_sequence_group, blocks_needed);
+            if (!preempted) {
                 break;
             }
         }
@@ -286,7 +641,7 @@ private:
 
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
-            if (!sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+            if (!sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled() && !_is_swapped_out(sequence_group)) {
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 // prompt phases can have a single running sequence
                 OPENVINO_ASSERT(num_running_seqs == 1);
@@ -327,7 +682,8 @@ private:
                     // add information to scheduler_output
                     {
                         scheduler_output.m_scheduled_sequence_groups_ids.push_back(sequence_group_id);
-                        scheduler_output.m_block_tables[seq_id] = m_block_manager->get_block_tables(seq_id);
+                        scheduler_output.m_block_tables[seq_id] = &m_block_manager->get_block_tables(seq_id);
+                        scheduler_output.m_block_table_versions[seq_id] = m_block_manager->get_block_table_version(seq_id);
                         scheduler_output.m_total_num_scheduled_tokens += num_scheduled_tokens * num_running_seqs;
 
 
@@ -366,7 +722,7 @@ private:
             // Question: do we need to schedule preeempted first as it's done in vLLM?
             // Answer: preempted sequences have low priority, so they should be after "running" ones. So, here we
             //         keep latencies for sequence groups of high priority
-            if (sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+            if (sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled() && !_is_swapped_out(sequence_group)) {
                 OPENVINO_ASSERT(!sequence_group->has_finished());
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 OPENVINO_ASSERT(num_running_seqs);
@@ -411,7 +767,8 @@ private:
                     for (const auto & seq : sequence_group->get_running_sequences()) {
                         size_t seq_id = seq->get_id();
                         // block tables for each running sequence within a group
-                        scheduler_output.m_block_tables[seq_id] = m_block_manager->get_block_tables(seq_id);
+                        scheduler_output.m_block_tables[seq_id] = &m_block_manager->get_block_tables(seq_id);
+                        scheduler_output.m_block_table_versions[seq_id] = m_block_manager->get_block_table_version(seq_id);
 
                         scheduler_output.m_score_aggregation_windows[seq_id] = _schedule_scores_to_aggregate(sequence_group);
 
@@ -458,7 +815,7 @@ private:
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
             const bool recompute_evicted_sequences = sequence_group->get_num_processed_tokens() == 0 && !m_can_use_partial_preemption;
-            if ((!sequence_group->can_generate_tokens() || recompute_evicted_sequences) && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+            if ((!sequence_group->can_generate_tokens() || recompute_evicted_sequences) && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled() && !_is_swapped_out(sequence_group)) {
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 // prompt phases can have a single running sequence
                 OPENVINO_ASSERT(num_running_seqs == 1);
@@ -503,7 +860,8 @@ private:
                     {
                         scheduler_output.m_scheduled_sequence_groups_ids.push_back(sequence_group_id);
                         uint64_t seq_id = sequence_group->get_running_sequences()[0]->get_id();
-                        scheduler_output.m_block_tables[seq_id] = m_block_manager->get_block_tables(seq_id);
+                        scheduler_output.m_block_tables[seq_id] = &m_block_manager->get_block_tables(seq_id);
+                        scheduler_output.m_block_table_versions[seq_id] = m_block_manager->get_block_table_version(seq_id);
                         scheduler_output.m_total_num_scheduled_tokens += sequence_len;
 
                         scheduler_output.m_score_aggregation_windows[seq_id] = _schedule_scores_to_aggregate(sequence_group);
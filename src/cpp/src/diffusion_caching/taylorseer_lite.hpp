@@ -20,7 +20,9 @@ namespace ov::genai {
  * @brief State management class for TaylorSeer cache mechanism.
  *
  * Maintains Taylor series factors and tracks the last update step to enable
- * prediction of transformer outputs during inference.
+ * prediction of denoiser (UNet or transformer) outputs during inference.
+ * The state doesn't depend on the denoiser, so every image and video generation
+ * pipeline wraps its denoiser inference with infer_or_predict().
  */
 class TaylorSeerState {
 public:
@@ -50,6 +52,10 @@ public:
         OPENVINO_ASSERT(config->cache_interval >= 2,
                        "TaylorSeerCacheConfig: cache_interval must be at least 2, got ",
                        config->cache_interval);
+        OPENVINO_ASSERT(config->order < m_max_num_factors,
+                       "TaylorSeerCacheConfig: order must be at most ", m_max_num_factors - 1, ", got ",
+                       config->order);
+        m_num_factors = config->order + 1;
 
         // Check if TaylorSeer will be effective
         if (config->disable_cache_before_step >= num_inference_steps) {
@@ -93,6 +99,25 @@ public:
         return m_is_active;
     }
 
+    /**
+     * @brief Runs the denoiser at the steps of full computation and predicts its output at the cached ones.
+     * @param current_step The current denoising step index.
+     * @param infer Callable which runs the denoiser inference and returns its output.
+     * @return The denoiser output, computed or predicted.
+     */
+    template <typename Infer>
+    ov::Tensor infer_or_predict(std::size_t current_step, Infer&& infer) {
+        if (m_is_active && !should_compute(current_step)) {
+            return predict(current_step);
+        }
+
+        ov::Tensor output = infer();
+        if (m_is_active) {
+            update(current_step, output);
+        }
+        return output;
+    }
+
     /**
      * @brief Gets the step index when the Taylor factors were last updated.
      * @return The last update step index, or std::nullopt if never updated.
@@ -107,9 +132,9 @@ public:
      * @return The Taylor factor tensor for the specified order.
      */
     const ov::Tensor& get_taylor_factor(std::size_t order) const {
-        OPENVINO_ASSERT(order < m_max_order,
+        OPENVINO_ASSERT(order < m_num_factors,
                 "Requested Taylor factor order ", order,
-                " is out of bounds. Maximum supported order is ", m_max_order - 1, ".");
+                " is out of bounds. Maximum supported order is ", m_num_factors - 1, ".");
         return m_taylor_factors[order];
     }
 
@@ -152,7 +177,7 @@ public:
                            " does not match previous tensor shape ", prev_factor.get_shape());
         }
 
-        std::array<ov::Tensor, m_max_order> new_factors;
+        std::array<ov::Tensor, m_max_num_factors> new_factors;
 
         // Detach factor 0 from potential InferRequest-owned buffer by copying data.
         ov::Tensor detached_output(output.get_element_type(), output.get_shape());
@@ -163,7 +188,7 @@ public:
             const float divisor = 1.0f / static_cast<float>(current_step - *m_last_update_step);
 
             // Compute higher-order Taylor factors using finite differences
-            for (std::size_t order = 1; order < m_max_order; ++order) {
+            for (std::size_t order = 1; order < m_num_factors; ++order) {
                 const auto& curr_factor = new_factors[order - 1];
                 const float* curr_data = curr_factor.data<const float>();
 
@@ -181,7 +206,7 @@ public:
         }
 
         // Update Taylor factors
-        for (std::size_t order = 0; order < m_max_order; ++order) {
+        for (std::size_t order = 0; order < m_num_factors; ++order) {
             m_taylor_factors[order] = std::move(new_factors[order]);
         }
 
@@ -195,13 +220,12 @@ public:
      * @throws ov::Exception if Taylor factors are not yet available for prediction.
      */
     ov::Tensor predict(std::size_t current_step) const {
-        OPENVINO_ASSERT(m_taylor_factors.size() >= m_max_order,
-                       "Insufficient Taylor factors available for prediction. Required: ",
-                       m_max_order, ", Available: ", m_taylor_factors.size());
-
         OPENVINO_ASSERT(m_last_update_step.has_value(),
                        "Cannot predict before first update.");
 
+        OPENVINO_ASSERT(m_taylor_factors[m_num_factors - 1],
+                       "Insufficient Taylor factors available for prediction. Required: ", m_num_factors);
+
         OPENVINO_ASSERT(current_step > *m_last_update_step,
                        "Cannot predict for step ", current_step,
                        " as it is not after the last update step ",
@@ -214,7 +238,7 @@ public:
         ov::Tensor output(base_factor.get_element_type(), base_factor.get_shape());
         base_factor.copy_to(output);
         float* output_data = output.data<float>();
-        for (std::size_t order = 1; order < m_max_order; ++order) {
+        for (std::size_t order = 1; order < m_num_factors; ++order) {
             const float coeff = static_cast<float>(std::pow(step_offset, order));
             const float* factor_data = get_taylor_factor(order).data<const float>();
 
@@ -237,6 +261,7 @@ private:
         m_last_update_step = std::nullopt;
         m_last_prediction_step = std::nullopt;
         m_schedule.clear();
+        m_num_factors = m_max_num_factors;
 
         // Clear Taylor factor tensors
         for (auto& factor : m_taylor_factors) {
@@ -248,7 +273,7 @@ private:
                                 const TaylorSeerCacheConfig& config,
                                 std::size_t num_inference_steps) const {
         // Always compute during warm-up phase and guarantee enough steps to compute Taylor factors
-        if (current_step < std::max(config.disable_cache_before_step, m_max_order)) {
+        if (current_step < std::max(config.disable_cache_before_step, m_num_factors)) {
             return true;
         }
 
@@ -260,7 +285,7 @@ private:
             return true;
         }
 
-        auto offset = current_step - std::max(config.disable_cache_before_step, m_max_order);
+        auto offset = current_step - std::max(config.disable_cache_before_step, m_num_factors);
         auto first_compute_offset = config.cache_interval - 1;
 
         if (offset < first_compute_offset) {
@@ -272,7 +297,7 @@ private:
     }
 
     /**
-     * @brief Number of Taylor series terms to store (base output + derivatives).
+     * @brief Maximum number of Taylor series terms to store (base output + derivatives).
      *
      * Set to 2 to store order-0 (base output) and order-1 (first derivative),
      * enabling first-order Taylor approximation: f(x) ≈ f(x₀) + f'(x₀)·Δx.
@@ -280,13 +305,19 @@ private:
      * the best balance between accuracy, computational efficiency and memory footprint.
      * Higher orders may introduce numerical instability without significant quality gains.
      */
-    static constexpr std::size_t m_max_order = 2;
+    static constexpr std::size_t m_max_num_factors = 2;
+
+    /**
+     * @brief Number of Taylor series terms used by the configured order.
+     * 1 reuses the last computed output at the cached steps, 2 extrapolates it linearly.
+     */
+    std::size_t m_num_factors = m_max_num_factors;
 
     /**
      * @brief Array of Taylor factor tensors indexed by order.
      * Order 0 stores the base output, order 1 stores the first derivative approximation.
      */
-    std::array<ov::Tensor, m_max_order> m_taylor_factors = {};
+    std::array<ov::Tensor, m_max_num_factors> m_taylor_factors = {};
 
     /**
      * @brief The step index when Taylor factors were last updated.
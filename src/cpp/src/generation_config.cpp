@@ -158,6 +158,10 @@ void GenerationConfig::update_generation_config(const ov::AnyMap& properties) {
     // CDPruner
     read_anymap_param(properties, "pruning_ratio", pruning_ratio);
     read_anymap_param(properties, "relevance_weight", relevance_weight);
+
+    // continuous batching scheduling
+    read_anymap_param(properties, "priority", priority);
+    read_anymap_param(properties, "deadline_ms", deadline_ms);
 }
 
 
@@ -3,12 +3,17 @@
 
 #include "gguf_utils/gguf.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <numeric>
 #include <optional>
+#include <sstream>
+
+#include "openvino/core/parallel.hpp"
 
 // https://github.com/antirez/gguf-tools/blob/af7d88d808a7608a33723fba067036202910acb3/gguflib.h#L102-L108
 constexpr int gguf_array_header_size = 12;
@@ -80,15 +85,35 @@ ov::Shape get_shape(const gguf_tensor& tensor) {
     return shape;
 }
 
-ov::Tensor extract_tensor_data(gguf_tensor* tensor) {
+namespace {
+
+using GGUFContext = std::shared_ptr<gguf_ctx>;
+
+// "Allocates" a tensor in place of its data in the memory mapped GGUF file, so that unquantized tensors are used
+// without copying. The file stays mapped while any of such tensors is alive.
+struct MappedTensorAllocator {
+    GGUFContext ctx;
+    void* data;
+
+    void* allocate(const size_t /*bytes*/, const size_t /*alignment*/) {
+        return data;
+    }
+
+    void deallocate(void* /*handle*/, const size_t /*bytes*/, const size_t /*alignment*/) {}
+
+    bool is_equal(const MappedTensorAllocator& other) const {
+        return data == other.data;
+    }
+};
+
+}  // namespace
+
+ov::Tensor extract_tensor_data(const GGUFContext& ctx, gguf_tensor* tensor) {
     std::optional<ov::element::Type> equivalent_dtype = gguf_type_to_dtype(tensor->type);
-    // If there's an equivalent type, we can simply copy.
+    // If there's an equivalent type, we can simply use the data in the file.
     if (equivalent_dtype.has_value()) {
         auto shape = get_shape(*tensor);
-        ov::Tensor weights(equivalent_dtype.value(), shape);
-
-        memcpy(weights.data(), tensor->weights_data, tensor->num_weights * equivalent_dtype.value().size());
-        return weights;
+        return ov::Tensor(equivalent_dtype.value(), shape, ov::Allocator(MappedTensorAllocator{ctx, tensor->weights_data}));
     }
     // Otherwise, we convert to float16.
     // TODO: Add other dequantization options.
@@ -263,11 +288,23 @@ std::unordered_map<std::string, GGUFMetaData> load_metadata(gguf_ctx* ctx) {
     return metadata;
 }
 
-void load_arrays(gguf_ctx* ctx,
-                 std::unordered_map<std::string, ov::Tensor>& array_map,
-                 std::unordered_map<std::string, gguf_tensor_type>& qtype_map) {
+std::vector<gguf_tensor> read_tensor_infos(gguf_ctx* ctx) {
+    std::vector<gguf_tensor> tensors;
     gguf_tensor tensor;
+    while (gguf_get_tensor(ctx, &tensor)) {
+        tensors.push_back(tensor);
+    }
+    return tensors;
+}
+
+bool is_quantized(const gguf_tensor& tensor) {
+    return tensor.type == GGUF_TYPE_Q4_0 || tensor.type == GGUF_TYPE_Q4_1 || tensor.type == GGUF_TYPE_Q8_0 ||
+           tensor.type == GGUF_TYPE_Q4_K || tensor.type == GGUF_TYPE_Q6_K;
+}
 
+void load_arrays(const std::vector<std::pair<GGUFContext, gguf_tensor>>& tensors,
+                 std::unordered_map<std::string, ov::Tensor>& array_map,
+                 std::unordered_map<std::string, gguf_tensor_type>& qtype_map) {
     auto check_insert = [](const auto& inserted) {
         OPENVINO_ASSERT(inserted.second,
                         "[load_gguf] Duplicate parameter name '",
@@ -275,19 +312,28 @@ void load_arrays(gguf_ctx* ctx,
                         "'. This can happen when loading quantized tensors.");
     };
 
-    while (gguf_get_tensor(ctx, &tensor)) {
-        if (tensor.type == GGUF_TYPE_Q4_0 || tensor.type == GGUF_TYPE_Q4_1 || tensor.type == GGUF_TYPE_Q8_0 ||
-            tensor.type == GGUF_TYPE_Q4_K || tensor.type == GGUF_TYPE_Q6_K) {
-            gguf_load_quantized(array_map, qtype_map, tensor);
+    // tensors are unpacked in parallel to separate maps, which are merged afterwards
+    std::vector<std::unordered_map<std::string, ov::Tensor>> tensor_arrays(tensors.size());
+    std::vector<std::unordered_map<std::string, gguf_tensor_type>> tensor_qtypes(tensors.size());
+    ov::parallel_for(tensors.size(), [&](size_t i) {
+        gguf_tensor tensor = tensors[i].second;
+        if (is_quantized(tensor)) {
+            gguf_load_quantized(tensor_arrays[i], tensor_qtypes[i], tensor);
         } else {
             std::string name(tensor.name, tensor.namelen);
-            ov::Tensor loaded_array = extract_tensor_data(&tensor);
-            check_insert(array_map.emplace(name, loaded_array));
+            tensor_arrays[i].emplace(name, extract_tensor_data(tensors[i].first, &tensor));
 
             constexpr std::string_view weight_suffix = ".weight";
             const std::string name_prefix = name.substr(0, name.length() - weight_suffix.length());
-            qtype_map.emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(tensor.type));
+            tensor_qtypes[i].emplace(name_prefix + ".qtype", static_cast<gguf_tensor_type>(tensor.type));
         }
+    });
+
+    for (size_t i = 0; i < tensors.size(); ++i) {
+        for (auto& [name, array] : tensor_arrays[i]) {
+            check_insert(array_map.emplace(name, std::move(array)));
+        }
+        qtype_map.insert(tensor_qtypes[i].begin(), tensor_qtypes[i].end());
     }
 }
 
@@ -319,43 +365,97 @@ std::vector<std::string> get_all_files(std::string file, int total_num) {
     return files;
 }
 
+GGUFContext open_gguf(const std::string& file) {
+    check_file(file);
+    GGUFContext ctx(gguf_open(file.data()), gguf_close);
+    OPENVINO_ASSERT(ctx, "Failed to open '", file, "' with gguf_open");
+    return ctx;
+}
+
+// Returns contexts of all files of a model given its first (or single) file context with already loaded metadata.
+// Metadata of the other files is skipped, so that all the contexts point to tensor infos.
+std::vector<GGUFContext> open_split_files(const std::string& file,
+                                          const std::unordered_map<std::string, GGUFMetaData>& metadata,
+                                          const GGUFContext& ctx) {
+    std::vector<GGUFContext> contexts{ctx};
+
+    std::string split_flag = "split.count";
+    auto it = metadata.find(split_flag);
+    if (it == metadata.end()) {  // single GGUF file
+        return contexts;
+    }
+
+    auto total_num_tensor = std::get<ov::Tensor>(it->second);
+    int total_num = *(total_num_tensor.data<ov::element_type_traits<ov::element::u16>::value_type>());
+
+    std::vector<std::string> files = get_all_files(file, total_num);
+    for (size_t i = 1; i < files.size(); i++) {
+        contexts.push_back(open_gguf(files.at(i)));
+        load_metadata(contexts.back().get());
+    }
+    return contexts;
+}
+
+uint64_t hash_bytes(uint64_t hash, const void* data, size_t size) {
+    // FNV-1a
+    auto bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
 GGUFLoad get_gguf_data(const std::string& file) {
     std::unordered_map<std::string, ov::Tensor> arrays;
     std::unordered_map<std::string, gguf_tensor_type> qtype;
 
-    check_file(file);
-
-    std::unique_ptr<gguf_ctx, decltype(&gguf_close)> ctx(gguf_open(file.data()), gguf_close);
-    OPENVINO_ASSERT(ctx, "Failed to open '", file, "' with gguf_open");
+    auto ctx = open_gguf(file);
 
     // get main config from first file or single file
     auto metadata = load_metadata(ctx.get());
 
-    std::string split_flag = "split.count";
-    auto it = metadata.find(split_flag);
-
-    if (it == metadata.end())  // single GGUF file
-    {
-        load_arrays(ctx.get(), arrays, qtype);
-        return {metadata, arrays, qtype};
-    } else  // multi GGUF files
-    {
-        auto total_num_tensor = std::get<ov::Tensor>(metadata.at(split_flag));
-        int total_num = *(total_num_tensor.data<ov::element_type_traits<ov::element::u16>::value_type>());
+    // tensor infos of all files are collected first to unpack all the tensors at once
+    std::vector<std::pair<GGUFContext, gguf_tensor>> tensors;
+    for (const auto& file_ctx : open_split_files(file, metadata, ctx)) {
+        for (const auto& tensor : read_tensor_infos(file_ctx.get())) {
+            tensors.emplace_back(file_ctx, tensor);
+        }
+    }
+    load_arrays(tensors, arrays, qtype);
+    return {metadata, arrays, qtype};
+}
 
-        std::vector<std::string> files = get_all_files(file, total_num);
+std::unordered_map<std::string, GGUFMetaData> get_gguf_metadata(const std::string& file) {
+    auto ctx = open_gguf(file);
+    return load_metadata(ctx.get());
+}
 
-        for (size_t i = 1; i < files.size(); i++) {
-            std::unique_ptr<gguf_ctx, decltype(&gguf_close)> ctx_i(gguf_open(files.at(i).data()), gguf_close);
-            OPENVINO_ASSERT(ctx_i, "Failed to open '", files.at(i), "' with gguf_open");
+std::string get_gguf_fingerprint(const std::string& file) {
+    // Hashing all tensors would take about as long as loading them, so the fingerprint is built from metadata and
+    // tensor infos of all files together with a few pages of data of each tensor
+    constexpr size_t tensor_sample_size = 4096;
 
-            auto metadata_tmp = load_metadata(ctx_i.get());
+    auto ctx = open_gguf(file);
+    auto metadata = load_metadata(ctx.get());
 
-            load_arrays(ctx_i.get(), arrays, qtype);
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const auto& file_ctx : open_split_files(file, metadata, ctx)) {
+        auto tensors = read_tensor_infos(file_ctx.get());
+        // after reading tensor infos the offset points to the end of the file header
+        hash = hash_bytes(hash, file_ctx->data, file_ctx->off);
+        hash = hash_bytes(hash, &file_ctx->size, sizeof(file_ctx->size));
+        for (const auto& tensor : tensors) {
+            const size_t sample_size = std::min<size_t>(tensor.bsize, tensor_sample_size);
+            const auto data = static_cast<const uint8_t*>(static_cast<const void*>(tensor.weights_data));
+            hash = hash_bytes(hash, data, sample_size);
+            hash = hash_bytes(hash, data + (tensor.bsize - sample_size) / 2, sample_size);
+            hash = hash_bytes(hash, data + tensor.bsize - sample_size, sample_size);
         }
-        load_arrays(ctx.get(), arrays, qtype);
-        return {metadata, arrays, qtype};
     }
+
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return ss.str();
 }
 
 float metadata_to_float(const std::unordered_map<std::string, GGUFMetaData>& metadata, const std::string& key) {
@@ -42,3 +42,11 @@ std::tuple<std::map<std::string, GGUFMetaData>,
 load_gguf(const std::string& file);
 
 GGUFLoad get_gguf_data(const std::string& file);
+
+std::unordered_map<std::string, GGUFMetaData> get_gguf_metadata(const std::string& file);
+
+// Returns a key which identifies the content of a GGUF model (including all its split files) for caching
+std::string get_gguf_fingerprint(const std::string& file);
+
+// FNV-1a hash of the bytes, continuing from a given hash value
+uint64_t hash_bytes(uint64_t hash, const void* data, size_t size);
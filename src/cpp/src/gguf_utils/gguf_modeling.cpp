@@ -6,14 +6,20 @@
 #include <string>
 #include <iostream>
 #include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <random>
+#include <sstream>
 #include <stdexcept>
 
 #include <openvino/openvino.hpp>
 #include "openvino/runtime/core.hpp"
 #include "openvino/opsets/opset13.hpp"
+#include "openvino/genai/version.hpp"
 
 #include "gguf_utils/building_blocks.hpp"
 #include "gguf_utils/gguf_modeling.hpp"
+#include "logger.hpp"
 #include "utils.hpp"
 
 using namespace ov;
@@ -136,40 +142,92 @@ std::shared_ptr<ov::Model> create_language_model(
     return model;
 }
 
+void save_to_cache(const std::shared_ptr<ov::Model>& model, const std::filesystem::path& cached_model_path) {
+    // The model is saved under a temporary name first, so that another process never reads a partially written model.
+    // The xml file is renamed last, since its existence marks the cached model as complete.
+    std::random_device random_device;
+    const std::string tmp_suffix = "." + std::to_string(random_device()) + ".tmp";
+    std::filesystem::path tmp_model_path = cached_model_path;
+    tmp_model_path.replace_extension(tmp_suffix + ".xml");
+    std::filesystem::path tmp_weights_path = cached_model_path;
+    tmp_weights_path.replace_extension(tmp_suffix + ".bin");
+    try {
+        std::filesystem::create_directories(cached_model_path.parent_path());
+        ov::genai::utils::save_openvino_model(model, tmp_model_path.string(), false);
+        std::filesystem::rename(tmp_weights_path, std::filesystem::path(cached_model_path).replace_extension(".bin"));
+        std::filesystem::rename(tmp_model_path, cached_model_path);
+    } catch (const std::exception& e) {
+        std::error_code ec;
+        std::filesystem::remove(tmp_model_path, ec);
+        std::filesystem::remove(tmp_weights_path, ec);
+        GENAI_WARN("Failed to cache OpenVINO model generated from GGUF model to " + cached_model_path.string() + ": " + e.what());
+    }
+}
+
 } // namespace
 
-std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path, const bool enable_save_ov_model) {
-    auto start_time = std::chrono::high_resolution_clock::now();
+std::filesystem::path get_gguf_cache_path(const std::string& model_path, const std::filesystem::path& cache_dir) {
+    // a model cached by another version may be generated differently or be serialized in an incompatible way
+    const std::string versions = std::string(ov::genai::get_version().buildNumber) + "|" + ov::get_openvino_version().buildNumber;
+    const uint64_t versions_hash = hash_bytes(0xcbf29ce484222325ULL, versions.data(), versions.size());
+
     std::stringstream ss;
-    ss << "Loading and unpacking model from: " << model_path;
-    ov::genai::utils::print_gguf_debug_info(ss.str());
-    auto [config, consts, qtypes] = load_gguf(model_path);
-    auto load_finish_time = std::chrono::high_resolution_clock::now();
+    ss << "gguf_" << get_gguf_fingerprint(model_path) << "_" << std::hex << std::setw(16) << std::setfill('0') << versions_hash << ".xml";
+    return cache_dir / ss.str();
+}
 
-    ss.str("");
-    ss << "Loading and unpacking model done. Time: " << std::chrono::duration_cast<std::chrono::milliseconds>(load_finish_time - start_time).count() << "ms";
-    ov::genai::utils::print_gguf_debug_info(ss.str());
+std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path,
+                                            const bool enable_save_ov_model,
+                                            const std::optional<std::filesystem::path>& cache_dir) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::stringstream ss;
 
     std::shared_ptr<ov::Model> model;
-    const std::string model_arch = std::get<std::string>(config.at("architecture"));
-    ss.str("");
-    ss << "Start generating OpenVINO model...";
-    ov::genai::utils::print_gguf_debug_info(ss.str());
-    if (!model_arch.compare("llama") || !model_arch.compare("qwen2") || !model_arch.compare("qwen3")) {
-        model = create_language_model(config, consts, qtypes);
-        if (enable_save_ov_model){
-            std::filesystem::path gguf_model_path(model_path);
-            std::filesystem::path save_path = gguf_model_path.parent_path() / "openvino_model.xml";
-            ov::genai::utils::save_openvino_model(model, save_path.string(), true);
+    std::optional<std::filesystem::path> cached_model_path;
+    if (cache_dir) {
+        cached_model_path = get_gguf_cache_path(model_path, *cache_dir);
+        if (std::filesystem::exists(*cached_model_path)) {
+            model = ov::genai::utils::singleton_core().read_model(cached_model_path->string());
+            ss << "Read cached OpenVINO model from: " << cached_model_path->string() << ". Time: "
+               << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start_time).count() << "ms";
+            ov::genai::utils::print_gguf_debug_info(ss.str());
+        }
+    }
+
+    if (!model) {
+        ss << "Loading and unpacking model from: " << model_path;
+        ov::genai::utils::print_gguf_debug_info(ss.str());
+        auto [config, consts, qtypes] = load_gguf(model_path);
+        auto load_finish_time = std::chrono::high_resolution_clock::now();
+
+        ss.str("");
+        ss << "Loading and unpacking model done. Time: " << std::chrono::duration_cast<std::chrono::milliseconds>(load_finish_time - start_time).count() << "ms";
+        ov::genai::utils::print_gguf_debug_info(ss.str());
+
+        const std::string model_arch = std::get<std::string>(config.at("architecture"));
+        ss.str("");
+        ss << "Start generating OpenVINO model...";
+        ov::genai::utils::print_gguf_debug_info(ss.str());
+        if (!model_arch.compare("llama") || !model_arch.compare("qwen2") || !model_arch.compare("qwen3")) {
+            model = create_language_model(config, consts, qtypes);
+        } else {
+            OPENVINO_THROW("Unsupported model architecture '", model_arch, "'");
         }
-    } else {
-        OPENVINO_THROW("Unsupported model architecture '", model_arch, "'");
+        if (cached_model_path) {
+            save_to_cache(model, *cached_model_path);
+        }
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - load_finish_time).count();
+        ss.str("");
+        ss << "Model generation done. Time: " << duration << "ms";
+        ov::genai::utils::print_gguf_debug_info(ss.str());
+    }
+
+    if (enable_save_ov_model) {
+        std::filesystem::path gguf_model_path(model_path);
+        std::filesystem::path save_path = gguf_model_path.parent_path() / "openvino_model.xml";
+        ov::genai::utils::save_openvino_model(model, save_path.string(), true);
     }
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::high_resolution_clock::now() - load_finish_time).count();
-    ss.str("");
-    ss << "Model generation done. Time: " << duration << "ms";
-    ov::genai::utils::print_gguf_debug_info(ss.str());
 
     return model;
 }
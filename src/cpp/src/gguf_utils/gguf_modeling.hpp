@@ -4,7 +4,24 @@
 #pragma once
 
 #include <cstring>
+#include <filesystem>
+#include <optional>
 
 #include "openvino/openvino.hpp"
 
-std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path, const bool enable_save_ov_model);
+/**
+ * Creates OpenVINO model from a GGUF model.
+ * @param model_path Path to the GGUF model, or the first of its files if the model is split.
+ * @param enable_save_ov_model Whether to save the created model next to the GGUF model.
+ * @param cache_dir Optional directory to cache the created model in. The cached model is keyed by GGUF content and is
+ * read instead of creating the model again.
+ */
+std::shared_ptr<ov::Model> create_from_gguf(const std::string& model_path,
+                                            const bool enable_save_ov_model,
+                                            const std::optional<std::filesystem::path>& cache_dir = std::nullopt);
+
+/**
+ * Returns the path of the OpenVINO model created from a GGUF model in a cache directory. The name is keyed by the GGUF
+ * content and by the versions of OpenVINO GenAI and OpenVINO, which generate and serialize the model.
+ */
+std::filesystem::path get_gguf_cache_path(const std::string& model_path, const std::filesystem::path& cache_dir);
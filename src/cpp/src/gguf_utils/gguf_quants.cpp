@@ -12,17 +12,13 @@
 
 using namespace std;
 
-void unpack_32_4(uint8_t* data, uint8_t* dst) {
-    std::fill_n(dst, 16, 0);
-    for (int j = 0; j < 16; ++j) {
-        uint8_t x = (data[j] & 0x0F);
-        uint8_t y = (data[j] >> 4);
-        if (j % 2 != 0) {
-            x <<= 4;
-            y <<= 4;
-        }
-        dst[j / 2] |= x;
-        dst[8 + j / 2] |= y;  // Last 16 weights are in the higher bits
+// Repacks 32 4-bit weights from GGUF order, where the byte j keeps weights j and j + 16, to the sequential order.
+// The loop is branch-free, so that compilers vectorize it.
+void unpack_32_4(const uint8_t* data, uint8_t* dst) {
+    for (int j = 0; j < 8; ++j) {
+        const uint8_t even = data[2 * j], odd = data[2 * j + 1];
+        dst[j] = (even & 0x0F) | (odd << 4);
+        dst[8 + j] = (even >> 4) | (odd & 0xF0);  // Last 16 weights are in the higher bits
     }
 }
 
@@ -75,34 +71,26 @@ void extract_q8_0_data(const gguf_tensor& tensor,
     auto weights = static_cast<uint8_t*>(weights_arr.data());
     auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
     auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
-    for (int64_t i = 0; i < scales_arr.get_size(); i++) {
+    ov::parallel_for(scales_arr.get_size(), [&](size_t i) {
         uint8_t* block_data = data + i * bytes_per_block;
         scales[i] = ov::float16::from_bits(*(uint16_t*)block_data);
         biases[i] = ov::float16(-128.f * static_cast<float>(scales[i]));
-        for (int64_t j = 0; j < weights_per_block; ++j) {
+        for (uint64_t j = 0; j < weights_per_block; ++j) {
             uint8_t x = block_data[j + 2];  // j+2 to skip the scale bytes.
             // Original data is in int8_t, so we add a bias of -128 and invert the
             // first bit.
             x ^= 1 << 7;
             weights[i * weights_per_block + j] = x;
         }
-    }
+    });
 }
 
 void unpack_256_4(const uint8_t* data, uint8_t* dst) {
-    // Initialize the output array with zeros
-    std::fill_n(dst, 128, 0);
-
     for (size_t i = 0; i < 4; ++i) {
-        for (int j = 0; j < 32; ++j) {
-            uint8_t x = (data[i * 32 + j] & 0x0F);
-            uint8_t y = (data[i * 32 + j] >> 4);
-            if (j % 2 != 0) {
-                x <<= 4;
-                y <<= 4;
-            }
-            dst[i * 32 + j / 2] |= x;
-            dst[i * 32 + 16 + j / 2] |= y;  // Last 16 weights are in the higher bits
+        for (int j = 0; j < 16; ++j) {
+            const uint8_t even = data[i * 32 + 2 * j], odd = data[i * 32 + 2 * j + 1];
+            dst[i * 32 + j] = (even & 0x0F) | (odd << 4);
+            dst[i * 32 + 16 + j] = (even >> 4) | (odd & 0xF0);  // Last 16 weights are in the higher bits
         }
     }
 }
@@ -168,8 +156,7 @@ void extract_q6_k_data(const gguf_tensor& tensor,
     auto weights = static_cast<uint8_t*>(weights_arr.data());
     auto scales = scales_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
     auto biases = biases_arr.data<ov::element_type_traits<ov::element::f16>::value_type>();
-    // std::string name(tensor.name, tensor.namelen);
-    for (int64_t i = 0; i < n_super_block; i++) {
+    ov::parallel_for(n_super_block, [&](size_t i) {
         uint8_t* block_data = data + i * bytes_per_block;
 
         float scale_factor =
@@ -196,7 +183,7 @@ void extract_q6_k_data(const gguf_tensor& tensor,
             weights[i * 256 + j + 192] = (ql[64 + j] >> 4) | (((qh[32 + j] >> 4) & 3) << 4);
             weights[i * 256 + j + 224] = (ql[96 + j] >> 4) | (((qh[32 + j] >> 6) & 3) << 4);
         }
-    }
+    });
 }
 
 void gguf_load_quantized(std::unordered_map<std::string, ov::Tensor>& a,
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <filesystem>
 #include <fstream>
@@ -11,6 +12,7 @@
 #include "image_generation/schedulers/ischeduler.hpp"
 #include "image_generation/numpy_utils.hpp"
 #include "image_generation/image_processor.hpp"
+#include "image_generation/text_encoder_cache.hpp"
 
 #include "openvino/genai/image_generation/generation_config.hpp"
 #include "openvino/genai/image_generation/autoencoder_kl.hpp"
@@ -67,6 +69,9 @@ enum class PipelineType {
 
 class DiffusionPipeline {
 public:
+    // inputs of the denoiser computed from prompts by text encoders, keyed by their names
+    using HiddenStates = std::map<std::string, ov::Tensor>;
+
     explicit DiffusionPipeline(PipelineType pipeline_type) : m_pipeline_type(pipeline_type) {
         // TODO: support GPU as well
         const std::string device = "CPU";
@@ -151,6 +156,53 @@ protected:
 
     virtual size_t get_config_in_channels() const = 0;
 
+    virtual void compute_dim(int64_t& generation_config_value, ov::Tensor initial_image, int dim_idx) = 0;
+
+    // passes hidden states to the denoiser model
+    virtual void set_denoiser_hidden_states(const std::string& name, ov::Tensor hidden_states) = 0;
+
+    // called by compute_hidden_states() implementations, the hidden states are passed to the denoiser unless they are
+    // recorded by record_hidden_states()
+    void set_hidden_states(const std::string& name, ov::Tensor hidden_states) {
+        if (m_recorded_hidden_states == nullptr) {
+            set_denoiser_hidden_states(name, hidden_states);
+            return;
+        }
+        // outputs of text encoders are overwritten by their next inference
+        ov::Tensor recorded(hidden_states.get_element_type(), hidden_states.get_shape());
+        hidden_states.copy_to(recorded);
+        (*m_recorded_hidden_states)[name] = recorded;
+    }
+
+    /**
+     * @brief Runs text encoders and returns the hidden states instead of passing them to the denoiser, so that prompts
+     * are encoded by a clone of the pipeline while this one denoises another request.
+     * @param generation_config generation config whose height and width are already computed
+     */
+    HiddenStates record_hidden_states(const std::string& positive_prompt, const ImageGenerationConfig& generation_config) {
+        HiddenStates hidden_states;
+        m_recorded_hidden_states = &hidden_states;
+        try {
+            compute_hidden_states(positive_prompt, generation_config);
+        } catch (...) {
+            m_recorded_hidden_states = nullptr;
+            throw;
+        }
+        m_recorded_hidden_states = nullptr;
+        return hidden_states;
+    }
+
+    // called by generate() implementations instead of compute_hidden_states() to use precomputed hidden states if any
+    void prepare_hidden_states(const std::string& positive_prompt, const ImageGenerationConfig& generation_config) {
+        if (!m_precomputed_hidden_states) {
+            compute_hidden_states(positive_prompt, generation_config);
+            return;
+        }
+        for (const auto& [name, hidden_states] : *m_precomputed_hidden_states) {
+            set_denoiser_hidden_states(name, hidden_states);
+        }
+    }
+
     virtual void blend_latents(ov::Tensor image_latent, ov::Tensor noise, ov::Tensor mask, ov::Tensor latent, size_t inference_step) {
         OPENVINO_ASSERT(m_pipeline_type == PipelineType::INPAINTING, "'blend_latents' can be called for inpainting pipeline only");
         OPENVINO_ASSERT(image_latent.get_shape() == latent.get_shape(), "Shapes for current", latent.get_shape(), "and initial image latents ", image_latent.get_shape(), " must match");
@@ -241,6 +293,14 @@ protected:
     std::shared_ptr<AutoencoderKL> m_vae = nullptr;
     std::shared_ptr<IImageProcessor> m_image_processor = nullptr, m_mask_processor_rgb = nullptr, m_mask_processor_gray = nullptr;
     std::shared_ptr<ImageResizer> m_image_resizer = nullptr, m_mask_resizer = nullptr;
+
+    // hidden states of the next generate() call computed by record_hidden_states() of a pipeline clone
+    std::optional<HiddenStates> m_precomputed_hidden_states;
+    HiddenStates* m_recorded_hidden_states = nullptr;
+    // makes generate() return denoised latents ready for the VAE decoder instead of decoded images
+    bool m_output_latents = false;
+
+    friend class PipelinedGenerationEngine;
 };
 
 } // namespace genai
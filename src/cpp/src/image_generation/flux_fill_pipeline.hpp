@@ -134,6 +134,7 @@ public:
             compute_dim(m_custom_generation_config.width, initial_image, 2 /* assume NHWC */);
 
         check_inputs(m_custom_generation_config, initial_image);
+        m_vae->set_tiling_config(m_custom_generation_config.vae_tiling_config);
 
         // use callback if defined
         std::shared_ptr<ThreadedCallbackWrapper> callback_ptr = nullptr;
@@ -143,7 +144,7 @@ public:
             callback_ptr->start();
         }
 
-        compute_hidden_states(positive_prompt, m_custom_generation_config);
+        prepare_hidden_states(positive_prompt, m_custom_generation_config);
 
         // Prepare latent variables
         ov::Tensor latents, processed_image, image_latent, noise;
@@ -165,13 +166,18 @@ public:
         ov::Tensor timestep(ov::element::f32, {1});
         float * timestep_data = timestep.data<float>();
 
+        // Initialize TaylorSeer if configured
+        TaylorSeerState ts_state(m_custom_generation_config.taylorseer_config, timesteps.size());
+
         for (size_t inference_step = 0; inference_step < timesteps.size(); ++inference_step) {
             auto step_start = std::chrono::steady_clock::now();
             timestep_data[0] = timesteps[inference_step] / 1000.0f;
 
             ov::Tensor latents_input = numpy_utils::concat(latents, masked_image_latent_input, 2);
             auto infer_start = std::chrono::steady_clock::now();
-            ov::Tensor noise_pred_tensor = m_transformer->infer(latents_input, timestep);
+            ov::Tensor noise_pred_tensor = ts_state.infer_or_predict(inference_step, [&] {
+                return m_transformer->infer(latents_input, timestep);
+            });
             auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
             m_perf_metrics.raw_metrics.transformer_inference_durations.emplace_back(MicroSeconds(infer_duration));
 
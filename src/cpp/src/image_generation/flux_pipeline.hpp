@@ -306,11 +306,13 @@ public:
         m_clip_text_encoder->infer(positive_prompt, {}, false);
         auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
         m_perf_metrics.encoder_inference_duration["text_encoder"] = infer_duration;
+        add_text_encoder_cache_stats(m_perf_metrics, *m_clip_text_encoder);
         ov::Tensor pooled_prompt_embeds = m_clip_text_encoder->get_output_tensor(1);
         infer_start = std::chrono::steady_clock::now();
         ov::Tensor prompt_embeds = m_t5_text_encoder->infer(prompt_2_str, "", false, generation_config.max_sequence_length);
         infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
         m_perf_metrics.encoder_inference_duration["text_encoder_2"] = infer_duration;
+        add_text_encoder_cache_stats(m_perf_metrics, *m_t5_text_encoder);
 
         pooled_prompt_embeds = numpy_utils::repeat(pooled_prompt_embeds, generation_config.num_images_per_prompt);
         prompt_embeds = numpy_utils::repeat(prompt_embeds, generation_config.num_images_per_prompt);
@@ -330,13 +332,13 @@ public:
         if (m_transformer->get_config().guidance_embeds) {
             ov::Tensor guidance = ov::Tensor(ov::element::f32, {generation_config.num_images_per_prompt});
             std::fill_n(guidance.data<float>(), guidance.get_size(), static_cast<float>(generation_config.guidance_scale));
-            m_transformer->set_hidden_states("guidance", guidance);
+            set_hidden_states("guidance", guidance);
         }
 
-        m_transformer->set_hidden_states("pooled_projections", pooled_prompt_embeds);
-        m_transformer->set_hidden_states("encoder_hidden_states", prompt_embeds);
-        m_transformer->set_hidden_states("txt_ids", text_ids);
-        m_transformer->set_hidden_states("img_ids", latent_image_ids);
+        set_hidden_states("pooled_projections", pooled_prompt_embeds);
+        set_hidden_states("encoder_hidden_states", prompt_embeds);
+        set_hidden_states("txt_ids", text_ids);
+        set_hidden_states("img_ids", latent_image_ids);
     }
 
     std::tuple<ov::Tensor, ov::Tensor, ov::Tensor, ov::Tensor> prepare_latents(ov::Tensor initial_image, const ImageGenerationConfig& generation_config) override {
@@ -476,6 +478,7 @@ public:
         check_inputs(m_custom_generation_config, initial_image);
 
         set_lora_adapters(m_custom_generation_config.adapters);
+        m_vae->set_tiling_config(m_custom_generation_config.vae_tiling_config);
 
         // use callback if defined
         std::shared_ptr<ThreadedCallbackWrapper> callback_ptr = nullptr;
@@ -485,7 +488,7 @@ public:
             callback_ptr->start();
         }
 
-        compute_hidden_states(positive_prompt, m_custom_generation_config);
+        prepare_hidden_states(positive_prompt, m_custom_generation_config);
 
         size_t image_seq_len = (m_custom_generation_config.height / vae_scale_factor / 2) *
                                (m_custom_generation_config.width / vae_scale_factor / 2);
@@ -518,16 +521,10 @@ public:
 
             auto infer_start = std::chrono::steady_clock::now();
 
-            ov::Tensor noise_pred_tensor;
-            // Use TaylorSeer if enabled and caching is appropriate
-            if (ts_state.is_active() && !ts_state.should_compute(inference_step)) {
-                noise_pred_tensor = ts_state.predict(inference_step);
-            } else {
-                noise_pred_tensor = m_transformer->infer(latents, timestep);
-                if (ts_state.is_active()) {
-                    ts_state.update(inference_step, noise_pred_tensor);
-                }
-            }
+            // Use TaylorSeer prediction if enabled and caching is appropriate
+            ov::Tensor noise_pred_tensor = ts_state.infer_or_predict(inference_step, [&] {
+                return m_transformer->infer(latents, timestep);
+            });
 
             auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
             m_perf_metrics.raw_metrics.transformer_inference_durations.emplace_back(MicroSeconds(infer_duration));
@@ -560,6 +557,11 @@ public:
         }
 
         latents = unpack_latents(latents, m_custom_generation_config.height, m_custom_generation_config.width, vae_scale_factor);
+        if (m_output_latents) {
+            m_perf_metrics.generate_duration =
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - gen_start).count();
+            return latents;
+        }
         const auto decode_start = std::chrono::steady_clock::now();
         auto image = m_vae->decode(latents);
         m_perf_metrics.vae_decoder_inference_duration =
@@ -587,7 +589,11 @@ protected:
     explicit FluxPipeline(PipelineType pipeline_type) :
         DiffusionPipeline(pipeline_type) {}
 
-    void compute_dim(int64_t & generation_config_value, ov::Tensor initial_image, int dim_idx) {
+    void set_denoiser_hidden_states(const std::string& name, ov::Tensor hidden_states) override {
+        m_transformer->set_hidden_states(name, hidden_states);
+    }
+
+    void compute_dim(int64_t & generation_config_value, ov::Tensor initial_image, int dim_idx) override {
         const size_t vae_scale_factor = m_vae->get_vae_scale_factor();
         const auto& transformer_config = m_transformer->get_config();
 
@@ -67,6 +67,7 @@ void ImageGenerationConfig::update_generation_config(const ov::AnyMap& propertie
     read_anymap_param(properties, "adapters", adapters);
     read_anymap_param(properties, "max_sequence_length", max_sequence_length);
     read_anymap_param(properties, "taylorseer_config", taylorseer_config);
+    read_anymap_param(properties, "vae_tiling_config", vae_tiling_config);
 
     // 'generator' has higher priority than 'seed' parameter
     const bool have_generator_param = properties.find(ov::genai::generator.name()) != properties.end();
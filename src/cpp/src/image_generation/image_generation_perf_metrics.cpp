@@ -39,6 +39,8 @@ void ImageGenerationPerfMetrics::clean_up() {
     generate_duration = 0.f;
     vae_encoder_inference_duration = 0.f;
     vae_decoder_inference_duration = 0.f;
+    text_encoder_cache_hits = 0;
+    text_encoder_cache_misses = 0;
     encoder_inference_duration.clear();
     raw_metrics.unet_inference_durations.clear();
     raw_metrics.transformer_inference_durations.clear();
@@ -18,6 +18,7 @@
 
 #include "json_utils.hpp"
 #include "lora/helper.hpp"
+#include "image_generation/vae_tiling.hpp"
 
 namespace ov {
 namespace genai {
@@ -85,6 +86,25 @@ ov::AnyMap handle_scale_factor(std::shared_ptr<ov::Model> model, const std::stri
     return properties;
 }
 
+VAETilingParams get_tiling_params(const VAETilingConfig& tiling_config, size_t vae_scale_factor, bool is_decoder) {
+    VAETilingParams params;
+    if (is_decoder) {
+        // tiles of latent produce image tiles of tiling_config.tile_size pixels
+        params.tile_size = {1, tiling_config.tile_size / vae_scale_factor, tiling_config.tile_size / vae_scale_factor};
+        params.overlap = {0, tiling_config.tile_overlap / vae_scale_factor, tiling_config.tile_overlap / vae_scale_factor};
+        params.spatial_scale_num = vae_scale_factor;
+    } else {
+        // image tiles are aligned to the latent grid
+        const size_t tile_size = tiling_config.tile_size / vae_scale_factor * vae_scale_factor;
+        params.tile_size = {1, tile_size, tile_size};
+        params.overlap = {0, tiling_config.tile_overlap, tiling_config.tile_overlap};
+        params.alignment = vae_scale_factor;
+        params.spatial_scale_den = vae_scale_factor;
+        params.channels_last = false;
+    }
+    return params;
+}
+
 } // namespace
 
 size_t get_vae_scale_factor(const std::filesystem::path& vae_config_path) {
@@ -199,6 +219,8 @@ AutoencoderKL AutoencoderKL::clone() {
     OPENVINO_ASSERT((m_decoder_model != nullptr) ^ static_cast<bool>(m_decoder_request), "AutoencoderKL must have exactly one of m_decoder_model or m_decoder_request initialized");  // encoder is optional
 
     AutoencoderKL cloned = *this;
+    cloned.m_encoder_tile_requests.clear();
+    cloned.m_decoder_tile_requests.clear();
 
     // Required, decoder model
     if (m_decoder_model) {
@@ -272,6 +294,11 @@ AutoencoderKL& AutoencoderKL::compile(const std::string& device, const ov::AnyMa
 ov::Tensor AutoencoderKL::decode(ov::Tensor latent) {
     OPENVINO_ASSERT(m_decoder_request, "VAE decoder model must be compiled first. Cannot infer non-compiled model");
 
+    if (m_tiling_config) {
+        init_tile_infer_requests(m_decoder_tile_requests, m_decoder_request, m_tiling_config->num_infer_requests);
+        return infer_tiled(m_decoder_tile_requests, latent, get_tiling_params(*m_tiling_config, get_vae_scale_factor(), true));
+    }
+
     m_decoder_request.set_input_tensor(latent);
     m_decoder_request.infer();
     return m_decoder_request.get_output_tensor();
@@ -281,10 +308,15 @@ ov::Tensor AutoencoderKL::encode(ov::Tensor image, std::shared_ptr<Generator> ge
     OPENVINO_ASSERT(m_encoder_request || m_encoder_model, "AutoencoderKL is created without 'VAE encoder' capability. Please, pass extra argument to constructor to create 'VAE encoder'");
     OPENVINO_ASSERT(m_encoder_request, "VAE encoder model must be compiled first. Cannot infer non-compiled model");
 
-    m_encoder_request.set_input_tensor(image);
-    m_encoder_request.infer();
-
-    ov::Tensor output = m_encoder_request.get_output_tensor(), latent;
+    ov::Tensor output, latent;
+    if (m_tiling_config) {
+        init_tile_infer_requests(m_encoder_tile_requests, m_encoder_request, m_tiling_config->num_infer_requests);
+        output = infer_tiled(m_encoder_tile_requests, image, get_tiling_params(*m_tiling_config, get_vae_scale_factor(), false));
+    } else {
+        m_encoder_request.set_input_tensor(image);
+        m_encoder_request.infer();
+        output = m_encoder_request.get_output_tensor();
+    }
 
     ov::CompiledModel compiled_model = m_encoder_request.get_compiled_model();
     auto outputs = compiled_model.outputs();
@@ -308,6 +340,15 @@ ov::Tensor AutoencoderKL::encode(ov::Tensor image, std::shared_ptr<Generator> ge
     return latent;
 }
 
+void AutoencoderKL::set_tiling_config(const std::optional<VAETilingConfig>& tiling_config) {
+    if (tiling_config) {
+        OPENVINO_ASSERT(tiling_config->tile_size >= get_vae_scale_factor(),
+                        "VAETilingConfig: tile_size must be at least ", get_vae_scale_factor(), ", got ", tiling_config->tile_size);
+        OPENVINO_ASSERT(tiling_config->num_infer_requests > 0, "VAETilingConfig: num_infer_requests must be greater than 0");
+    }
+    m_tiling_config = tiling_config;
+}
+
 const AutoencoderKL::Config& AutoencoderKL::get_config() const {
     return m_config;
 }
@@ -8,6 +8,7 @@
 #include <fstream>
 
 #include "json_utils.hpp"
+#include "image_generation/text_encoder_cache.hpp"
 #include "lora/helper.hpp"
 #include "utils.hpp"
 
@@ -38,7 +39,8 @@ CLIPTextModel::Config::Config(const std::filesystem::path& config_path) {
 
 CLIPTextModel::CLIPTextModel(const std::filesystem::path& root_dir) :
     m_clip_tokenizer(get_tokenizer_path_by_text_encoder(root_dir)),
-    m_config(root_dir / "config.json") {
+    m_config(root_dir / "config.json"),
+    m_cache_base_model_id(std::filesystem::absolute(root_dir).string()) {
     m_model = utils::singleton_core().read_model(root_dir / "openvino_model.xml");
 }
 
@@ -46,7 +48,8 @@ CLIPTextModel::CLIPTextModel(const std::filesystem::path& root_dir,
                              const std::string& device,
                              const ov::AnyMap& properties)
     : m_clip_tokenizer(get_tokenizer_path_by_text_encoder(root_dir)),
-      m_config(root_dir / "config.json") {
+      m_config(root_dir / "config.json"),
+      m_cache_base_model_id(std::filesystem::absolute(root_dir).string()) {
     const auto [properties_without_blob, blob_path] = utils::extract_export_properties(properties);
 
     if (blob_path.has_value()) {
@@ -62,7 +65,9 @@ CLIPTextModel::CLIPTextModel(const std::string& model,
                              const Tensor& weights,
                              const Config& config,
                              const Tokenizer& clip_tokenizer) :
-    m_clip_tokenizer(clip_tokenizer), m_config(config) {
+    m_clip_tokenizer(clip_tokenizer), m_config(config),
+    // models from memory can't be identified, so their outputs are never shared with other models
+    m_cache_base_model_id(TextEncoderCache::get_unique_model_id()) {
     m_model = utils::singleton_core().read_model(model, weights);
 }
 
@@ -119,6 +124,7 @@ CLIPTextModel& CLIPTextModel::compile(const std::string& device, const ov::AnyMa
     ov::CompiledModel compiled_model = utils::singleton_core().compile_model(m_model, device, *filtered_properties);
     ov::genai::utils::print_compiled_model_properties(compiled_model, "Clip Text model");
     m_request = compiled_model.create_infer_request();
+    m_cache_model_id = TextEncoderCache::get_compiled_model_id(m_cache_base_model_id, device, compiled_model);
     // release the original model
     m_model.reset();
 
@@ -134,8 +140,36 @@ void CLIPTextModel::set_adapters(const std::optional<AdapterConfig>& adapters) {
 ov::Tensor CLIPTextModel::infer(const std::string& pos_prompt, const std::string& neg_prompt, bool do_classifier_free_guidance) {
     OPENVINO_ASSERT(m_request, "CLIP text encoder model must be compiled first. Cannot infer non-compiled model");
 
+    const std::vector<std::string> prompts = do_classifier_free_guidance ? std::vector<std::string>{neg_prompt, pos_prompt}
+                                                                         : std::vector<std::string>{pos_prompt};
+    m_cached_outputs.clear();
+    m_num_cache_hits = m_num_cache_misses = 0;
+
+    auto cache = TextEncoderCache::get_instance();
+    // LoRA adapters change outputs of the model from one generation to another, so they are not cached
+    if (!cache || m_adapter_controller) {
+        encode(prompts);
+        return get_output_tensor(0);
+    }
+
+    const bool is_batch_dynamic = m_request.get_compiled_model().inputs()[0].get_partial_shape()[0].is_dynamic();
+    const size_t num_outputs = m_request.get_compiled_model().outputs().size();
+    m_cached_outputs = cache->encode(m_cache_model_id, prompts, !is_batch_dynamic, [&](const std::vector<std::string>& prompts_to_encode) {
+        encode(prompts_to_encode);
+        std::vector<ov::Tensor> outputs;
+        for (size_t idx = 0; idx < num_outputs; ++idx) {
+            outputs.push_back(get_request_output_tensor(idx));
+        }
+        return outputs;
+    }, m_num_cache_hits);
+    m_num_cache_misses = prompts.size() - m_num_cache_hits;
+
+    return get_output_tensor(0);
+}
+
+void CLIPTextModel::encode(const std::vector<std::string>& prompts) {
     const int32_t pad_token_id = m_clip_tokenizer.get_pad_token_id();
-    const size_t text_embedding_batch_size = do_classifier_free_guidance ? 2 : 1;
+    const size_t text_embedding_batch_size = prompts.size();
 
     auto perform_tokenization = [&](const std::string& prompt, ov::Tensor input_ids) {
         ov::Tensor input_ids_token = m_clip_tokenizer.encode(prompt).input_ids;
@@ -166,37 +200,38 @@ ov::Tensor CLIPTextModel::infer(const std::string& pos_prompt, const std::string
                         ") != what CLIP text encoder model was compiled for (", compiled_input_shape[1], ").");
     }
 
-    size_t current_batch_idx = 0;
-
-    if (input_ids.get_shape()[0] == 2) {
-        perform_tokenization(neg_prompt,
+    // prompts fill the last rows, the leading ones of a model compiled for a larger batch size are sliced off outputs
+    const size_t model_batch_size = input_ids.get_shape()[0];
+    for (size_t current_batch_idx = 0; current_batch_idx < model_batch_size; ++current_batch_idx) {
+        const size_t prompt_idx = current_batch_idx + text_embedding_batch_size >= model_batch_size
+                                      ? current_batch_idx + text_embedding_batch_size - model_batch_size
+                                      : 0;
+        perform_tokenization(prompts[prompt_idx],
                              ov::Tensor(input_ids, {current_batch_idx    , 0},
                                                    {current_batch_idx + 1, m_config.max_position_embeddings}));
-        ++current_batch_idx;
-    } else {
-        // Negative prompt is ignored when --guidanceScale < 1.0
     }
 
-    perform_tokenization(pos_prompt,
-                         ov::Tensor(input_ids, {current_batch_idx    , 0},
-                                               {current_batch_idx + 1, m_config.max_position_embeddings}));
-
     // text embeddings
     m_request.infer();
 
-    // This is true when text_embedding_batch_size is 1, but model was reshaped / compiled as batch size 2.
-    m_slice_batch1_output = (text_embedding_batch_size != input_ids.get_shape()[0]);
-
-    return get_output_tensor(0);
+    m_num_encoded_prompts = text_embedding_batch_size;
 }
 
 ov::Tensor CLIPTextModel::get_output_tensor(const size_t idx) {
+    if (!m_cached_outputs.empty()) {
+        return m_cached_outputs.at(idx);
+    }
+    return get_request_output_tensor(idx);
+}
+
+ov::Tensor CLIPTextModel::get_request_output_tensor(size_t idx) {
     auto infer_out_tensor = m_request.get_output_tensor(idx);
-    if (m_slice_batch1_output) {
-        //Slice and return batch index 1 output.
-        auto out_shape = infer_out_tensor.get_shape();
+    auto out_shape = infer_out_tensor.get_shape();
+    if (m_num_encoded_prompts != 0 && m_num_encoded_prompts < out_shape[0]) {
+        // This is true when the model was reshaped / compiled for a larger batch size, e.g. 2 for 1 prompt.
+        // Slice and return the rows of the prompts.
         auto begin_coord = ov::Coordinate(out_shape.size(), 0);
-        begin_coord[0] = 1;
+        begin_coord[0] = out_shape[0] - m_num_encoded_prompts;
         auto end_coord = ov::Coordinate(out_shape);
         auto sliced_out_tensor = ov::Tensor(infer_out_tensor, begin_coord, end_coord);
         return sliced_out_tensor;
@@ -205,6 +240,14 @@ ov::Tensor CLIPTextModel::get_output_tensor(const size_t idx) {
     }
 }
 
+size_t CLIPTextModel::get_num_cache_hits() const {
+    return m_num_cache_hits;
+}
+
+size_t CLIPTextModel::get_num_cache_misses() const {
+    return m_num_cache_misses;
+}
+
 void CLIPTextModel::export_model(const std::filesystem::path& blob_path) {
     OPENVINO_ASSERT(m_request, "CLIP text encoder model must be compiled first.");
     auto compiled_model = m_request.get_compiled_model();
@@ -218,6 +261,7 @@ void CLIPTextModel::import_model(const std::filesystem::path& blob_path,
     auto compiled_model = utils::import_model(blob_path / "openvino_model.blob", device, properties);
     ov::genai::utils::print_compiled_model_properties(compiled_model, "Clip Text model");
     m_request = compiled_model.create_infer_request();
+    m_cache_model_id = TextEncoderCache::get_compiled_model_id(m_cache_base_model_id, device, compiled_model);
 }
 
 } // namespace genai
@@ -6,6 +6,7 @@
 #include <fstream>
 
 #include "json_utils.hpp"
+#include "image_generation/text_encoder_cache.hpp"
 #include "lora/helper.hpp"
 #include "utils.hpp"
 
@@ -15,7 +16,8 @@ namespace genai {
 std::filesystem::path get_tokenizer_path_by_text_encoder(const std::filesystem::path& text_encoder_path);
 
 T5EncoderModel::T5EncoderModel(const std::filesystem::path& root_dir) :
-    m_tokenizer(get_tokenizer_path_by_text_encoder(root_dir)) {
+    m_tokenizer(get_tokenizer_path_by_text_encoder(root_dir)),
+    m_cache_base_model_id(std::filesystem::absolute(root_dir).string()) {
     m_model = utils::singleton_core().read_model(root_dir / "openvino_model.xml");
 }
 
@@ -29,7 +31,9 @@ T5EncoderModel::T5EncoderModel(const std::filesystem::path& root_dir,
 T5EncoderModel::T5EncoderModel(const std::string& model,
                                const Tensor& weights,
                                const Tokenizer& tokenizer) :
-    m_tokenizer(tokenizer) {
+    m_tokenizer(tokenizer),
+    // models from memory can't be identified, so their outputs are never shared with other models
+    m_cache_base_model_id(TextEncoderCache::get_unique_model_id()) {
     m_model = utils::singleton_core().read_model(model, weights);
 }
 
@@ -75,6 +79,7 @@ T5EncoderModel& T5EncoderModel::compile(const std::string& device, const ov::Any
     ov::CompiledModel compiled_model = utils::singleton_core().compile_model(m_model, device, *extract_adapters_from_properties(properties));
     ov::genai::utils::print_compiled_model_properties(compiled_model, "T5 encoder model");
     m_request = compiled_model.create_infer_request();
+    m_cache_model_id = TextEncoderCache::get_compiled_model_id(m_cache_base_model_id, device, compiled_model);
     // release the original model
     m_model.reset();
 
@@ -84,6 +89,42 @@ T5EncoderModel& T5EncoderModel::compile(const std::string& device, const ov::Any
 ov::Tensor T5EncoderModel::infer(const std::string& pos_prompt, const std::string& neg_prompt, bool do_classifier_free_guidance, int max_sequence_length, const ov::AnyMap& tokenization_params) {
     OPENVINO_ASSERT(m_request, "T5 encoder model must be compiled first. Cannot infer non-compiled model");
 
+    const std::vector<std::string> prompts = do_classifier_free_guidance ? std::vector<std::string>{neg_prompt, pos_prompt}
+                                                                         : std::vector<std::string>{pos_prompt};
+    m_cached_outputs.clear();
+    m_num_cache_hits = m_num_cache_misses = 0;
+
+    auto cache = TextEncoderCache::get_instance();
+    if (!cache) {
+        encode(prompts, max_sequence_length, tokenization_params);
+        return m_request.get_output_tensor(0);
+    }
+
+    // outputs also depend on the sequence length and tokenization
+    std::string model_id = m_cache_model_id + "|" + std::to_string(max_sequence_length);
+    for (const auto& [name, value] : tokenization_params) {
+        model_id += "|" + name + "=" + value.as<std::string>();
+    }
+    const bool is_batch_dynamic = m_request.get_compiled_model().inputs()[0].get_partial_shape()[0].is_dynamic();
+    const size_t num_outputs = m_request.get_compiled_model().outputs().size();
+    m_cached_outputs = cache->encode(model_id, prompts, !is_batch_dynamic, [&](const std::vector<std::string>& prompts_to_encode) {
+        encode(prompts_to_encode, max_sequence_length, tokenization_params);
+        std::vector<ov::Tensor> outputs;
+        for (size_t idx = 0; idx < num_outputs; ++idx) {
+            outputs.push_back(m_request.get_output_tensor(idx));
+        }
+        // the attention mask is cached along with the outputs
+        outputs.push_back(m_prompt_attention_mask);
+        return outputs;
+    }, m_num_cache_hits);
+    m_num_cache_misses = prompts.size() - m_num_cache_hits;
+
+    m_prompt_attention_mask = m_cached_outputs.back();
+    m_cached_outputs.pop_back();
+    return m_cached_outputs.at(0);
+}
+
+void T5EncoderModel::encode(const std::vector<std::string>& prompts, int max_sequence_length, const ov::AnyMap& tokenization_params) {
     const int32_t pad_token_id = m_tokenizer.get_pad_token_id();
     auto perform_tokenization = [&](const std::string& prompt,
                                 ov::Tensor input_ids,
@@ -117,49 +158,38 @@ ov::Tensor T5EncoderModel::infer(const std::string& pos_prompt, const std::strin
         }
     };
 
-    ov::Tensor input_ids = m_request.get_input_tensor();
-
-    // reshape in case of dynamic model
-    ov::Shape input_ids_shape = input_ids.get_shape();
-    m_prompt_attention_mask = ov::Tensor(input_ids.get_element_type(), input_ids_shape);
-
-
-    OPENVINO_ASSERT(input_ids_shape[1] == 0 || max_sequence_length == input_ids_shape[1],
-        "In case of T5EncoderModel was reshaped before, reshape's max_sequence_length ", input_ids_shape[1], " must be equal to ",
+    ov::PartialShape compiled_input_partial_shape = m_request.get_compiled_model().inputs()[0].get_partial_shape();
+    OPENVINO_ASSERT(compiled_input_partial_shape[1].is_dynamic() || compiled_input_partial_shape[1].get_length() == max_sequence_length,
+        "In case of T5EncoderModel was reshaped before, reshape's max_sequence_length ", compiled_input_partial_shape[1], " must be equal to ",
         "infer's max_sequence_length ", max_sequence_length);
 
-    if (input_ids_shape[0] == 0 || input_ids_shape[1] == 0) {
-        size_t batch_size = do_classifier_free_guidance ? 2 : 1;
+    ov::Tensor input_ids = m_request.get_input_tensor();
+
+    // reshape in case of dynamic model, the batch is resized on every call since the number of prompts varies
+    if (compiled_input_partial_shape.is_dynamic()) {
+        size_t batch_size = compiled_input_partial_shape[0].is_dynamic() ? prompts.size() : compiled_input_partial_shape[0].get_length();
         input_ids.set_shape({batch_size, static_cast<size_t>(max_sequence_length)});
-        m_prompt_attention_mask.set_shape({batch_size, static_cast<size_t>(max_sequence_length)});
     }
+    m_prompt_attention_mask = ov::Tensor(input_ids.get_element_type(), input_ids.get_shape());
 
-    size_t current_batch_idx = 0;
-    if (do_classifier_free_guidance) {
-        perform_tokenization(neg_prompt,
+    OPENVINO_ASSERT(prompts.size() <= input_ids.get_shape()[0],
+                    "The number of prompts (", prompts.size(), ") > T5 encoder model batch size (", input_ids.get_shape()[0], ")");
+    for (size_t current_batch_idx = 0; current_batch_idx < prompts.size(); ++current_batch_idx) {
+        perform_tokenization(prompts[current_batch_idx],
                              ov::Tensor(input_ids, {current_batch_idx    , 0},
                                                    {current_batch_idx + 1, input_ids.get_shape()[1]}),
                              ov::Tensor(m_prompt_attention_mask, {current_batch_idx    , 0},
                                                    {current_batch_idx + 1, input_ids.get_shape()[1]}));
-        ++current_batch_idx;
-    } else {
-        // Negative prompt is ignored when --guidanceScale < 1.0
     }
 
-    // perform_tokenization(pos_prompt, input_ids);
-    perform_tokenization(pos_prompt,
-                         ov::Tensor(input_ids, {current_batch_idx    , 0},
-                                               {current_batch_idx + 1, input_ids.get_shape()[1]}),
-                         ov::Tensor(m_prompt_attention_mask, {current_batch_idx    , 0},
-                                               {current_batch_idx + 1, input_ids.get_shape()[1]}));
-
     // text embeddings
     m_request.infer();
-
-    return m_request.get_output_tensor(0);
 }
 
 ov::Tensor T5EncoderModel::get_output_tensor(const size_t idx) {
+    if (!m_cached_outputs.empty()) {
+        return m_cached_outputs.at(idx);
+    }
     return m_request.get_output_tensor(idx);
 }
 
@@ -169,5 +199,13 @@ ov::Tensor T5EncoderModel::get_prompt_attention_mask() const {
     return m_prompt_attention_mask;
 }
 
+size_t T5EncoderModel::get_num_cache_hits() const {
+    return m_num_cache_hits;
+}
+
+size_t T5EncoderModel::get_num_cache_misses() const {
+    return m_num_cache_misses;
+}
+
 } // namespace genai
 } // namespace ov
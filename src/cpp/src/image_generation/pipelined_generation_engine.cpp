@@ -0,0 +1,237 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/pipelined_generation_engine.hpp"
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+// outputs of infer requests are overwritten by the next inference, so tensors passed to other threads are copied
+ov::Tensor copy_tensor(const ov::Tensor& tensor) {
+    ov::Tensor copy(tensor.get_element_type(), tensor.get_shape());
+    tensor.copy_to(copy);
+    return copy;
+}
+
+}  // namespace
+
+void PipelinedGenerationEngine::RequestQueue::push(std::shared_ptr<Request> request) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        OPENVINO_ASSERT(!m_is_closed, "Request queue is closed");
+        m_requests.push_back(std::move(request));
+    }
+    m_cv.notify_one();
+}
+
+std::shared_ptr<PipelinedGenerationEngine::Request> PipelinedGenerationEngine::RequestQueue::pop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this] {
+        return m_is_closed || !m_requests.empty();
+    });
+    if (m_requests.empty()) {
+        return nullptr;
+    }
+    std::shared_ptr<Request> request = std::move(m_requests.front());
+    m_requests.pop_front();
+    return request;
+}
+
+void PipelinedGenerationEngine::RequestQueue::close() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_is_closed = true;
+    }
+    m_cv.notify_all();
+}
+
+PipelinedGenerationEngine::PipelinedGenerationEngine(std::shared_ptr<DiffusionPipeline> pipeline, size_t max_in_flight_requests)
+    : PipelinedGenerationEngine(_make_stages(pipeline), max_in_flight_requests) {
+    m_pipeline = std::move(pipeline);
+}
+
+PipelinedGenerationEngine::PipelinedGenerationEngine(Stages stages, size_t max_in_flight_requests)
+    : m_stages(std::move(stages)),
+      m_max_in_flight_requests(max_in_flight_requests) {
+    OPENVINO_ASSERT(m_max_in_flight_requests > 0, "max_in_flight_requests must be greater than 0");
+
+    m_decoding_worker = std::thread(&PipelinedGenerationEngine::_decode, this);
+    m_denoising_worker = std::thread(&PipelinedGenerationEngine::_denoise, this);
+    m_text_encoding_worker = std::thread(&PipelinedGenerationEngine::_encode_prompts, this);
+}
+
+PipelinedGenerationEngine::~PipelinedGenerationEngine() {
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_is_stopped = true;
+        m_cv.notify_all();
+        m_cv.wait(lock, [this] {
+            return m_num_waiting_requests == 0;
+        });
+    }
+
+    // each stage closes the queue of the next one once it's drained
+    m_text_encoding_queue.close();
+    for (std::thread* worker : {&m_text_encoding_worker, &m_denoising_worker, &m_decoding_worker}) {
+        if (worker->joinable()) {
+            worker->join();
+        }
+    }
+    if (m_pipeline) {
+        m_pipeline->m_output_latents = false;
+    }
+}
+
+PipelinedGenerationEngine::Stages PipelinedGenerationEngine::_make_stages(const std::shared_ptr<DiffusionPipeline>& pipeline) {
+    OPENVINO_ASSERT(pipeline->m_pipeline_type == PipelineType::TEXT_2_IMAGE, "Pipelined generation supports text to image generation only");
+
+    // clones share compiled models with the pipeline, but have their own infer requests
+    std::shared_ptr<DiffusionPipeline> text_encoding_pipeline = pipeline->clone();
+    auto vae = std::make_shared<AutoencoderKL>(pipeline->m_vae->clone());
+    pipeline->m_output_latents = true;
+
+    Stages stages;
+    stages.encode = [pipeline, text_encoding_pipeline](Request& request) {
+        ImageGenerationConfig& generation_config = request.generation_config;
+        generation_config = pipeline->get_generation_config();
+        generation_config.update_generation_config(request.properties);
+
+        if (generation_config.height < 0)
+            text_encoding_pipeline->compute_dim(generation_config.height, {}, 1 /* assume NHWC */);
+        if (generation_config.width < 0)
+            text_encoding_pipeline->compute_dim(generation_config.width, {}, 2 /* assume NHWC */);
+        text_encoding_pipeline->check_inputs(generation_config, {});
+
+        // the denoiser must use the resolution the hidden states are computed for
+        request.properties[ov::genai::height.name()] = generation_config.height;
+        request.properties[ov::genai::width.name()] = generation_config.width;
+
+        text_encoding_pipeline->set_lora_adapters(generation_config.adapters);
+        request.hidden_states = text_encoding_pipeline->record_hidden_states(request.positive_prompt, generation_config);
+    };
+    stages.denoise = [pipeline](Request& request) {
+        pipeline->m_precomputed_hidden_states = std::move(request.hidden_states);
+        ov::Tensor latent;
+        try {
+            latent = pipeline->generate(request.positive_prompt, {}, {}, request.properties);
+        } catch (...) {
+            pipeline->m_precomputed_hidden_states.reset();
+            throw;
+        }
+        pipeline->m_precomputed_hidden_states.reset();
+        // stopped by the callback, there are no latents to decode
+        return latent.get_shape().empty() ? latent : copy_tensor(latent);
+    };
+    stages.decode = [vae](Request& request) {
+        vae->set_tiling_config(request.generation_config.vae_tiling_config);
+        return copy_tensor(vae->decode(request.latent));
+    };
+    return stages;
+}
+
+ov::Tensor PipelinedGenerationEngine::generate(const std::string& positive_prompt, const ov::AnyMap& properties) {
+    auto request = std::make_shared<Request>();
+    request->positive_prompt = positive_prompt;
+    request->properties = properties;
+
+    std::future<ov::Tensor> result = request->result.get_future();
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        ++m_num_waiting_requests;
+        m_cv.wait(lock, [this] {
+            return m_is_stopped || (m_num_exclusive_actions == 0 && m_num_in_flight_requests < m_max_in_flight_requests);
+        });
+        --m_num_waiting_requests;
+        if (m_is_stopped) {
+            // the destructor waits for the requests which are not admitted to leave
+            m_cv.notify_all();
+            OPENVINO_THROW("Pipelined generation engine is stopped");
+        }
+        ++m_num_in_flight_requests;
+        m_text_encoding_queue.push(request);
+    }
+    return result.get();
+}
+
+void PipelinedGenerationEngine::run_exclusively(const std::function<void()>& action) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // hold new requests back until the action is done
+    ++m_num_exclusive_actions;
+    m_cv.wait(lock, [this] {
+        return m_num_in_flight_requests == 0;
+    });
+    std::exception_ptr action_exception;
+    try {
+        action();
+    } catch (...) {
+        action_exception = std::current_exception();
+    }
+    --m_num_exclusive_actions;
+    lock.unlock();
+    m_cv.notify_all();
+    if (action_exception) {
+        std::rethrow_exception(action_exception);
+    }
+}
+
+void PipelinedGenerationEngine::_encode_prompts() {
+    while (std::shared_ptr<Request> request = m_text_encoding_queue.pop()) {
+        try {
+            m_stages.encode(*request);
+            m_denoising_queue.push(request);
+        } catch (...) {
+            _fail_request(*request, std::current_exception());
+        }
+    }
+    m_denoising_queue.close();
+}
+
+void PipelinedGenerationEngine::_denoise() {
+    while (std::shared_ptr<Request> request = m_denoising_queue.pop()) {
+        try {
+            ov::Tensor latent = m_stages.denoise(*request);
+            if (latent.get_shape().empty()) {
+                _finish_request(*request, latent);
+                continue;
+            }
+            request->latent = latent;
+            m_decoding_queue.push(request);
+        } catch (...) {
+            _fail_request(*request, std::current_exception());
+        }
+    }
+    m_decoding_queue.close();
+}
+
+void PipelinedGenerationEngine::_decode() {
+    while (std::shared_ptr<Request> request = m_decoding_queue.pop()) {
+        try {
+            _finish_request(*request, m_stages.decode(*request));
+        } catch (...) {
+            _fail_request(*request, std::current_exception());
+        }
+    }
+}
+
+void PipelinedGenerationEngine::_finish_request(Request& request, ov::Tensor image) {
+    request.result.set_value(image);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        --m_num_in_flight_requests;
+    }
+    m_cv.notify_all();
+}
+
+void PipelinedGenerationEngine::_fail_request(Request& request, std::exception_ptr error) {
+    request.result.set_exception(error);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        --m_num_in_flight_requests;
+    }
+    m_cv.notify_all();
+}
+
+}  // namespace genai
+}  // namespace ov
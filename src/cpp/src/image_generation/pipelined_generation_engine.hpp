@@ -0,0 +1,120 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "image_generation/diffusion_pipeline.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Serves text to image requests submitted concurrently by several threads with one diffusion pipeline, whose
+ * stages process different requests at the same time. Three worker threads run text encoding, denoising and VAE
+ * decoding, each with its own infer requests, and hand requests over to the next stage through queues, so that the
+ * VAE decoding of a request overlaps the denoising of the next one and the text encoding of the one after it. Stages
+ * compiled for different devices or CPU streams then work in parallel instead of waiting for each other.
+ */
+class PipelinedGenerationEngine {
+public:
+    struct Request {
+        std::string positive_prompt;
+        ov::AnyMap properties;
+        std::promise<ov::Tensor> result;
+
+        ImageGenerationConfig generation_config;
+        DiffusionPipeline::HiddenStates hidden_states;
+        ov::Tensor latent;
+    };
+
+    /**
+     * @brief Work done for a request by each stage, every stage is called from its own thread only.
+     */
+    struct Stages {
+        // fills the generation config and the hidden states of the request
+        std::function<void(Request&)> encode;
+        // returns the denoised latent of the request or a tensor of empty shape if it's stopped by its callback
+        std::function<ov::Tensor(Request&)> denoise;
+        // returns the images decoded from the latent of the request
+        std::function<ov::Tensor(Request&)> decode;
+    };
+
+    /**
+     * @param pipeline compiled text to image pipeline, it runs the denoising stage while the text encoding and VAE
+     * decoding stages use its clones
+     * @param max_in_flight_requests maximum number of requests being processed by all stages, generate() blocks until
+     * one of them is done when the limit is reached
+     */
+    PipelinedGenerationEngine(std::shared_ptr<DiffusionPipeline> pipeline, size_t max_in_flight_requests);
+
+    PipelinedGenerationEngine(Stages stages, size_t max_in_flight_requests);
+
+    /**
+     * @brief Waits for the requests in flight to be done, generate() calls waiting to be admitted fail.
+     */
+    ~PipelinedGenerationEngine();
+
+    /**
+     * @brief Blocks until the request is served. Callbacks are called from the denoising thread.
+     * @return generated images or an empty tensor if the request is stopped by its callback
+     */
+    ov::Tensor generate(const std::string& positive_prompt, const ov::AnyMap& properties);
+
+    /**
+     * @brief Waits for the requests in flight to be done and runs the action while no request is processed, further
+     * generate() calls wait for it to finish. The pipeline is used by the stages from other threads, so it must be
+     * changed (e.g. its generation config or scheduler) or inspected by such actions only.
+     */
+    void run_exclusively(const std::function<void()>& action);
+
+private:
+    // hands requests over from a stage to the next one
+    class RequestQueue {
+    public:
+        void push(std::shared_ptr<Request> request);
+        // blocks until a request is available, returns nullptr once the queue is closed and drained
+        std::shared_ptr<Request> pop();
+        void close();
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::deque<std::shared_ptr<Request>> m_requests;
+        bool m_is_closed = false;
+    };
+
+    Stages m_stages;
+    std::shared_ptr<DiffusionPipeline> m_pipeline;
+    size_t m_max_in_flight_requests;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    size_t m_num_in_flight_requests = 0;
+    // generate() calls waiting to be admitted, the engine can't be destroyed while they access it
+    size_t m_num_waiting_requests = 0;
+    size_t m_num_exclusive_actions = 0;
+    bool m_is_stopped = false;
+
+    RequestQueue m_text_encoding_queue, m_denoising_queue, m_decoding_queue;
+    std::thread m_text_encoding_worker, m_denoising_worker, m_decoding_worker;
+
+    static Stages _make_stages(const std::shared_ptr<DiffusionPipeline>& pipeline);
+
+    void _encode_prompts();
+    void _denoise();
+    void _decode();
+    void _finish_request(Request& request, ov::Tensor image);
+    void _fail_request(Request& request, std::exception_ptr error);
+};
+
+}  // namespace genai
+}  // namespace ov
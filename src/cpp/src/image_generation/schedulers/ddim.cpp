@@ -224,6 +224,10 @@ void DDIMScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t
     }
 }
 
+std::shared_ptr<IScheduler> DDIMScheduler::clone() const {
+    return std::make_shared<DDIMScheduler>(m_config);
+}
+
 
 } // namespace genai
 } // namespace ov
@@ -47,6 +47,8 @@ public:
 
     virtual void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t timestep) const override;
 
+    virtual std::shared_ptr<IScheduler> clone() const override;
+
 private:
     Config m_config;
 
@@ -234,6 +234,10 @@ void EulerAncestralDiscreteScheduler::add_noise(ov::Tensor init_latent, ov::Tens
     }
 }
 
+std::shared_ptr<IScheduler> EulerAncestralDiscreteScheduler::clone() const {
+    return std::make_shared<EulerAncestralDiscreteScheduler>(m_config);
+}
+
 std::vector<int64_t> EulerAncestralDiscreteScheduler::get_timesteps() const {
     OPENVINO_ASSERT(!m_timesteps.empty(), "'timesteps' have not yet been set.");
 
@@ -319,5 +319,9 @@ void EulerDiscreteScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise,
     }
 }
 
+std::shared_ptr<IScheduler> EulerDiscreteScheduler::clone() const {
+    return std::make_shared<EulerDiscreteScheduler>(m_config);
+}
+
 }  // namespace genai
 }  // namespace ov
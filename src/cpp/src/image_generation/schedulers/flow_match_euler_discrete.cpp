@@ -189,6 +189,10 @@ void FlowMatchEulerDiscreteScheduler::add_noise(ov::Tensor init_latent, ov::Tens
     OPENVINO_THROW("Not implemented");
 }
 
+std::shared_ptr<IScheduler> FlowMatchEulerDiscreteScheduler::clone() const {
+    return std::make_shared<FlowMatchEulerDiscreteScheduler>(m_config);
+}
+
 size_t FlowMatchEulerDiscreteScheduler::_index_for_timestep(float timestep) {
     if (m_schedule_timesteps.empty()) {
         m_schedule_timesteps = m_timesteps;
@@ -43,6 +43,8 @@ public:
 
     void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const override;
 
+    std::shared_ptr<IScheduler> clone() const override;
+
     void scale_noise(ov::Tensor sample, float timestep, ov::Tensor noise) override;
 
     void set_begin_index(size_t begin_index) override;
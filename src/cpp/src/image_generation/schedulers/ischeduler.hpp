@@ -28,6 +28,9 @@ public:
 
     virtual void add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t latent_timestep) const = 0;
 
+    // creates a scheduler with the same type and config, but without the state of the current generation
+    virtual std::shared_ptr<IScheduler> clone() const = 0;
+
     virtual void set_timesteps(size_t image_seq_len, size_t num_inference_steps, float strength) {
         OPENVINO_THROW("Scheduler doesn't support `set_timesteps(size_t image_seq_len, size_t num_inference_steps, float strength)` method");
     }
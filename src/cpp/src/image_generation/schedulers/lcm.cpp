@@ -263,5 +263,9 @@ void LCMScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t l
     }
 }
 
+std::shared_ptr<IScheduler> LCMScheduler::clone() const {
+    return std::make_shared<LCMScheduler>(m_config);
+}
+
 } // namespace genai
 } // namespace ov
@@ -272,6 +272,10 @@ void PNDMScheduler::add_noise(ov::Tensor init_latent, ov::Tensor noise, int64_t
     }
 }
 
+std::shared_ptr<IScheduler> PNDMScheduler::clone() const {
+    return std::make_shared<PNDMScheduler>(m_config);
+}
+
 std::vector<int64_t> PNDMScheduler::get_timesteps() const {
     OPENVINO_ASSERT(!m_timesteps.empty(), "'timesteps' have not yet been set.");
 
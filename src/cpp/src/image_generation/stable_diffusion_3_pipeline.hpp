@@ -7,6 +7,7 @@
 
 #include "image_generation/diffusion_pipeline.hpp"
 #include "image_generation/threaded_callback.hpp"
+#include "diffusion_caching/taylorseer_lite.hpp"
 
 #include "openvino/genai/image_generation/clip_text_model.hpp"
 #include "openvino/genai/image_generation/clip_text_model_with_projection.hpp"
@@ -330,6 +331,7 @@ public:
         ov::Tensor text_encoder_1_output = m_clip_text_encoder_1->infer(positive_prompt, negative_prompt_1_str, do_classifier_free_guidance(generation_config.guidance_scale));
         auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
         m_perf_metrics.encoder_inference_duration["text_encode"] = infer_duration;
+        add_text_encoder_cache_stats(m_perf_metrics, *m_clip_text_encoder_1);
 
         // text_encoder_1_hidden_state - stores positive and negative prompt_embeds
         size_t idx_hidden_state_1 = m_clip_text_encoder_1->get_config().num_hidden_layers + 1;
@@ -340,6 +342,7 @@ public:
         ov::Tensor text_encoder_2_output = m_clip_text_encoder_2->infer(prompt_2_str, negative_prompt_2_str, do_classifier_free_guidance(generation_config.guidance_scale));
         infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
         m_perf_metrics.encoder_inference_duration["text_encode_2"] = infer_duration;
+        add_text_encoder_cache_stats(m_perf_metrics, *m_clip_text_encoder_2);
 
         // text_encoder_2_hidden_state - stores positive and negative prompt_2_embeds
         size_t idx_hidden_state_2 = m_clip_text_encoder_2->get_config().num_hidden_layers + 1;
@@ -356,6 +359,7 @@ public:
                 std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start)
                     .count();
             m_perf_metrics.encoder_inference_duration["text_encode_3"] = infer_duration;
+            add_text_encoder_cache_stats(m_perf_metrics, *m_t5_text_encoder);
         } else {
             ov::Shape t5_prompt_embed_shape = {batch_size_multiplier,
                                                m_clip_text_encoder_1->get_config().max_position_embeddings,
@@ -458,8 +462,8 @@ public:
         }
 
         // 4. Set model inputs
-        m_transformer->set_hidden_states("encoder_hidden_states", prompt_embeds_inp);
-        m_transformer->set_hidden_states("pooled_projections", pooled_prompt_embeds_inp);
+        set_hidden_states("encoder_hidden_states", prompt_embeds_inp);
+        set_hidden_states("pooled_projections", pooled_prompt_embeds_inp);
     }
 
     std::tuple<ov::Tensor, ov::Tensor, ov::Tensor, ov::Tensor> prepare_latents(ov::Tensor initial_image, const ImageGenerationConfig& generation_config) override {
@@ -529,6 +533,7 @@ public:
         check_inputs(generation_config, initial_image);
 
         set_lora_adapters(generation_config.adapters);
+        m_vae->set_tiling_config(generation_config.vae_tiling_config);
 
         // Use callback if defined
         std::shared_ptr<ThreadedCallbackWrapper> callback_ptr = nullptr;
@@ -545,7 +550,7 @@ public:
         m_latent_timestep = timesteps[0];
 
         // 4. Compute text encoders and set hidden states
-        compute_hidden_states(positive_prompt, generation_config);
+        prepare_hidden_states(positive_prompt, generation_config);
 
         // 5. Prepare latent variables
         ov::Tensor latent, processed_image, image_latent, noise;
@@ -564,6 +569,9 @@ public:
         // 7. Denoising loop
         ov::Tensor noisy_residual_tensor(ov::element::f32, {});
 
+        // Initialize TaylorSeer if configured
+        TaylorSeerState ts_state(generation_config.taylorseer_config, timesteps.size());
+
         for (size_t inference_step = 0; inference_step < timesteps.size(); ++inference_step) {
             auto step_start = std::chrono::steady_clock::now();
             // concat the same latent twice along a batch dimension in case of CFG
@@ -576,7 +584,9 @@ public:
             }
             ov::Tensor timestep(ov::element::f32, {1}, &timesteps[inference_step]);
             auto infer_start = std::chrono::steady_clock::now();
-            ov::Tensor noise_pred_tensor = m_transformer->infer(latent_cfg, timestep);
+            ov::Tensor noise_pred_tensor = ts_state.infer_or_predict(inference_step, [&] {
+                return m_transformer->infer(latent_cfg, timestep);
+            });
             auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
             m_perf_metrics.raw_metrics.transformer_inference_durations.emplace_back(MicroSeconds(infer_duration));
 
@@ -624,6 +634,11 @@ public:
         if (callback_ptr != nullptr) {
             callback_ptr->end();
         }
+        if (m_output_latents) {
+            m_perf_metrics.generate_duration =
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - gen_start).count();
+            return latent;
+        }
         auto decode_start = std::chrono::steady_clock::now();
         auto image = decode(latent);
         m_perf_metrics.vae_decoder_inference_duration =
@@ -688,7 +703,11 @@ private:
         }
     }
 
-    void compute_dim(int64_t & generation_config_value, ov::Tensor initial_image, int dim_idx) {
+    void set_denoiser_hidden_states(const std::string& name, ov::Tensor hidden_states) override {
+        m_transformer->set_hidden_states(name, hidden_states);
+    }
+
+    void compute_dim(int64_t & generation_config_value, ov::Tensor initial_image, int dim_idx) override {
         const size_t vae_scale_factor = m_vae->get_vae_scale_factor();
         const auto& transformer_config = m_transformer->get_config();
 
@@ -10,6 +10,7 @@
 
 #include "image_generation/diffusion_pipeline.hpp"
 #include "image_generation/threaded_callback.hpp"
+#include "diffusion_caching/taylorseer_lite.hpp"
 
 #include "openvino/genai/image_generation/clip_text_model.hpp"
 #include "openvino/genai/image_generation/clip_text_model_with_projection.hpp"
@@ -193,38 +194,12 @@ public:
 
     void compute_hidden_states(const std::string& positive_prompt, const ImageGenerationConfig& generation_config) override {
         const auto& unet_config = m_unet->get_config();
-        const size_t batch_size_multiplier = m_unet->do_classifier_free_guidance(generation_config.guidance_scale) ? 2 : 1;  // Unet accepts 2x batch in case of CFG
-
-        std::string negative_prompt = generation_config.negative_prompt != std::nullopt ? *generation_config.negative_prompt : std::string{};
-        auto infer_start = std::chrono::steady_clock::now();
-        ov::Tensor encoder_hidden_states = m_clip_text_encoder->infer(positive_prompt, negative_prompt,
-            batch_size_multiplier > 1);
-        auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
-        m_perf_metrics.encoder_inference_duration["text_encoder"] = infer_duration;
-
-        // replicate encoder hidden state to UNet model
-        if (generation_config.num_images_per_prompt == 1) {
-            // reuse output of text encoder directly w/o extra memory copy
-            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states);
-        } else {
-            ov::Shape enc_shape = encoder_hidden_states.get_shape();
-            enc_shape[0] *= generation_config.num_images_per_prompt;
-
-            ov::Tensor encoder_hidden_states_repeated(encoder_hidden_states.get_element_type(), enc_shape);
-            for (size_t n = 0; n < generation_config.num_images_per_prompt; ++n) {
-                numpy_utils::batch_copy(encoder_hidden_states, encoder_hidden_states_repeated, 0, n);
-                if (batch_size_multiplier > 1) {
-                    numpy_utils::batch_copy(encoder_hidden_states, encoder_hidden_states_repeated,
-                        1, generation_config.num_images_per_prompt + n);
-                }
-            }
 
-            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states_repeated);
-        }
+        set_hidden_states("encoder_hidden_states", encode_prompt(positive_prompt, generation_config));
 
         if (unet_config.time_cond_proj_dim >= 0) { // LCM
             ov::Tensor timestep_cond = get_guidance_scale_embedding(generation_config.guidance_scale - 1.0f, unet_config.time_cond_proj_dim);
-            m_unet->set_hidden_states("timestep_cond", timestep_cond);
+            set_hidden_states("timestep_cond", timestep_cond);
         }
     }
 
@@ -317,6 +292,7 @@ public:
         check_inputs(generation_config, initial_image);
 
         set_lora_adapters(generation_config.adapters);
+        m_vae->set_tiling_config(generation_config.vae_tiling_config);
 
         // use callback if defined
         std::shared_ptr<ThreadedCallbackWrapper> callback_ptr = nullptr;
@@ -330,7 +306,7 @@ public:
         std::vector<std::int64_t> timesteps = m_scheduler->get_timesteps();
 
         // compute text encoders and set hidden states
-        compute_hidden_states(positive_prompt, generation_config);
+        prepare_hidden_states(positive_prompt, generation_config);
 
         // preparate initial / image latents
         ov::Tensor latent, processed_image, image_latent, noise;
@@ -348,6 +324,9 @@ public:
 
         ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg), denoised, noisy_residual_tensor(ov::element::f32, {}), latent_model_input;
 
+        // Initialize TaylorSeer if configured
+        TaylorSeerState ts_state(generation_config.taylorseer_config, timesteps.size());
+
         for (size_t inference_step = 0; inference_step < timesteps.size(); inference_step++) {
             auto step_start = std::chrono::steady_clock::now();
             numpy_utils::batch_copy(latent, latent_cfg, 0, 0, generation_config.num_images_per_prompt);
@@ -361,7 +340,9 @@ public:
             ov::Tensor latent_model_input = is_inpainting_model() ? numpy_utils::concat(numpy_utils::concat(latent_cfg, mask, 1), masked_image_latent, 1) : latent_cfg;
             ov::Tensor timestep(ov::element::i64, {1}, &timesteps[inference_step]);
             auto infer_start = std::chrono::steady_clock::now();
-            ov::Tensor noise_pred_tensor = m_unet->infer(latent_model_input, timestep);
+            ov::Tensor noise_pred_tensor = ts_state.infer_or_predict(inference_step, [&] {
+                return m_unet->infer(latent_model_input, timestep);
+            });
             auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
             m_perf_metrics.raw_metrics.unet_inference_durations.emplace_back(MicroSeconds(infer_duration));
 
@@ -414,6 +395,11 @@ public:
         if (callback_ptr != nullptr) {
             callback_ptr->end();
         }
+        if (m_output_latents) {
+            m_perf_metrics.generate_duration =
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - gen_start).count();
+            return denoised;
+        }
         auto decode_start = std::chrono::steady_clock::now();
         auto image = decode(denoised);
         m_perf_metrics.vae_decoder_inference_duration =
@@ -434,12 +420,48 @@ public:
     }
 
 protected:
+    // text encoder output replicated for each image, with rows of the negative prompt going first in case of CFG
+    ov::Tensor encode_prompt(const std::string& positive_prompt, const ImageGenerationConfig& generation_config) {
+        const size_t batch_size_multiplier = m_unet->do_classifier_free_guidance(generation_config.guidance_scale) ? 2 : 1;  // Unet accepts 2x batch in case of CFG
+
+        std::string negative_prompt = generation_config.negative_prompt != std::nullopt ? *generation_config.negative_prompt : std::string{};
+        auto infer_start = std::chrono::steady_clock::now();
+        ov::Tensor encoder_hidden_states = m_clip_text_encoder->infer(positive_prompt, negative_prompt,
+            batch_size_multiplier > 1);
+        auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
+        m_perf_metrics.encoder_inference_duration["text_encoder"] = infer_duration;
+        add_text_encoder_cache_stats(m_perf_metrics, *m_clip_text_encoder);
+
+        // replicate encoder hidden state to UNet model
+        if (generation_config.num_images_per_prompt == 1) {
+            // reuse output of text encoder directly w/o extra memory copy
+            return encoder_hidden_states;
+        }
+
+        ov::Shape enc_shape = encoder_hidden_states.get_shape();
+        enc_shape[0] *= generation_config.num_images_per_prompt;
+
+        ov::Tensor encoder_hidden_states_repeated(encoder_hidden_states.get_element_type(), enc_shape);
+        for (size_t n = 0; n < generation_config.num_images_per_prompt; ++n) {
+            numpy_utils::batch_copy(encoder_hidden_states, encoder_hidden_states_repeated, 0, n);
+            if (batch_size_multiplier > 1) {
+                numpy_utils::batch_copy(encoder_hidden_states, encoder_hidden_states_repeated,
+                    1, generation_config.num_images_per_prompt + n);
+            }
+        }
+        return encoder_hidden_states_repeated;
+    }
+
     size_t get_config_in_channels() const override {
         assert(m_unet != nullptr);
         return m_unet->get_config().in_channels;
     }
 
-    void compute_dim(int64_t & generation_config_value, ov::Tensor initial_image, int dim_idx) {
+    void set_denoiser_hidden_states(const std::string& name, ov::Tensor hidden_states) override {
+        m_unet->set_hidden_states(name, hidden_states);
+    }
+
+    void compute_dim(int64_t & generation_config_value, ov::Tensor initial_image, int dim_idx) override {
         const size_t vae_scale_factor = m_vae->get_vae_scale_factor();
         const auto& unet_config = m_unet->get_config();
 
@@ -519,6 +541,7 @@ protected:
 
     friend class Text2ImagePipeline;
     friend class Image2ImagePipeline;
+    friend class StepBatchingEngine;
 
     std::shared_ptr<CLIPTextModel> m_clip_text_encoder = nullptr;
     std::shared_ptr<UNet2DConditionModel> m_unet = nullptr;
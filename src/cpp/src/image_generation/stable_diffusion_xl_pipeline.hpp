@@ -276,10 +276,12 @@ public:
             add_text_embeds = m_clip_text_encoder_with_projection->infer(positive_prompt, negative_prompt_1_str, batch_size_multiplier > 1);
             auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
             m_perf_metrics.encoder_inference_duration["text_encoder_2"] = infer_duration;
+            add_text_encoder_cache_stats(m_perf_metrics, *m_clip_text_encoder_with_projection);
             infer_start = std::chrono::steady_clock::now();
             m_clip_text_encoder->infer(prompt_2_str, negative_prompt_2_str, batch_size_multiplier > 1);
             infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
             m_perf_metrics.encoder_inference_duration["text_encoder"] = infer_duration;
+            add_text_encoder_cache_stats(m_perf_metrics, *m_clip_text_encoder);
 
             // prompt_embeds = prompt_embeds.hidden_states[-2]
             ov::Tensor encoder_hidden_states_1 = m_clip_text_encoder->get_output_tensor(idx_hidden_state_1);
@@ -291,10 +293,12 @@ public:
             ov::Tensor add_text_embeds_positive = m_clip_text_encoder_with_projection->infer(positive_prompt, negative_prompt_1_str, false);
             auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
             m_perf_metrics.encoder_inference_duration["text_encoder_2"] = infer_duration;
+            add_text_encoder_cache_stats(m_perf_metrics, *m_clip_text_encoder_with_projection);
             infer_start = std::chrono::steady_clock::now();
             m_clip_text_encoder->infer(prompt_2_str, negative_prompt_2_str, false);
             infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
             m_perf_metrics.encoder_inference_duration["text_encoder"] = infer_duration;
+            add_text_encoder_cache_stats(m_perf_metrics, *m_clip_text_encoder);
 
             ov::Tensor encoder_hidden_states_1_positive = m_clip_text_encoder->get_output_tensor(idx_hidden_state_1);
             ov::Tensor encoder_hidden_states_2_positive = m_clip_text_encoder_with_projection->get_output_tensor(idx_hidden_state_2);
@@ -342,9 +346,9 @@ public:
         // replicate encoder hidden state to UNet model
         if (generation_config.num_images_per_prompt == 1) {
             // reuse output of text encoder directly w/o extra memory copy
-            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states);
-            m_unet->set_hidden_states("text_embeds", add_text_embeds);
-            m_unet->set_hidden_states("time_ids", add_time_ids);
+            set_hidden_states("encoder_hidden_states", encoder_hidden_states);
+            set_hidden_states("text_embeds", add_text_embeds);
+            set_hidden_states("time_ids", add_time_ids);
         } else {
             ov::Shape enc_shape = encoder_hidden_states.get_shape();
             enc_shape[0] *= generation_config.num_images_per_prompt;
@@ -358,7 +362,7 @@ public:
                 }
             }
 
-            m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states_repeated);
+            set_hidden_states("encoder_hidden_states", encoder_hidden_states_repeated);
 
             ov::Shape t_emb_shape = add_text_embeds.get_shape();
             t_emb_shape[0] *= generation_config.num_images_per_prompt;
@@ -372,7 +376,7 @@ public:
                 }
             }
 
-            m_unet->set_hidden_states("text_embeds", add_text_embeds_repeated);
+            set_hidden_states("text_embeds", add_text_embeds_repeated);
 
             ov::Shape t_ids_shape = add_time_ids.get_shape();
             t_ids_shape[0] *= generation_config.num_images_per_prompt;
@@ -385,12 +389,12 @@ public:
                 }
             }
 
-            m_unet->set_hidden_states("time_ids", add_time_ids_repeated);
+            set_hidden_states("time_ids", add_time_ids_repeated);
         }
 
         if (unet_config.time_cond_proj_dim >= 0) { // LCM
             ov::Tensor timestep_cond = get_guidance_scale_embedding(generation_config.guidance_scale - 1.0f, unet_config.time_cond_proj_dim);
-            m_unet->set_hidden_states("timestep_cond", timestep_cond);
+            set_hidden_states("timestep_cond", timestep_cond);
         }
     }
 
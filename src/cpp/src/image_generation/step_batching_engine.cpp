@@ -0,0 +1,290 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/step_batching_engine.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+// outputs of infer requests are overwritten by the next inference, so tensors passed to other threads are copied
+ov::Tensor copy_tensor(const ov::Tensor& tensor) {
+    ov::Tensor copy(tensor.get_element_type(), tensor.get_shape());
+    tensor.copy_to(copy);
+    return copy;
+}
+
+}  // namespace
+
+StepBatchingEngine::StepBatchingEngine(std::shared_ptr<StableDiffusionPipeline> pipeline, size_t max_batch_size)
+    : m_pipeline(std::move(pipeline)),
+      m_max_batch_size(max_batch_size) {
+    OPENVINO_ASSERT(m_pipeline->m_pipeline_type == PipelineType::TEXT_2_IMAGE, "Step batching supports text to image generation only");
+    OPENVINO_ASSERT(m_max_batch_size > 0, "max_batch_size must be greater than 0");
+
+    // all requests of a batch run the same UNet, so adapters are applied once rather than per request
+    m_pipeline->set_lora_adapters(m_pipeline->get_generation_config().adapters);
+
+    m_worker = std::thread(&StepBatchingEngine::_run, this);
+}
+
+StepBatchingEngine::~StepBatchingEngine() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_is_stopped = true;
+    }
+    m_cv.notify_all();
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+}
+
+ov::Tensor StepBatchingEngine::generate(const std::string& positive_prompt, const ov::AnyMap& properties) {
+    OPENVINO_ASSERT(properties.find(ov::genai::adapters.name()) == properties.end(),
+                    "LoRA adapters are shared by batched requests and can't be set per request");
+
+    auto request = std::make_shared<Request>();
+    request->positive_prompt = positive_prompt;
+    request->generation_config = m_pipeline->get_generation_config();
+    request->generation_config.update_generation_config(properties);
+    // the cached UNet outputs would mix requests at different denoising steps
+    OPENVINO_ASSERT(!request->generation_config.taylorseer_config.has_value(),
+                    "TaylorSeer caching can't be applied to step batched requests");
+
+    auto callback_iter = properties.find(ov::genai::callback.name());
+    if (callback_iter != properties.end()) {
+        request->callback = callback_iter->second.as<std::function<bool(size_t, size_t, ov::Tensor&)>>();
+    }
+
+    ImageGenerationConfig& generation_config = request->generation_config;
+    if (generation_config.height < 0)
+        m_pipeline->compute_dim(generation_config.height, {}, 1 /* assume NHWC */);
+    if (generation_config.width < 0)
+        m_pipeline->compute_dim(generation_config.width, {}, 2 /* assume NHWC */);
+    m_pipeline->check_inputs(generation_config, {});
+    request->batch_size_multiplier = m_pipeline->m_unet->do_classifier_free_guidance(generation_config.guidance_scale) ? 2 : 1;
+    // the request would be admitted to an empty batch and exceed the batch size anyway
+    OPENVINO_ASSERT(request->get_num_rows() <= m_max_batch_size,
+                    "Request takes ", request->get_num_rows(), " rows of UNet batch, which exceeds max_batch_size ", m_max_batch_size,
+                    ". Decrease num_images_per_prompt or increase max_batch_size");
+
+    std::future<ov::Tensor> result = request->result.get_future();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        OPENVINO_ASSERT(!m_is_stopped, "Step batching engine is stopped");
+        m_waiting_requests.push_back(request);
+    }
+    m_cv.notify_one();
+    return result.get();
+}
+
+void StepBatchingEngine::_run() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] {
+                return m_is_stopped || !m_waiting_requests.empty() || !m_active_requests.empty();
+            });
+            if (m_is_stopped) {
+                break;
+            }
+        }
+
+        _admit_requests();
+        if (!m_active_requests.empty()) {
+            _step();
+        }
+    }
+
+    std::vector<std::shared_ptr<Request>> requests = std::move(m_active_requests);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        requests.insert(requests.end(), m_waiting_requests.begin(), m_waiting_requests.end());
+        m_waiting_requests.clear();
+    }
+    _fail_requests(requests, std::make_exception_ptr(std::runtime_error("Step batching engine is stopped")));
+}
+
+void StepBatchingEngine::_admit_requests() {
+    size_t num_rows = 0;
+    for (const auto& request : m_active_requests) {
+        num_rows += request->get_num_rows();
+    }
+
+    std::vector<std::shared_ptr<Request>> admitted_requests;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // requests are admitted in arrival order, so a request of another resolution isn't overtaken by the later ones
+        // and starts once the batch drains
+        while (!m_waiting_requests.empty()) {
+            const auto& request = m_waiting_requests.front();
+            const Request* batch_request = !m_active_requests.empty() ? m_active_requests.front().get()
+                                         : !admitted_requests.empty() ? admitted_requests.front().get()
+                                         : nullptr;
+            if (batch_request != nullptr &&
+                (request->generation_config.height != batch_request->generation_config.height ||
+                 request->generation_config.width != batch_request->generation_config.width ||
+                 num_rows + request->get_num_rows() > m_max_batch_size)) {
+                break;
+            }
+            num_rows += request->get_num_rows();
+            admitted_requests.push_back(request);
+            m_waiting_requests.pop_front();
+        }
+    }
+
+    for (auto& request : admitted_requests) {
+        try {
+            _prepare_request(*request);
+            m_active_requests.push_back(request);
+        } catch (...) {
+            request->result.set_exception(std::current_exception());
+        }
+    }
+}
+
+void StepBatchingEngine::_prepare_request(Request& request) {
+    StableDiffusionPipeline& pipeline = *m_pipeline;
+    const ImageGenerationConfig& generation_config = request.generation_config;
+
+    // the pipeline's scheduler, possibly set by set_scheduler(), is the prototype of request schedulers
+    request.scheduler = pipeline.m_scheduler->clone();
+    request.scheduler->set_timesteps(generation_config.num_inference_steps, generation_config.strength);
+    request.timesteps = request.scheduler->get_timesteps();
+
+    request.encoder_hidden_states = copy_tensor(pipeline.encode_prompt(request.positive_prompt, generation_config));
+
+    const auto& unet_config = pipeline.m_unet->get_config();
+    if (unet_config.time_cond_proj_dim >= 0) { // LCM
+        ov::Tensor timestep_cond = get_guidance_scale_embedding(generation_config.guidance_scale - 1.0f, unet_config.time_cond_proj_dim);
+        request.timestep_cond = numpy_utils::repeat(timestep_cond, request.get_num_rows());
+    }
+
+    // the batch starts from pure noise scaled by the scheduler's init sigma, as StableDiffusionPipeline::prepare_latents() does
+    const size_t vae_scale_factor = pipeline.m_vae->get_vae_scale_factor();
+    ov::Shape latent_shape{generation_config.num_images_per_prompt, pipeline.m_vae->get_config().latent_channels,
+                           generation_config.height / vae_scale_factor, generation_config.width / vae_scale_factor};
+    ov::Tensor noise = generation_config.generator->randn_tensor(latent_shape);
+    request.latent = ov::Tensor(ov::element::f32, latent_shape);
+
+    const float * noise_data = noise.data<const float>();
+    float * latent_data = request.latent.data<float>();
+    for (size_t i = 0; i < request.latent.get_size(); ++i)
+        latent_data[i] = noise_data[i] * request.scheduler->get_init_noise_sigma();
+}
+
+void StepBatchingEngine::_step() {
+    StableDiffusionPipeline& pipeline = *m_pipeline;
+
+    size_t num_rows = 0;
+    for (const auto& request : m_active_requests) {
+        num_rows += request->get_num_rows();
+    }
+
+    ov::Tensor noise_pred;
+    try {
+        const Request& first_request = *m_active_requests.front();
+        ov::Shape sample_shape = first_request.latent.get_shape();
+        sample_shape[0] = num_rows;
+        ov::Shape hidden_states_shape = first_request.encoder_hidden_states.get_shape();
+        hidden_states_shape[0] = num_rows;
+
+        ov::Tensor sample(ov::element::f32, sample_shape), timestep(ov::element::i64, {num_rows});
+        ov::Tensor encoder_hidden_states(first_request.encoder_hidden_states.get_element_type(), hidden_states_shape);
+        ov::Tensor timestep_cond;
+        if (first_request.timestep_cond) {
+            ov::Shape timestep_cond_shape = first_request.timestep_cond.get_shape();
+            timestep_cond_shape[0] = num_rows;
+            timestep_cond = ov::Tensor(first_request.timestep_cond.get_element_type(), timestep_cond_shape);
+        }
+
+        const size_t sample_row_size = sample.get_size() / num_rows;
+        for (size_t i = 0, row = 0; i < m_active_requests.size(); row += m_active_requests[i++]->get_num_rows()) {
+            Request& request = *m_active_requests[i];
+            const size_t num_images = request.generation_config.num_images_per_prompt;
+            const size_t request_rows = request.get_num_rows();
+
+            // concat the same latent twice along a batch dimension in case of CFG
+            for (size_t n = 0; n < request.batch_size_multiplier; ++n) {
+                numpy_utils::batch_copy(request.latent, sample, 0, row + n * num_images, num_images);
+            }
+            ov::Shape request_sample_shape = sample_shape;
+            request_sample_shape[0] = request_rows;
+            request.scheduler->scale_model_input(ov::Tensor(ov::element::f32, request_sample_shape, sample.data<float>() + row * sample_row_size),
+                                                 request.inference_step);
+
+            std::fill_n(timestep.data<int64_t>() + row, request_rows, request.timesteps[request.inference_step]);
+            numpy_utils::batch_copy(request.encoder_hidden_states, encoder_hidden_states, 0, row, request_rows);
+            if (timestep_cond) {
+                numpy_utils::batch_copy(request.timestep_cond, timestep_cond, 0, row, request_rows);
+            }
+        }
+
+        pipeline.m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states);
+        if (timestep_cond) {
+            pipeline.m_unet->set_hidden_states("timestep_cond", timestep_cond);
+        }
+        noise_pred = pipeline.m_unet->infer(sample, timestep);
+    } catch (...) {
+        _fail_requests(m_active_requests, std::current_exception());
+        return;
+    }
+
+    const float* noise_pred_data = noise_pred.data<const float>();
+    const size_t noise_pred_row_size = noise_pred.get_size() / num_rows;
+
+    std::vector<std::shared_ptr<Request>> active_requests;
+    for (size_t i = 0, row = 0; i < m_active_requests.size(); row += m_active_requests[i++]->get_num_rows()) {
+        Request& request = *m_active_requests[i];
+        try {
+            ov::Tensor noisy_residual_tensor(ov::element::f32, request.latent.get_shape());
+            float* noisy_residual = noisy_residual_tensor.data<float>();
+            const float* noise_pred_uncond = noise_pred_data + row * noise_pred_row_size;
+
+            if (request.batch_size_multiplier > 1) {
+                // perform guidance
+                const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
+                for (size_t j = 0; j < noisy_residual_tensor.get_size(); ++j) {
+                    noisy_residual[j] = noise_pred_uncond[j] +
+                        request.generation_config.guidance_scale * (noise_pred_text[j] - noise_pred_uncond[j]);
+                }
+            } else {
+                std::copy_n(noise_pred_uncond, noisy_residual_tensor.get_size(), noisy_residual);
+            }
+
+            auto scheduler_step_result = request.scheduler->step(noisy_residual_tensor, request.latent, request.inference_step, request.generation_config.generator);
+            request.latent = scheduler_step_result["latent"];
+
+            // check whether scheduler returns "denoised" image, which should be passed to VAE decoder
+            const auto it = scheduler_step_result.find("denoised");
+            request.denoised = it != scheduler_step_result.end() ? it->second : request.latent;
+
+            const size_t num_steps = request.timesteps.size();
+            if (request.callback && request.callback(request.inference_step, num_steps, request.denoised)) {
+                request.result.set_value(ov::Tensor(ov::element::u8, {}));
+            } else if (++request.inference_step == num_steps) {
+                pipeline.m_vae->set_tiling_config(request.generation_config.vae_tiling_config);
+                request.result.set_value(copy_tensor(pipeline.decode(request.denoised)));
+            } else {
+                active_requests.push_back(m_active_requests[i]);
+            }
+        } catch (...) {
+            request.result.set_exception(std::current_exception());
+        }
+    }
+    m_active_requests = std::move(active_requests);
+}
+
+void StepBatchingEngine::_fail_requests(std::vector<std::shared_ptr<Request>>& requests, std::exception_ptr error) {
+    for (auto& request : requests) {
+        request->result.set_exception(error);
+    }
+    requests.clear();
+}
+
+}  // namespace genai
+}  // namespace ov
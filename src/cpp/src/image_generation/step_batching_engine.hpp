@@ -0,0 +1,86 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "image_generation/stable_diffusion_pipeline.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Serves text to image requests submitted concurrently by several threads with one Stable Diffusion pipeline.
+ * A worker thread runs the denoising loop: each step denoises the latents of all active requests by one batched UNet
+ * inference, while every request keeps its own scheduler, timesteps, guidance scale and generator. Requests join the
+ * batch in arrival order while their resolution matches the batch's one and leave it as soon as they are done, so a
+ * short request doesn't wait for the longer ones it was batched with.
+ */
+class StepBatchingEngine {
+public:
+    /**
+     * @param pipeline text to image pipeline whose UNet accepts dynamic batch size, requests use clones of its scheduler
+     * @param max_batch_size maximum batch size of the UNet inference, which is 2 * num_images_per_prompt per request
+     * with classifier free guidance and num_images_per_prompt otherwise
+     */
+    StepBatchingEngine(std::shared_ptr<StableDiffusionPipeline> pipeline, size_t max_batch_size);
+
+    ~StepBatchingEngine();
+
+    /**
+     * @brief Blocks until the request is served. Callbacks are called from the worker thread. Requests which take more
+     * than max_batch_size rows of UNet batch are rejected.
+     * @return generated images or an empty tensor if the request is stopped by its callback
+     */
+    ov::Tensor generate(const std::string& positive_prompt, const ov::AnyMap& properties);
+
+private:
+    struct Request {
+        std::string positive_prompt;
+        ImageGenerationConfig generation_config;
+        std::function<bool(size_t, size_t, ov::Tensor&)> callback;
+        std::promise<ov::Tensor> result;
+
+        std::shared_ptr<IScheduler> scheduler;
+        std::vector<std::int64_t> timesteps;
+        size_t inference_step = 0;
+        size_t batch_size_multiplier = 1;
+        // rows of the UNet inputs, the ones of the negative prompt go first in case of CFG
+        ov::Tensor encoder_hidden_states, timestep_cond;
+        ov::Tensor latent, denoised;
+
+        size_t get_num_rows() const {
+            return batch_size_multiplier * generation_config.num_images_per_prompt;
+        }
+    };
+
+    std::shared_ptr<StableDiffusionPipeline> m_pipeline;
+    size_t m_max_batch_size;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::shared_ptr<Request>> m_waiting_requests;
+    bool m_is_stopped = false;
+
+    // owned by the worker thread
+    std::vector<std::shared_ptr<Request>> m_active_requests;
+    std::thread m_worker;
+
+    void _run();
+    void _admit_requests();
+    void _prepare_request(Request& request);
+    void _step();
+    void _fail_requests(std::vector<std::shared_ptr<Request>>& requests, std::exception_ptr error);
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -11,6 +11,8 @@
 #include "image_generation/stable_diffusion_xl_pipeline.hpp"
 #include "image_generation/stable_diffusion_3_pipeline.hpp"
 #include "image_generation/flux_pipeline.hpp"
+#include "image_generation/step_batching_engine.hpp"
+#include "image_generation/pipelined_generation_engine.hpp"
 
 #include "utils.hpp"
 
@@ -178,14 +180,33 @@ ImageGenerationConfig Text2ImagePipeline::get_generation_config() const {
 }
 
 void Text2ImagePipeline::set_generation_config(const ImageGenerationConfig& generation_config) {
+    // the step batching worker reads the config and the scheduler without synchronization
+    OPENVINO_ASSERT(m_step_batching_engine == nullptr, "Generation config can't be changed once step batching is enabled");
+    if (m_pipelined_generation_engine) {
+        // the pipeline is used by the engine threads
+        m_pipelined_generation_engine->run_exclusively([&] {
+            m_impl->set_generation_config(generation_config);
+        });
+        return;
+    }
     m_impl->set_generation_config(generation_config);
 }
 
 void Text2ImagePipeline::set_scheduler(std::shared_ptr<Scheduler> scheduler) {
+    OPENVINO_ASSERT(m_step_batching_engine == nullptr, "Scheduler can't be changed once step batching is enabled");
+    if (m_pipelined_generation_engine) {
+        m_pipelined_generation_engine->run_exclusively([&] {
+            m_impl->set_scheduler(scheduler);
+        });
+        return;
+    }
     m_impl->set_scheduler(scheduler);
 }
 
 void Text2ImagePipeline::reshape(const int num_images_per_prompt, const int height, const int width, const float guidance_scale) {
+    // the engine stages keep clones of the compiled models
+    OPENVINO_ASSERT(m_pipelined_generation_engine == nullptr, "Pipeline can't be reshaped once pipelined generation is enabled");
+    OPENVINO_ASSERT(m_step_batching_engine == nullptr, "Pipeline can't be reshaped once step batching is enabled");
     auto start_time = std::chrono::steady_clock::now();
     m_impl->reshape(num_images_per_prompt, height, width, guidance_scale);
     m_impl->save_load_time(start_time);
@@ -201,6 +222,8 @@ void Text2ImagePipeline::reshape(const int num_images_per_prompt, const int heig
 }
 
 void Text2ImagePipeline::compile(const std::string& device, const ov::AnyMap& properties) {
+    OPENVINO_ASSERT(m_pipelined_generation_engine == nullptr, "Pipeline can't be compiled once pipelined generation is enabled");
+    OPENVINO_ASSERT(m_step_batching_engine == nullptr, "Pipeline can't be compiled once step batching is enabled");
     auto start_time = std::chrono::steady_clock::now();
     m_impl->compile(device, properties);
     m_impl->save_load_time(start_time);
@@ -210,12 +233,35 @@ void Text2ImagePipeline::compile(const std::string& text_encode_device,
     const std::string& denoise_device,
     const std::string& vae_device,
     const ov::AnyMap& properties) {
+    OPENVINO_ASSERT(m_pipelined_generation_engine == nullptr, "Pipeline can't be compiled once pipelined generation is enabled");
+    OPENVINO_ASSERT(m_step_batching_engine == nullptr, "Pipeline can't be compiled once step batching is enabled");
     auto start_time = std::chrono::steady_clock::now();
     m_impl->compile(text_encode_device, denoise_device, vae_device, properties);
     m_impl->save_load_time(start_time);
 }
 
+void Text2ImagePipeline::enable_step_batching(size_t max_batch_size) {
+    auto stable_diffusion = std::dynamic_pointer_cast<StableDiffusionPipeline>(m_impl);
+    OPENVINO_ASSERT(stable_diffusion != nullptr && std::dynamic_pointer_cast<StableDiffusionXLPipeline>(m_impl) == nullptr,
+                    "Step batching is supported for Stable Diffusion and Latent Consistency Model pipelines only");
+    OPENVINO_ASSERT(m_pipelined_generation_engine == nullptr, "Step batching can't be combined with pipelined generation");
+    m_step_batching_engine = std::make_shared<StepBatchingEngine>(stable_diffusion, max_batch_size);
+}
+
+void Text2ImagePipeline::enable_pipelined_generation(size_t max_in_flight_requests) {
+    OPENVINO_ASSERT(m_step_batching_engine == nullptr, "Pipelined generation can't be combined with step batching");
+    // the previous engine must release the pipeline before the new one takes it over
+    m_pipelined_generation_engine.reset();
+    m_pipelined_generation_engine = std::make_shared<PipelinedGenerationEngine>(m_impl, max_in_flight_requests);
+}
+
 ov::Tensor Text2ImagePipeline::generate(const std::string& positive_prompt, const ov::AnyMap& properties) {
+    if (m_step_batching_engine) {
+        return m_step_batching_engine->generate(positive_prompt, properties);
+    }
+    if (m_pipelined_generation_engine) {
+        return m_pipelined_generation_engine->generate(positive_prompt, properties);
+    }
     return m_impl->generate(positive_prompt, {}, {}, properties);
 }
 
@@ -224,6 +270,13 @@ ov::Tensor Text2ImagePipeline::decode(const ov::Tensor latent) {
 }
 
 ImageGenerationPerfMetrics Text2ImagePipeline::get_performance_metrics() {
+    if (m_pipelined_generation_engine) {
+        ImageGenerationPerfMetrics perf_metrics;
+        m_pipelined_generation_engine->run_exclusively([&] {
+            perf_metrics = m_impl->get_performance_metrics();
+        });
+        return perf_metrics;
+    }
     return m_impl->get_performance_metrics();
 }
 
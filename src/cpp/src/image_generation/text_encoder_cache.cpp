@@ -0,0 +1,211 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/text_encoder_cache.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+ov::Tensor get_continuous(const ov::Tensor& tensor) {
+    if (tensor.is_continuous()) {
+        return tensor;
+    }
+    ov::Tensor continuous_tensor(tensor.get_element_type(), tensor.get_shape());
+    tensor.copy_to(continuous_tensor);
+    return continuous_tensor;
+}
+
+// copies a row of a tensor whose first axis is the batch one to a new tensor with batch size 1
+ov::Tensor copy_row(const ov::Tensor& tensor, size_t row) {
+    ov::Shape row_shape = tensor.get_shape();
+    const size_t batch_size = row_shape.at(0);
+    row_shape[0] = 1;
+    ov::Tensor row_tensor(tensor.get_element_type(), row_shape);
+    const size_t row_byte_size = row_tensor.get_byte_size();
+    OPENVINO_ASSERT(row < batch_size && row_byte_size * batch_size == tensor.get_byte_size());
+    std::memcpy(row_tensor.data(), static_cast<const uint8_t*>(tensor.data()) + row * row_byte_size, row_byte_size);
+    return row_tensor;
+}
+
+ov::Tensor concat_rows(const std::vector<ov::Tensor>& rows) {
+    ov::Shape shape = rows.front().get_shape();
+    shape[0] = rows.size();
+    ov::Tensor tensor(rows.front().get_element_type(), shape);
+    uint8_t* data = static_cast<uint8_t*>(tensor.data());
+    for (const ov::Tensor& row : rows) {
+        std::memcpy(data, row.data(), row.get_byte_size());
+        data += row.get_byte_size();
+    }
+    return tensor;
+}
+
+size_t get_outputs_size(const std::vector<ov::Tensor>& outputs) {
+    size_t size = 0;
+    for (const ov::Tensor& output : outputs) {
+        size += output.get_byte_size();
+    }
+    return size;
+}
+
+}  // namespace
+
+TextEncoderCache::TextEncoderCache(size_t max_size_in_bytes) : m_max_size_in_bytes(max_size_in_bytes) {}
+
+std::shared_ptr<TextEncoderCache> TextEncoderCache::get_instance() {
+    static std::shared_ptr<TextEncoderCache> instance = []() -> std::shared_ptr<TextEncoderCache> {
+        size_t cache_size_mb = 0;
+        if (const char* env = std::getenv("TEXT_ENCODER_CACHE_SIZE_MB")) {
+            try {
+                cache_size_mb = std::stoul(env);
+            } catch (...) {
+                cache_size_mb = 0;
+            }
+        }
+        if (cache_size_mb == 0) {
+            return nullptr;
+        }
+        return std::make_shared<TextEncoderCache>(cache_size_mb * 1024 * 1024);
+    }();
+    return instance;
+}
+
+std::string TextEncoderCache::get_unique_model_id() {
+    static std::atomic<size_t> counter{0};
+    return "<model " + std::to_string(counter++) + ">";
+}
+
+std::string TextEncoderCache::get_compiled_model_id(const std::string& model_id,
+                                                    const std::string& device,
+                                                    const ov::CompiledModel& compiled_model) {
+    std::string compiled_model_id = model_id + "|" + device;
+    const auto supported_properties = compiled_model.get_property(ov::supported_properties);
+    for (const std::string name : {ov::hint::inference_precision.name(), ov::hint::execution_mode.name()}) {
+        if (std::find(supported_properties.begin(), supported_properties.end(), name) != supported_properties.end()) {
+            compiled_model_id += "|" + name + "=" + compiled_model.get_property(name).as<std::string>();
+        }
+    }
+    return compiled_model_id;
+}
+
+TextEncoderCache::Key TextEncoderCache::compute_key(const std::string& model_id, const std::string& prompt) {
+    // the length prefix keeps keys unambiguous whatever characters model ids and prompts contain
+    return std::to_string(model_id.size()) + ":" + model_id + prompt;
+}
+
+std::optional<std::vector<ov::Tensor>> TextEncoderCache::get(const Key& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_key_to_entry.find(key);
+    if (it == m_key_to_entry.end()) {
+        return std::nullopt;
+    }
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->outputs;
+}
+
+void TextEncoderCache::put(const Key& key, const std::vector<ov::Tensor>& outputs) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_key_to_entry.find(key);
+    if (it != m_key_to_entry.end()) {
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+
+    const size_t size_in_bytes = get_outputs_size(outputs);
+    if (size_in_bytes > m_max_size_in_bytes) {
+        return;
+    }
+
+    m_entries.push_front(Entry{key, outputs, size_in_bytes});
+    m_key_to_entry[key] = m_entries.begin();
+    m_size_in_bytes += size_in_bytes;
+
+    while (m_size_in_bytes > m_max_size_in_bytes) {
+        const Entry& lru_entry = m_entries.back();
+        m_size_in_bytes -= lru_entry.size_in_bytes;
+        m_key_to_entry.erase(lru_entry.key);
+        m_entries.pop_back();
+    }
+}
+
+std::vector<ov::Tensor> TextEncoderCache::encode(const std::string& model_id,
+                                                 const std::vector<std::string>& prompts,
+                                                 bool encode_all_on_miss,
+                                                 const EncodeFunction& encode,
+                                                 size_t& num_hits) {
+    std::vector<Key> keys;
+    std::vector<std::optional<std::vector<ov::Tensor>>> prompt_outputs;
+    std::vector<std::string> prompts_to_encode;
+    for (const std::string& prompt : prompts) {
+        keys.push_back(compute_key(model_id, prompt));
+        prompt_outputs.push_back(get(keys.back()));
+        if (!prompt_outputs.back()) {
+            prompts_to_encode.push_back(prompt);
+        }
+    }
+    if (encode_all_on_miss && !prompts_to_encode.empty()) {
+        prompts_to_encode = prompts;
+        std::fill(prompt_outputs.begin(), prompt_outputs.end(), std::nullopt);
+    }
+    num_hits = prompts.size() - prompts_to_encode.size();
+
+    std::vector<ov::Tensor> encoded;
+    if (!prompts_to_encode.empty()) {
+        encoded = encode(prompts_to_encode);
+        const bool has_prompt_rows = std::all_of(encoded.begin(), encoded.end(), [&](const ov::Tensor& output) {
+            return output.get_shape().size() > 0 && output.get_shape()[0] == prompts_to_encode.size();
+        });
+        if (!has_prompt_rows) {
+            // e.g. a model reshaped to a larger batch size, its outputs can't be attributed to prompts
+            OPENVINO_ASSERT(num_hits == 0, "Text encoder outputs must have a row per prompt");
+            return encoded;
+        }
+    }
+
+    for (size_t prompt_idx = 0, encoded_idx = 0; prompt_idx < prompts.size(); ++prompt_idx) {
+        if (prompt_outputs[prompt_idx]) {
+            continue;
+        }
+        std::vector<ov::Tensor> outputs;
+        for (const ov::Tensor& output : encoded) {
+            outputs.push_back(copy_row(get_continuous(output), encoded_idx));
+        }
+        put(keys[prompt_idx], outputs);
+        prompt_outputs[prompt_idx] = std::move(outputs);
+        ++encoded_idx;
+    }
+
+    if (num_hits == 0) {
+        return encoded;
+    }
+    std::vector<ov::Tensor> outputs;
+    for (size_t output_idx = 0; output_idx < prompt_outputs.front()->size(); ++output_idx) {
+        std::vector<ov::Tensor> rows;
+        for (const auto& prompt_output : prompt_outputs) {
+            rows.push_back(prompt_output->at(output_idx));
+        }
+        outputs.push_back(concat_rows(rows));
+    }
+    return outputs;
+}
+
+size_t TextEncoderCache::num_entries() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t TextEncoderCache::size_in_bytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_size_in_bytes;
+}
+
+}  // namespace ov::genai
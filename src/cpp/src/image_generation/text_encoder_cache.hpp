@@ -0,0 +1,118 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "openvino/genai/image_generation/image_generation_perf_metrics.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief LRU cache of text encoder outputs bounded by the total size of their tensors. Each entry holds the outputs of
+ * a single prompt, so that a prompt is encoded once whatever prompts it is batched with, e.g. a negative prompt shared
+ * by requests with different positive ones. Entries are keyed by the model, its encoding settings and the prompt text.
+ */
+class TextEncoderCache {
+public:
+    using Key = std::string;
+    using EncodeFunction = std::function<std::vector<ov::Tensor>(const std::vector<std::string>& prompts)>;
+
+    /**
+     * @param max_size_in_bytes Max total size of tensors of cached outputs.
+     */
+    explicit TextEncoderCache(size_t max_size_in_bytes);
+
+    /**
+     * Process-wide cache shared by all image and video generation pipelines and their clones. Its memory budget is set
+     * by TEXT_ENCODER_CACHE_SIZE_MB environment variable.
+     * @return The cache or nullptr if TEXT_ENCODER_CACHE_SIZE_MB is not set or zero.
+     */
+    static std::shared_ptr<TextEncoderCache> get_instance();
+
+    /**
+     * @return Id of a model which can't be identified by its path, e.g. read from memory, unique within the process.
+     */
+    static std::string get_unique_model_id();
+
+    /**
+     * @param model_id Identifies the model before compilation, e.g. by its path.
+     * @param device Device the model is compiled for.
+     * @param compiled_model The compiled model, whose properties affecting outputs (e.g. inference precision) are added
+     * to the id.
+     * @return Id of the compiled model to pass to compute_key() and encode().
+     */
+    static std::string get_compiled_model_id(const std::string& model_id,
+                                             const std::string& device,
+                                             const ov::CompiledModel& compiled_model);
+
+    /**
+     * @param model_id Identifies the model, its device and all settings which affect its outputs.
+     * @param prompt Prompt text.
+     */
+    static Key compute_key(const std::string& model_id, const std::string& prompt);
+
+    /**
+     * Looks for outputs of a prompt and marks them as the most recently used ones.
+     * @return Outputs of the prompt with batch size 1 or std::nullopt on a miss.
+     */
+    std::optional<std::vector<ov::Tensor>> get(const Key& key);
+
+    /**
+     * Adds outputs of a prompt evicting the least recently used ones if the memory budget is exceeded.
+     */
+    void put(const Key& key, const std::vector<ov::Tensor>& outputs);
+
+    /**
+     * @brief Encodes a batch of prompts taking outputs of the cached ones from the cache. Only the missing prompts are
+     * passed to encode, unless encode_all_on_miss is set for models which can't change their batch size, and their
+     * outputs are added to the cache.
+     * @param encode Encodes prompts and returns outputs whose first axis is the batch one.
+     * @param num_hits Set to the number of prompts whose outputs are taken from the cache.
+     * @return Outputs of all prompts, their rows follow the order of prompts.
+     */
+    std::vector<ov::Tensor> encode(const std::string& model_id,
+                                   const std::vector<std::string>& prompts,
+                                   bool encode_all_on_miss,
+                                   const EncodeFunction& encode,
+                                   size_t& num_hits);
+
+    size_t num_entries() const;
+
+    size_t size_in_bytes() const;
+
+private:
+    struct Entry {
+        Key key;
+        std::vector<ov::Tensor> outputs;
+        size_t size_in_bytes;
+    };
+
+    size_t m_max_size_in_bytes;
+    size_t m_size_in_bytes = 0;
+    // most recently used entries go first
+    std::list<Entry> m_entries;
+    std::unordered_map<Key, std::list<Entry>::iterator> m_key_to_entry;
+    mutable std::mutex m_mutex;
+};
+
+/**
+ * @brief Adds cache hits and misses of the last inference of a text encoder to the pipeline metrics.
+ */
+template <typename TextEncoder>
+void add_text_encoder_cache_stats(ImageGenerationPerfMetrics& perf_metrics, const TextEncoder& text_encoder) {
+    perf_metrics.text_encoder_cache_hits += text_encoder.get_num_cache_hits();
+    perf_metrics.text_encoder_cache_misses += text_encoder.get_num_cache_misses();
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,324 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/vae_tiling.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iterator>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+
+namespace {
+
+ov::Tensor get_input_tile(const ov::Tensor& input, size_t frame, size_t y, size_t x, size_t num_frames, size_t height, size_t width) {
+    const ov::Shape& shape = input.get_shape();
+    const bool is_video = shape.size() == 5;
+    const size_t input_frames = is_video ? shape[2] : 1, input_height = shape[shape.size() - 2], input_width = shape.back();
+
+    ov::Shape tile_shape = shape;
+    if (is_video) {
+        tile_shape[2] = num_frames;
+    }
+    tile_shape[tile_shape.size() - 2] = height;
+    tile_shape.back() = width;
+    ov::Tensor tile(ov::element::f32, tile_shape);
+
+    const float* input_data = input.data<const float>();
+    float* tile_data = tile.data<float>();
+    for (size_t bc = 0; bc < shape[0] * shape[1]; ++bc) {
+        for (size_t f = 0; f < num_frames; ++f) {
+            for (size_t j = 0; j < height; ++j, tile_data += width) {
+                const size_t offset = ((bc * input_frames + frame + f) * input_height + y + j) * input_width + x;
+                std::copy_n(input_data + offset, width, tile_data);
+            }
+        }
+    }
+    return tile;
+}
+
+// sums of weighted outputs and weights of frames [first_frame, first_frame + values.size()), values are stored as
+// [B, H, W, C] per frame regardless of the output layout
+struct BlendedFrames {
+    size_t first_frame = 0;
+    std::deque<std::vector<float>> values, weights;
+};
+
+template <typename T>
+void accumulate_tile(BlendedFrames& frames,
+                     const ov::Tensor& tile,
+                     bool channels_last,
+                     size_t frame,
+                     size_t y,
+                     size_t x,
+                     size_t height,
+                     size_t width,
+                     const std::vector<float>& frame_weights,
+                     const std::vector<float>& y_weights,
+                     const std::vector<float>& x_weights) {
+    const ov::Shape& shape = tile.get_shape();
+    const size_t batch = shape[0], channels = channels_last ? shape.back() : shape[1];
+    const size_t tile_frames = frame_weights.size(), tile_height = y_weights.size(), tile_width = x_weights.size();
+    const T* tile_data = tile.data<const T>();
+
+    for (size_t f = 0; f < tile_frames; ++f) {
+        std::vector<float>& values = frames.values[frame + f - frames.first_frame];
+        std::vector<float>& weights = frames.weights[frame + f - frames.first_frame];
+
+        for (size_t j = 0; j < tile_height; ++j) {
+            for (size_t i = 0; i < tile_width; ++i) {
+                weights[(y + j) * width + x + i] += frame_weights[f] * y_weights[j] * x_weights[i];
+            }
+        }
+
+        for (size_t b = 0; b < batch; ++b) {
+            for (size_t j = 0; j < tile_height; ++j) {
+                for (size_t i = 0; i < tile_width; ++i) {
+                    const float weight = frame_weights[f] * y_weights[j] * x_weights[i];
+                    float* pixel = values.data() + ((b * height + y + j) * width + x + i) * channels;
+                    for (size_t c = 0; c < channels; ++c) {
+                        const size_t index = channels_last ? (((b * tile_frames + f) * tile_height + j) * tile_width + i) * channels + c
+                                                           : ((b * channels + c) * tile_height + j) * tile_width + i;
+                        pixel[c] += weight * static_cast<float>(tile_data[index]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+T convert_value(float value) {
+    return static_cast<T>(value);
+}
+
+template <>
+uint8_t convert_value<uint8_t>(float value) {
+    return static_cast<uint8_t>(std::clamp(std::round(value), 0.0f, 255.0f));
+}
+
+template <typename T>
+void write_frames(const BlendedFrames& frames, size_t num_frames, size_t height, size_t width, bool channels_last, ov::Tensor& output) {
+    const size_t batch = output.get_shape()[0], channels = channels_last ? output.get_shape().back() : output.get_shape()[1];
+    T* output_data = output.data<T>();
+
+    for (size_t f = 0; f < num_frames; ++f) {
+        const std::vector<float>& values = frames.values[f];
+        const std::vector<float>& weights = frames.weights[f];
+        for (size_t b = 0; b < batch; ++b) {
+            for (size_t p = 0; p < height * width; ++p) {
+                for (size_t c = 0; c < channels; ++c) {
+                    const size_t index = channels_last ? ((b * num_frames + f) * height * width + p) * channels + c
+                                                       : (b * channels + c) * height * width + p;
+                    output_data[index] = convert_value<T>(values[(b * height * width + p) * channels + c] / weights[p]);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+std::vector<size_t> get_tile_begins(size_t size, size_t tile_size, size_t overlap, size_t alignment) {
+    OPENVINO_ASSERT(overlap < tile_size, "Tile overlap ", overlap, " must be less than tile size ", tile_size);
+    if (size <= tile_size) {
+        return {0};
+    }
+
+    OPENVINO_ASSERT(size % alignment == 0 && tile_size % alignment == 0,
+                    "Size ", size, " and tile size ", tile_size, " must be divisible by ", alignment);
+    const size_t stride = (tile_size - overlap) / alignment * alignment;
+    OPENVINO_ASSERT(stride > 0, "Tile size ", tile_size, " must exceed tile overlap ", overlap, " by at least ", alignment);
+
+    std::vector<size_t> begins;
+    for (size_t begin = 0; begin + tile_size < size; begin += stride) {
+        begins.push_back(begin);
+    }
+    begins.push_back(size - tile_size);
+    return begins;
+}
+
+std::vector<float> get_blend_weights(size_t begin, size_t end, size_t prev_end, size_t next_begin) {
+    std::vector<float> weights(end - begin, 1.0f);
+
+    const size_t left_overlap = prev_end > begin ? std::min(prev_end, end) - begin : 0;
+    for (size_t i = 0; i < left_overlap; ++i) {
+        weights[i] *= static_cast<float>(i + 1) / (left_overlap + 1);
+    }
+
+    const size_t right_overlap = next_begin < end ? end - std::max(next_begin, begin) : 0;
+    for (size_t i = 0; i < right_overlap; ++i) {
+        weights[weights.size() - right_overlap + i] *= static_cast<float>(right_overlap - i) / (right_overlap + 1);
+    }
+
+    return weights;
+}
+
+void init_tile_infer_requests(std::vector<ov::InferRequest>& requests, const ov::InferRequest& request, size_t num_requests) {
+    OPENVINO_ASSERT(num_requests > 0, "Number of infer requests must be greater than 0");
+    if (requests.empty()) {
+        requests.push_back(request);
+    }
+    while (requests.size() < num_requests) {
+        requests.push_back(request.get_compiled_model().create_infer_request());
+    }
+    requests.resize(num_requests);
+}
+
+void infer_tiled(std::vector<ov::InferRequest>& requests,
+                 const ov::Tensor& input,
+                 const VAETilingParams& params,
+                 const std::function<void(const ov::Tensor&)>& frames_callback) {
+    const ov::Shape& shape = input.get_shape();
+    OPENVINO_ASSERT(shape.size() == 4 || shape.size() == 5, "VAE tiling expects input of rank 4 or 5, got ", shape);
+    OPENVINO_ASSERT(input.get_element_type() == ov::element::f32, "VAE tiling expects f32 input");
+    OPENVINO_ASSERT(!requests.empty(), "VAE tiling requires at least one infer request");
+
+    const bool is_video = shape.size() == 5;
+    OPENVINO_ASSERT(!is_video || params.channels_last, "VAE tiling supports channels last video outputs only");
+    const size_t num_frames = is_video ? shape[2] : 1, height = shape[shape.size() - 2], width = shape.back();
+
+    const std::vector<size_t> frame_begins = get_tile_begins(num_frames, params.tile_size[0], params.overlap[0]);
+    const std::vector<size_t> y_begins = get_tile_begins(height, params.tile_size[1], params.overlap[1], params.alignment);
+    const std::vector<size_t> x_begins = get_tile_begins(width, params.tile_size[2], params.overlap[2], params.alignment);
+    const size_t tile_frames = std::min(params.tile_size[0], num_frames);
+    const size_t tile_height = std::min(params.tile_size[1], height), tile_width = std::min(params.tile_size[2], width);
+
+    const auto output_frame = [&params] (size_t frame) {
+        return frame * params.temporal_scale;
+    };
+    const auto output_position = [&params] (size_t position) {
+        return position * params.spatial_scale_num / params.spatial_scale_den;
+    };
+    const size_t output_frames = (num_frames - 1) * params.temporal_scale + 1;
+    const size_t output_height = output_position(height), output_width = output_position(width);
+    const size_t output_tile_frames = (tile_frames - 1) * params.temporal_scale + 1;
+    const size_t output_tile_height = output_position(tile_height), output_tile_width = output_position(tile_width);
+
+    // blending weights of tiles along an axis of the output
+    const auto get_axis_weights = [] (const std::vector<size_t>& begins, size_t tile_size) {
+        std::vector<std::vector<float>> weights;
+        for (size_t i = 0; i < begins.size(); ++i) {
+            const size_t prev_end = i > 0 ? begins[i - 1] + tile_size : begins[i];
+            const size_t next_begin = i + 1 < begins.size() ? begins[i + 1] : begins[i] + tile_size;
+            weights.push_back(get_blend_weights(begins[i], begins[i] + tile_size, prev_end, next_begin));
+        }
+        return weights;
+    };
+    std::vector<size_t> output_frame_begins, output_y_begins, output_x_begins;
+    std::transform(frame_begins.begin(), frame_begins.end(), std::back_inserter(output_frame_begins), output_frame);
+    std::transform(y_begins.begin(), y_begins.end(), std::back_inserter(output_y_begins), output_position);
+    std::transform(x_begins.begin(), x_begins.end(), std::back_inserter(output_x_begins), output_position);
+    const auto frame_weights = get_axis_weights(output_frame_begins, output_tile_frames);
+    const auto y_weights = get_axis_weights(output_y_begins, output_tile_height);
+    const auto x_weights = get_axis_weights(output_x_begins, output_tile_width);
+
+    BlendedFrames frames;
+    ov::element::Type output_type;
+    size_t output_channels = 0;
+
+    for (size_t frame_tile = 0; frame_tile < frame_begins.size(); ++frame_tile) {
+        const size_t frame_begin = output_frame_begins[frame_tile];
+
+        for (size_t first_tile = 0; first_tile < y_begins.size() * x_begins.size(); first_tile += requests.size()) {
+            const size_t num_tiles = std::min(requests.size(), y_begins.size() * x_begins.size() - first_tile);
+            for (size_t r = 0; r < num_tiles; ++r) {
+                const size_t y_tile = (first_tile + r) / x_begins.size(), x_tile = (first_tile + r) % x_begins.size();
+                requests[r].set_input_tensor(get_input_tile(input, frame_begins[frame_tile], y_begins[y_tile], x_begins[x_tile],
+                                                            tile_frames, tile_height, tile_width));
+                requests[r].start_async();
+            }
+
+            for (size_t r = 0; r < num_tiles; ++r) {
+                requests[r].wait();
+                const ov::Tensor tile = requests[r].get_output_tensor();
+                const ov::Shape& tile_shape = tile.get_shape();
+
+                const ov::Shape expected_shape = !params.channels_last ? ov::Shape{shape[0], tile_shape[1], output_tile_height, output_tile_width}
+                                                 : is_video ? ov::Shape{shape[0], output_tile_frames, output_tile_height, output_tile_width, tile_shape.back()}
+                                                 : ov::Shape{shape[0], output_tile_height, output_tile_width, tile_shape.back()};
+                OPENVINO_ASSERT(tile_shape == expected_shape, "VAE output tile of shape ", tile_shape, " is expected to have shape ", expected_shape);
+
+                if (output_channels == 0) {
+                    output_type = tile.get_element_type();
+                    output_channels = params.channels_last ? tile_shape.back() : tile_shape[1];
+                }
+                // allocate frames the tile covers
+                while (frames.first_frame + frames.values.size() < frame_begin + output_tile_frames) {
+                    frames.values.emplace_back(shape[0] * output_height * output_width * output_channels, 0.0f);
+                    frames.weights.emplace_back(output_height * output_width, 0.0f);
+                }
+
+                const size_t y_tile = (first_tile + r) / x_begins.size(), x_tile = (first_tile + r) % x_begins.size();
+                if (output_type == ov::element::u8) {
+                    accumulate_tile<uint8_t>(frames, tile, params.channels_last, frame_begin, output_y_begins[y_tile], output_x_begins[x_tile],
+                                             output_height, output_width, frame_weights[frame_tile], y_weights[y_tile], x_weights[x_tile]);
+                } else if (output_type == ov::element::f32) {
+                    accumulate_tile<float>(frames, tile, params.channels_last, frame_begin, output_y_begins[y_tile], output_x_begins[x_tile],
+                                           output_height, output_width, frame_weights[frame_tile], y_weights[y_tile], x_weights[x_tile]);
+                } else {
+                    OPENVINO_THROW("VAE tiling supports u8 and f32 outputs, got ", output_type);
+                }
+            }
+        }
+
+        // frames before the next tile along frames axis are final
+        const size_t ready_end = frame_tile + 1 < frame_begins.size() ? output_frame_begins[frame_tile + 1] : output_frames;
+        const size_t num_ready_frames = ready_end - frames.first_frame;
+        const ov::Shape frames_shape = !params.channels_last ? ov::Shape{shape[0], output_channels, output_height, output_width}
+                                       : is_video ? ov::Shape{shape[0], num_ready_frames, output_height, output_width, output_channels}
+                                       : ov::Shape{shape[0], output_height, output_width, output_channels};
+        ov::Tensor ready_frames(output_type, frames_shape);
+        if (output_type == ov::element::u8) {
+            write_frames<uint8_t>(frames, num_ready_frames, output_height, output_width, params.channels_last, ready_frames);
+        } else {
+            write_frames<float>(frames, num_ready_frames, output_height, output_width, params.channels_last, ready_frames);
+        }
+
+        frames.values.erase(frames.values.begin(), frames.values.begin() + num_ready_frames);
+        frames.weights.erase(frames.weights.begin(), frames.weights.begin() + num_ready_frames);
+        frames.first_frame = ready_end;
+        frames_callback(ready_frames);
+    }
+}
+
+ov::Tensor infer_tiled(std::vector<ov::InferRequest>& requests, const ov::Tensor& input, const VAETilingParams& params) {
+    const bool is_video = input.get_shape().size() == 5;
+    ov::Tensor output;
+    size_t num_frames = 0;
+
+    infer_tiled(requests, input, params, [&] (const ov::Tensor& frames) {
+        if (!is_video) {
+            output = frames;
+            return;
+        }
+
+        const ov::Shape& frames_shape = frames.get_shape();
+        if (!output) {
+            ov::Shape output_shape = frames_shape;
+            output_shape[1] = (input.get_shape()[2] - 1) * params.temporal_scale + 1;
+            output = ov::Tensor(frames.get_element_type(), output_shape);
+        }
+
+        // copy frames of each video of the batch
+        const size_t frame_size = frames.get_byte_size() / frames_shape[0] / frames_shape[1];
+        const size_t output_frames = output.get_shape()[1];
+        for (size_t b = 0; b < frames_shape[0]; ++b) {
+            std::memcpy(static_cast<uint8_t*>(output.data()) + (b * output_frames + num_frames) * frame_size,
+                        static_cast<const uint8_t*>(frames.data()) + b * frames_shape[1] * frame_size,
+                        frames_shape[1] * frame_size);
+        }
+        num_frames += frames_shape[1];
+    });
+
+    return output;
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,68 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <vector>
+
+#include "openvino/runtime/infer_request.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Splits an axis into tiles of tile_size elements which overlap by at least overlap elements. Tiles begin at
+ * multiples of alignment and the last one ends at the end of the axis, so all tiles have the same size.
+ * @return first elements of the tiles
+ */
+std::vector<size_t> get_tile_begins(size_t size, size_t tile_size, size_t overlap, size_t alignment = 1);
+
+/**
+ * @brief Computes blending weights of tile elements [begin, end) given that the previous tile ends at prev_end and the
+ * next one begins at next_begin. Weights ramp up over the overlap with the previous tile and down over the overlap with
+ * the next one, so weights of two overlapping tiles sum to 1.
+ */
+std::vector<float> get_blend_weights(size_t begin, size_t end, size_t prev_end, size_t next_begin);
+
+/**
+ * @brief Makes requests hold num_requests infer requests of the compiled model of a given one, the first of them is the
+ * given request itself.
+ */
+void init_tile_infer_requests(std::vector<ov::InferRequest>& requests, const ov::InferRequest& request, size_t num_requests);
+
+struct VAETilingParams {
+    // tile size and minimal overlap of tiles along frames, height and width axes of the input
+    std::array<size_t, 3> tile_size;
+    std::array<size_t, 3> overlap;
+    // alignment of tile positions along height and width axes of the input
+    size_t alignment = 1;
+    // an input tile [begin, end) along height and width axes produces outputs [begin * num / den, end * num / den)
+    size_t spatial_scale_num = 1, spatial_scale_den = 1;
+    // an input tile [begin, end) along frames axis produces output frames [begin * scale, (end - 1) * scale + 1),
+    // which is also the case for images with a single frame
+    size_t temporal_scale = 1;
+    // layout of outputs, NHWC / NDHWC or NCHW
+    bool channels_last = true;
+};
+
+/**
+ * @brief Infers a VAE model by tiles of its f32 input [B, C, H, W] or [B, C, F, H, W] and blends the output tiles.
+ * Tiles of the same frames are inferred in parallel by the given requests. Tiles along frames axis are processed in
+ * order, so output frames are passed to the callback as soon as no further tile covers them.
+ * @param frames_callback called with consecutive output frames [B, F, H, W, C], or with the whole output for images
+ */
+void infer_tiled(std::vector<ov::InferRequest>& requests,
+                 const ov::Tensor& input,
+                 const VAETilingParams& params,
+                 const std::function<void(const ov::Tensor&)>& frames_callback);
+
+/**
+ * @brief Infers a VAE model by tiles of its input and returns the whole blended output
+ */
+ov::Tensor infer_tiled(std::vector<ov::InferRequest>& requests, const ov::Tensor& input, const VAETilingParams& params);
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,233 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "llm/kv_state_store.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/runtime/remote_tensor.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+bool is_compressible(ov::element::Type type) {
+    return type == ov::element::f32 || type == ov::element::f16 || type == ov::element::bf16;
+}
+
+size_t get_row_size(const ov::Shape& shape) {
+    return shape.empty() ? 1 : shape.back();
+}
+
+size_t get_num_rows(const ov::Shape& shape) {
+    const size_t row_size = get_row_size(shape);
+    return row_size == 0 ? 0 : ov::shape_size(shape) / row_size;
+}
+
+template <typename T>
+void quantize_rows(const T* src, size_t num_rows, size_t row_size, uint8_t* dst, float* scales, float* offsets) {
+    ov::parallel_for(num_rows, [&](size_t row) {
+        const T* src_row = src + row * row_size;
+        float min_value = static_cast<float>(src_row[0]), max_value = min_value;
+        for (size_t i = 1; i < row_size; ++i) {
+            const float value = static_cast<float>(src_row[i]);
+            min_value = std::min(min_value, value);
+            max_value = std::max(max_value, value);
+        }
+        const float scale = max_value > min_value ? (max_value - min_value) / 255.f : 1.f;
+        const float inv_scale = 1.f / scale;
+        uint8_t* dst_row = dst + row * row_size;
+        for (size_t i = 0; i < row_size; ++i) {
+            const float q = std::nearbyint((static_cast<float>(src_row[i]) - min_value) * inv_scale);
+            dst_row[i] = static_cast<uint8_t>(std::clamp(q, 0.f, 255.f));
+        }
+        scales[row] = scale;
+        offsets[row] = min_value;
+    });
+}
+
+template <typename T>
+void dequantize_rows(const uint8_t* src, size_t num_rows, size_t row_size, const float* scales, const float* offsets, T* dst) {
+    ov::parallel_for(num_rows, [&](size_t row) {
+        const uint8_t* src_row = src + row * row_size;
+        T* dst_row = dst + row * row_size;
+        for (size_t i = 0; i < row_size; ++i) {
+            dst_row[i] = T(src_row[i] * scales[row] + offsets[row]);
+        }
+    });
+}
+
+template <typename Src, typename Dst>
+void convert(const Src* src, size_t num_rows, size_t row_size, Dst* dst) {
+    ov::parallel_for(num_rows, [&](size_t row) {
+        for (size_t i = row * row_size; i < (row + 1) * row_size; ++i) {
+            dst[i] = Dst(static_cast<float>(src[i]));
+        }
+    });
+}
+
+template <template <typename> class Func, typename... Args>
+void dispatch_float_type(ov::element::Type type, Args&&... args) {
+    switch (type) {
+    case ov::element::f32:
+        Func<float>{}(std::forward<Args>(args)...);
+        break;
+    case ov::element::f16:
+        Func<ov::float16>{}(std::forward<Args>(args)...);
+        break;
+    case ov::element::bf16:
+        Func<ov::bfloat16>{}(std::forward<Args>(args)...);
+        break;
+    default:
+        OPENVINO_THROW("Unsupported element type ", type, " of KV cache state");
+    }
+}
+
+template <typename T>
+struct Quantize {
+    void operator()(const ov::Tensor& src, ov::Tensor& dst, ov::Tensor& scales, ov::Tensor& offsets) const {
+        quantize_rows(src.data<const T>(), scales.get_size(), get_row_size(src.get_shape()),
+                      dst.data<uint8_t>(), scales.data<float>(), offsets.data<float>());
+    }
+};
+
+template <typename T>
+struct Dequantize {
+    void operator()(const ov::Tensor& src, const ov::Tensor& scales, const ov::Tensor& offsets, ov::Tensor& dst) const {
+        dequantize_rows(src.data<const uint8_t>(), scales.get_size(), get_row_size(src.get_shape()),
+                        scales.data<const float>(), offsets.data<const float>(), dst.data<T>());
+    }
+};
+
+size_t get_stored_size(const std::vector<ov::Tensor>& tensors) {
+    size_t size = 0;
+    for (const auto& tensor : tensors) {
+        size += tensor ? tensor.get_byte_size() : 0;
+    }
+    return size;
+}
+
+}  // namespace
+
+KVStateStore::KVStateStore(size_t max_size_in_bytes, ov::element::Type precision)
+    : m_max_size_in_bytes(max_size_in_bytes),
+      m_precision(precision) {
+    OPENVINO_ASSERT(m_precision == ov::element::dynamic || m_precision == ov::element::f16 || m_precision == ov::element::u8,
+                    "KV state snapshots may be compressed to f16 or u8 only, got ", m_precision);
+}
+
+KVStateStore::StoredTensor KVStateStore::_compress(const std::string& name, const ov::Tensor& tensor) const {
+    StoredTensor stored{name, tensor.get_element_type()};
+    const auto& shape = tensor.get_shape();
+    const size_t num_rows = get_num_rows(shape), row_size = get_row_size(shape);
+
+    // states of remote or strided tensors are copied to a host buffer first
+    ov::Tensor host_tensor = tensor;
+    const bool needs_compression = is_compressible(tensor.get_element_type()) &&
+        (m_precision == ov::element::u8 || (m_precision == ov::element::f16 && tensor.get_element_type() == ov::element::f32));
+    if (!needs_compression || !tensor.is_continuous() || tensor.is<ov::RemoteTensor>()) {
+        host_tensor = ov::Tensor(tensor.get_element_type(), shape);
+        tensor.copy_to(host_tensor);
+    }
+    if (!needs_compression) {
+        stored.data = host_tensor;
+        return stored;
+    }
+
+    if (m_precision == ov::element::f16) {
+        stored.data = ov::Tensor(ov::element::f16, shape);
+        convert(host_tensor.data<const float>(), num_rows, row_size, stored.data.data<ov::float16>());
+        return stored;
+    }
+
+    stored.data = ov::Tensor(ov::element::u8, shape);
+    stored.scales = ov::Tensor(ov::element::f32, {num_rows});
+    stored.offsets = ov::Tensor(ov::element::f32, {num_rows});
+    dispatch_float_type<Quantize>(host_tensor.get_element_type(), host_tensor, stored.data, stored.scales, stored.offsets);
+    return stored;
+}
+
+ov::Tensor KVStateStore::_decompress(const StoredTensor& stored) {
+    const auto& shape = stored.data.get_shape();
+    ov::Tensor tensor(stored.original_type, shape);
+    // a copy is returned even for uncompressed states, so that the snapshot isn't changed through the restored state
+    if (stored.data.get_element_type() == stored.original_type) {
+        stored.data.copy_to(tensor);
+    } else if (stored.data.get_element_type() == ov::element::f16) {
+        convert(stored.data.data<const ov::float16>(), get_num_rows(shape), get_row_size(shape), tensor.data<float>());
+    } else {
+        dispatch_float_type<Dequantize>(stored.original_type, stored.data, stored.scales, stored.offsets, tensor);
+    }
+    return tensor;
+}
+
+bool KVStateStore::put(const std::string& id, const NamedTensors& states) {
+    erase(id);
+
+    Entry entry{id, {}, 0};
+    entry.tensors.reserve(states.size());
+    for (const auto& [name, tensor] : states) {
+        entry.tensors.push_back(_compress(name, tensor));
+        const auto& stored = entry.tensors.back();
+        entry.size_in_bytes += get_stored_size({stored.data, stored.scales, stored.offsets});
+    }
+    if (entry.size_in_bytes > m_max_size_in_bytes) {
+        return false;
+    }
+
+    m_size_in_bytes += entry.size_in_bytes;
+    m_entries.push_front(std::move(entry));
+    m_id_to_entry[id] = m_entries.begin();
+
+    while (m_size_in_bytes > m_max_size_in_bytes) {
+        const Entry& lru_entry = m_entries.back();
+        m_size_in_bytes -= lru_entry.size_in_bytes;
+        m_id_to_entry.erase(lru_entry.id);
+        m_entries.pop_back();
+    }
+    return true;
+}
+
+std::optional<KVStateStore::NamedTensors> KVStateStore::get(const std::string& id) {
+    auto it = m_id_to_entry.find(id);
+    if (it == m_id_to_entry.end()) {
+        return std::nullopt;
+    }
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+    NamedTensors states;
+    states.reserve(it->second->tensors.size());
+    for (const auto& stored : it->second->tensors) {
+        states.emplace_back(stored.name, _decompress(stored));
+    }
+    return states;
+}
+
+void KVStateStore::erase(const std::string& id) {
+    auto it = m_id_to_entry.find(id);
+    if (it == m_id_to_entry.end()) {
+        return;
+    }
+    m_size_in_bytes -= it->second->size_in_bytes;
+    m_entries.erase(it->second);
+    m_id_to_entry.erase(it);
+}
+
+bool KVStateStore::contains(const std::string& id) const {
+    return m_id_to_entry.count(id) != 0;
+}
+
+size_t KVStateStore::num_entries() const {
+    return m_entries.size();
+}
+
+size_t KVStateStore::size_in_bytes() const {
+    return m_size_in_bytes;
+}
+
+}  // namespace ov::genai
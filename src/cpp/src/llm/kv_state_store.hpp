@@ -0,0 +1,81 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief LRU store of KV cache snapshots of chat sessions bounded by the total size of the stored tensors. Snapshots
+ * are host copies of the model variable states, which are optionally compressed to f16 or to u8 with a scale and
+ * a zero point per row of the last dimension (per head of each token for KV cache states).
+ */
+class KVStateStore {
+public:
+    using NamedTensors = std::vector<std::pair<std::string, ov::Tensor>>;
+
+    /**
+     * @param max_size_in_bytes Max total size of stored snapshots.
+     * @param precision Precision to compress floating point states to: f16, u8, or ov::element::dynamic to keep them
+     * as is.
+     */
+    explicit KVStateStore(size_t max_size_in_bytes, ov::element::Type precision = ov::element::dynamic);
+
+    /**
+     * Stores a copy of the states evicting the least recently used snapshots if the memory budget is exceeded.
+     * A previous snapshot with the same id is replaced.
+     * @return false if the snapshot alone exceeds the budget and was not stored.
+     */
+    bool put(const std::string& id, const NamedTensors& states);
+
+    /**
+     * Looks for a snapshot and marks it as the most recently used one.
+     * @return States decompressed to their original precision or std::nullopt if the snapshot was never stored or
+     * has been evicted.
+     */
+    std::optional<NamedTensors> get(const std::string& id);
+
+    void erase(const std::string& id);
+
+    bool contains(const std::string& id) const;
+
+    size_t num_entries() const;
+
+    size_t size_in_bytes() const;
+
+private:
+    struct StoredTensor {
+        std::string name;
+        ov::element::Type original_type;
+        ov::Tensor data;
+        // set for u8 compressed tensors only, one value per row of the last dimension: value = q * scale + offset
+        ov::Tensor scales, offsets;
+    };
+
+    struct Entry {
+        std::string id;
+        std::vector<StoredTensor> tensors;
+        size_t size_in_bytes;
+    };
+
+    size_t m_max_size_in_bytes;
+    ov::element::Type m_precision;
+    size_t m_size_in_bytes = 0;
+    // most recently used entries go first
+    std::list<Entry> m_entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_id_to_entry;
+
+    StoredTensor _compress(const std::string& name, const ov::Tensor& tensor) const;
+    static ov::Tensor _decompress(const StoredTensor& stored);
+};
+
+}  // namespace ov::genai
@@ -401,6 +401,18 @@ void ov::genai::LLMPipeline::finish_chat() {
     m_pimpl->finish_chat();
 }
 
+void ov::genai::LLMPipeline::create_session(const std::string& session_id) {
+    m_pimpl->create_session(session_id);
+}
+
+void ov::genai::LLMPipeline::resume_session(const std::string& session_id) {
+    m_pimpl->resume_session(session_id);
+}
+
+void ov::genai::LLMPipeline::close_session(const std::string& session_id) {
+    m_pimpl->close_session(session_id);
+}
+
 void ov::genai::LLMPipeline::set_generation_config(const GenerationConfig& config) {
     m_pimpl->set_generation_config(config);
 }
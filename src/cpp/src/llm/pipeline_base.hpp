@@ -60,6 +60,18 @@ public:
     virtual void start_chat(const std::string& system_message) = 0;
     virtual void finish_chat() = 0;
 
+    virtual void create_session(const std::string& session_id) {
+        OPENVINO_THROW("Chat sessions are supported by the stateful LLM pipeline only, set ATTENTION_BACKEND to SDPA to use them");
+    }
+
+    virtual void resume_session(const std::string& session_id) {
+        OPENVINO_THROW("Chat sessions are supported by the stateful LLM pipeline only, set ATTENTION_BACKEND to SDPA to use them");
+    }
+
+    virtual void close_session(const std::string& session_id) {
+        OPENVINO_THROW("Chat sessions are supported by the stateful LLM pipeline only, set ATTENTION_BACKEND to SDPA to use them");
+    }
+
     virtual ~LLMPipelineImplBase() = default;
 
     void save_load_time(std::chrono::steady_clock::time_point start_time) {
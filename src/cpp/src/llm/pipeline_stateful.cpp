@@ -4,12 +4,33 @@
 
 #include "llm/pipeline_stateful.hpp"
 
+#include "logger.hpp"
 #include "lora/helper.hpp"
 #include "lm_encoding.hpp"
 #include "openvino/genai/text_streamer.hpp"
 
 #include "utils.hpp"
 
+namespace {
+
+std::optional<ov::genai::KVStateStore> extract_kv_state_store(ov::AnyMap& properties, size_t default_cache_size_mb) {
+    auto cache_size = ov::genai::utils::pop_option(properties, ov::genai::session_cache_size.name());
+    auto precision = ov::genai::utils::pop_option(properties, ov::genai::session_cache_precision.name());
+    if (!cache_size && !precision) {
+        return std::nullopt;
+    }
+
+    size_t cache_size_mb = default_cache_size_mb;
+    if (cache_size) {
+        // NB: Integer value coming from python has int64_t datatype
+        cache_size_mb = cache_size->is<int64_t>() ? static_cast<size_t>(cache_size->as<int64_t>()) : cache_size->as<size_t>();
+    }
+    return ov::genai::KVStateStore(cache_size_mb * 1024 * 1024,
+                                   precision ? precision->as<ov::element::Type>() : ov::element::dynamic);
+}
+
+} // namespace
+
 namespace ov::genai {
 
 StatefulLLMPipeline::StatefulLLMPipeline(
@@ -66,6 +87,9 @@ StatefulLLMPipeline::StatefulLLMPipeline(
         m_kv_cache_state.seq_length_axis = kv_pos.seq_len;
 
     auto [filtered_properties_without_gguf, enable_save_ov_model] = utils::extract_gguf_properties(properties);
+    if (auto kv_state_store = extract_kv_state_store(filtered_properties_without_gguf, DEFAULT_SESSION_CACHE_SIZE_MB)) {
+        m_kv_state_store = std::move(*kv_state_store);
+    }
     auto filtered_properties = extract_adapters_from_properties(filtered_properties_without_gguf, &m_generation_config.adapters);
     if (m_generation_config.adapters) {
         m_generation_config.adapters->set_tensor_name_prefix("base_model.model.");
@@ -501,17 +525,107 @@ void StatefulLLMPipeline::reset_kv_state() {
     }
 }
 
+void StatefulLLMPipeline::reset_chat_state() {
+    reset_kv_state();
+    m_model_runner.get_tensor("attention_mask").set_shape({1, 0});
+    m_history.clear();
+    m_tokenized_chat_history.clear();
+    m_kv_cache_state.reset_state();
+}
+
 void StatefulLLMPipeline::finish_chat() {
     is_chat_conversation = false;
     m_chat_input_type = ov::genai::utils::GenerationChatInputsType::UNDEF;
     bool have_state = 0 != m_model_runner.get_tensor("attention_mask").get_size();
     if (!m_kv_cache_state.get_state().empty() || have_state) {
-        reset_kv_state();
-        m_model_runner.get_tensor("attention_mask").set_shape({1, 0});
-        m_history.clear();
-        m_tokenized_chat_history.clear();
-        m_kv_cache_state.reset_state();
+        reset_chat_state();
+    }
+}
+
+void StatefulLLMPipeline::save_active_session() {
+    if (!m_active_session_id)
+        return;
+
+    ChatSession& session = m_sessions[*m_active_session_id];
+    session.history = m_history;
+    session.tokenized_chat_history = m_tokenized_chat_history;
+    session.chat_input_type = m_chat_input_type;
+    session.kv_cache_state = m_kv_cache_state;
+    auto attention_mask = m_model_runner.get_tensor("attention_mask");
+    session.attention_mask = ov::Tensor(attention_mask.get_element_type(), attention_mask.get_shape());
+    if (attention_mask.get_size() > 0)
+        attention_mask.copy_to(session.attention_mask);
+
+    // KV cache is not reused between generate() calls if the full history is used as a prompt
+    KVStateStore::NamedTensors states;
+    if (!m_use_full_chat_history) {
+        for (auto& state : m_model_runner.query_state()) {
+            if (!m_adapter_controller || !m_adapter_controller->has_state_name(state.get_name()))
+                states.emplace_back(state.get_name(), state.get_state());
+        }
+    }
+    if (!m_kv_state_store.put(*m_active_session_id, states)) {
+        GENAI_WARN("KV cache of chat session '" + *m_active_session_id + "' exceeds session_cache_size, "
+                   "its history will be processed again on resume");
+    }
+    m_active_session_id.reset();
+}
+
+void StatefulLLMPipeline::create_session(const std::string& session_id) {
+    OPENVINO_ASSERT(m_active_session_id != session_id && m_sessions.count(session_id) == 0,
+                    "Chat session '", session_id, "' already exists");
+    save_active_session();
+    reset_chat_state();
+    m_chat_input_type = ov::genai::utils::GenerationChatInputsType::UNDEF;
+    is_chat_conversation = true;
+    m_active_session_id = session_id;
+}
+
+void StatefulLLMPipeline::resume_session(const std::string& session_id) {
+    if (m_active_session_id == session_id)
+        return;
+    OPENVINO_ASSERT(m_sessions.count(session_id) != 0, "Chat session '", session_id, "' doesn't exist");
+
+    save_active_session();
+    reset_chat_state();
+    is_chat_conversation = true;
+    m_active_session_id = session_id;
+
+    auto session_it = m_sessions.find(session_id);
+    ChatSession session = std::move(session_it->second);
+    m_sessions.erase(session_it);
+    m_history = std::move(session.history);
+    m_tokenized_chat_history = std::move(session.tokenized_chat_history);
+    m_chat_input_type = session.chat_input_type;
+
+    auto states = m_kv_state_store.get(session_id);
+    if (!states) {
+        // The snapshot was evicted, so the KV cache stays empty and the whole history is used as the next prompt
+        return;
+    }
+    m_kv_state_store.erase(session_id);
+
+    if (!m_use_full_chat_history) {
+        std::unordered_map<std::string, ov::Tensor> name_to_state(states->begin(), states->end());
+        for (auto& state : m_model_runner.query_state()) {
+            auto it = name_to_state.find(state.get_name());
+            if (it != name_to_state.end())
+                state.set_state(it->second);
+        }
+    }
+    m_kv_cache_state = session.kv_cache_state;
+    m_model_runner.set_tensor("attention_mask", session.attention_mask);
+}
+
+void StatefulLLMPipeline::close_session(const std::string& session_id) {
+    if (m_active_session_id == session_id) {
+        // the chat ends with its session, so that subsequent generate() calls don't continue it
+        finish_chat();
+        m_active_session_id.reset();
+        return;
     }
+    OPENVINO_ASSERT(m_sessions.erase(session_id) != 0, "Chat session '", session_id, "' doesn't exist");
+    m_kv_state_store.erase(session_id);
 }
 
 StatefulLLMPipeline::~StatefulLLMPipeline() {
@@ -3,7 +3,9 @@
 
 
 #include <limits>
+#include <unordered_map>
 
+#include "llm/kv_state_store.hpp"
 #include "llm/pipeline_base.hpp"
 #include "lm_encoding.hpp"
 #include "sampling/sampler.hpp"
@@ -12,6 +14,8 @@
 namespace ov::genai {
 
 class StatefulLLMPipeline final : public LLMPipelineImplBase {
+    static constexpr size_t DEFAULT_SESSION_CACHE_SIZE_MB = 1024;
+
     ov::InferRequest m_model_runner;
     Sampler m_sampler;
 
@@ -30,7 +34,23 @@ class StatefulLLMPipeline final : public LLMPipelineImplBase {
     // include reflection of tokens contained in the kv cache and amount of tokens, which are needed to trim from kv cache on the next step of chat
     utils::KVCacheState m_kv_cache_state;
 
+    // Chat state of an inactive session, its KV cache is kept in m_kv_state_store
+    struct ChatSession {
+        ChatHistory history;
+        std::vector<int64_t> tokenized_chat_history;
+        ov::genai::utils::GenerationChatInputsType chat_input_type = ov::genai::utils::GenerationChatInputsType::UNDEF;
+        utils::KVCacheState kv_cache_state;
+        ov::Tensor attention_mask;
+    };
+    std::unordered_map<std::string, ChatSession> m_sessions;
+    std::optional<std::string> m_active_session_id;
+    // may be configured by session_cache_size and session_cache_precision properties
+    KVStateStore m_kv_state_store{DEFAULT_SESSION_CACHE_SIZE_MB * 1024 * 1024};
+
     void reset_kv_state();
+    void reset_chat_state();
+    // saves the chat state of the active session to m_sessions and its KV cache to m_kv_state_store
+    void save_active_session();
 public:
 
     StatefulLLMPipeline(
@@ -91,6 +111,12 @@ public:
 
     void finish_chat() override;
 
+    void create_session(const std::string& session_id) override;
+
+    void resume_session(const std::string& session_id) override;
+
+    void close_session(const std::string& session_id) override;
+
     ~StatefulLLMPipeline();
 };
 
@@ -225,6 +225,18 @@ NodePtr unsqueeze (const ov::Output<ov::Node>& input, unsigned int rank) {
 }
 
 
+// Unsqueeze 2D shape to add dimensions between the first and the last ones to have a tensor of a given rank,
+// so that the rows of the tensor are aligned with the leading dimension of the tensor it is multiplied by.
+NodePtr unsqueeze_rows (const ov::Output<ov::Node>& input, unsigned int rank) {
+    std::vector<int> dims(rank, 1);
+    dims.front() = 0;
+    dims.back() = -1;
+    auto shape = v0::Constant::create(ov::element::i32, {rank}, dims);
+    auto reshape = std::make_shared<v1::Reshape>(input, shape->output(0), true);
+    return reshape;
+}
+
+
 using LoRAWeightGetter = std::function<std::optional<LoRANode>(const std::string&)>;
 using LoRAConstantGetter = std::function<std::optional<NodePtr>(const std::string&)>;
 using LoRAWeightByNodeGetter = std::function<std::optional<LoRANode>(NodePtr)>;
@@ -238,7 +250,6 @@ struct LoRAParameters {
     ov::Dimension rank;         // accumulated LoRA rank, could be dynamic if rank is not known or DYNAMIC mode is applied
     ov::element::Type type;     // element type of a tensor that will be applied to the model, negotiated based on multiple LoRA adapters
     bool fine_grained_alpha;    // use 1D tensor of the same rank for alpha instead of a scalar to blend multiple weighted LoRAs
-    // TODO: flag to have various alphas over the batch
 };
 
 using LoRAParametersGetter = std::function<std::optional<LoRAParameters>(NodePtr node)>;
@@ -413,13 +424,17 @@ struct LoRAWeightStateGetter {
     LoRAParametersGetter params_getter;
     LoRAVarMap& variable_ids;
     // TODO: Use variable indices instead of variable_id for faster search for a state tensor
+    // Optional index of a row of alpha state for each token, used to apply different adapters to different tokens
+    NodePtr token_configs;
 
     LoRAWeightStateGetter(const LoRAParametersGetter& params_getter,
                           std::shared_ptr<ov::Model> model,
-                          LoRAVarMap& variable_ids)
+                          LoRAVarMap& variable_ids,
+                          NodePtr token_configs = nullptr)
         : model(model),
           params_getter(params_getter),
-          variable_ids(variable_ids) {}
+          variable_ids(variable_ids),
+          token_configs(token_configs) {}
 
     std::optional<LoRANode> operator() (NodePtr node) const {
         if(auto params = params_getter(node)) {
@@ -443,12 +458,22 @@ struct LoRAWeightStateGetter {
             result.A = add_variable(var_ids.A, model);
             // FIXME: No guarantees on ordering of state in InferRequest makes impossible using indices of variables later, forced to use variable_id instead
             //indices.A = model->get_variables().size();
+            bool per_token_alpha = token_configs && params->fine_grained_alpha;
+            // lm_head computes logits of the sampled positions only, so its activations don't match alpha rows of the tokens
+            OPENVINO_ASSERT(!per_token_alpha || name.find("lm_head") == std::string::npos,
+                "LoRA adapters targeting lm_head can't be applied per token. Use an adapter without lm_head weights, "
+                "or AdapterConfig::MODE_STATIC or AdapterConfig::MODE_FUSE to share adapters among all requests");
             var_ids.alpha = ov::op::util::VariableInfo{
-                params->fine_grained_alpha ? ov::PartialShape{1, params->rank} : ov::PartialShape{},
+                params->fine_grained_alpha ? ov::PartialShape{per_token_alpha ? ov::Dimension::dynamic() : ov::Dimension(1), params->rank} : ov::PartialShape{},
                 ov::element::f32,   // alpha is always f32 because it is set from host as float data type
                 variable_id_prefix + ".alpha"
             };
             result.alpha = add_variable(var_ids.alpha, model);
+            if(per_token_alpha) {
+                // alpha state has a row for each adapter config, pick the row of a given config for each token
+                auto axis = v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+                result.alpha = std::make_shared<v8::Gather>(result.alpha, token_configs, axis);
+            }
             // FIXME: No guarantees on ordering of state in InferRequest makes impossible using indices of variables later, forced to use variable_id instead
             //indices.B = model->get_variables().size();
             var_ids.B = ov::op::util::VariableInfo{
@@ -686,6 +711,13 @@ NodePtr tensors_multiplication(NodePtr input,
         if (input) {
             if (i == alpha_pos) {  // Multiply for alpha
                 // TODO: Apply alpha multiplication separately
+                auto alpha_shape = normalized->get_output_partial_shape(0);
+                auto input_rank = input->get_output_partial_shape(0).rank();
+                if (alpha_shape.rank().get_length() == 2 && alpha_shape[0] != ov::Dimension(1) && input_rank.is_static() && input_rank.get_length() > 2) {
+                    // Alpha has a row for each token. Tokens are enumerated by the leading dimension of activations
+                    // in continuous batching models: [num_tokens, 1, lora_rank]
+                    normalized = unsqueeze_rows(normalized, input_rank.get_length());
+                }
                 input = std::make_shared<v1::Multiply>(input, normalized);
             } else {  // MatMul for A and B
                 input = std::make_shared<v0::MatMul>(input,
@@ -1273,7 +1305,17 @@ struct AdapterControllerImpl {
     // Needed to track which LoRA tensors were actually applied to suppress unused tensor warnings
     std::shared_ptr<LoRAWeightGetterDefault<NodePtr, NodePtr>> const_getter_impl;
 
-    AdapterControllerImpl(std::shared_ptr<ov::Model> model, const AdapterConfig& config) :
+    // LoRA name -> index of an adapter in current_config and its LoRA rank, for each adapter applicable to the LoRA
+    std::map<std::string, std::vector<std::pair<size_t, size_t>>> applicable_adapter_ranks;
+
+    // Per-token adapters: the state keeps an index of adapter config for each token of the inference input,
+    // and alpha states keep a row with alphas of current_config adapters for each of the configs
+    std::optional<ov::op::util::VariableInfo> token_configs_variable_id;
+    size_t token_configs_state_index = 0;
+    // adapters and alphas of the configs set by the last apply_per_token call, one for each row of alpha states
+    std::vector<std::vector<std::pair<Adapter, float>>> token_configs;
+
+    AdapterControllerImpl(std::shared_ptr<ov::Model> model, const AdapterConfig& config, bool per_token_adapters = false) :
         current_config(config),  // FIXME: Compare current and passed configs and change incrementally
         lora_state_evaluators("CPU")    // FIXME: Try to run on the same device that is used for model inference
     {
@@ -1345,7 +1387,16 @@ struct AdapterControllerImpl {
         if(mode == AdapterConfig::MODE_DYNAMIC || mode == AdapterConfig::MODE_STATIC_RANK || mode == AdapterConfig::MODE_AUTO) {
             // State mode
             params_getter.dynamic_lora_rank = (mode != AdapterConfig::MODE_STATIC_RANK);
-            pm.register_pass<LoRASeparateTransform>(LoRAWeightStateGetter(params_getter, model, variable_ids));
+            NodePtr token_configs_node;
+            if (per_token_adapters) {
+                token_configs_variable_id = ov::op::util::VariableInfo{
+                    ov::PartialShape{ov::Dimension::dynamic()},
+                    ov::element::i32,
+                    "lora_state_token_configs"
+                };
+                token_configs_node = add_variable(*token_configs_variable_id, model);
+            }
+            pm.register_pass<LoRASeparateTransform>(LoRAWeightStateGetter(params_getter, model, variable_ids, token_configs_node));
             if (const_getter) {
                 LoRAStateGetterForConst getter = LoRAStateGetterForConst(const_getter, model, constant_variable_ids);
                 pm.register_pass<LoRAReplaceConstantTransformDynamic>(getter, getter.create_if_input());
@@ -1374,6 +1425,9 @@ struct AdapterControllerImpl {
         for(const auto& var: constant_variable_ids) {
             variable_names.insert(var.second.variable_id);
         }
+        if (token_configs_variable_id) {
+            variable_names.insert(token_configs_variable_id->variable_id);
+        }
     }
 
     static std::shared_ptr<AdapterImpl> get_adapter_impl(const Adapter& adapter) {
@@ -1423,16 +1477,132 @@ struct AdapterControllerImpl {
                 "Cannot change adapters and/or the alphas when not one of the dynamic modes are used.");
             current_config.update(*config);
         }
+        // alpha states keep rows for several configs after apply_per_token, switch back to a single config for all tokens
+        bool reset_token_configs = token_configs_variable_id && (need_full_apply || !token_configs.empty());
         if(need_full_apply) {
             need_full_apply = false;
             set_new_adapter_tensors(infer_request);
-        } else if(diff) {
-            if(diff.adapter) {
-                set_new_adapter_tensors(infer_request);
-            } else if(diff.alpha)  {
-                set_new_adapter_alphas(infer_request);
+        } else if(diff.adapter) {
+            set_new_adapter_tensors(infer_request);
+        } else if(diff.alpha || !token_configs.empty()) {
+            set_new_adapter_alphas(infer_request);
+        }
+        if(reset_token_configs) {
+            token_configs.clear();
+            ov::Tensor token_configs_tensor(ov::element::i32, ov::Shape{1});
+            token_configs_tensor.data<int32_t>()[0] = 0;
+            get_token_configs_state(infer_request).set_state(token_configs_tensor);
+        }
+    }
+
+    void apply_per_token(ov::InferRequest& infer_request,
+                         const std::vector<AdapterConfig>& configs,
+                         const std::vector<std::pair<size_t, size_t>>& token_ranges) {
+        OPENVINO_ASSERT(token_configs_variable_id, "AdapterController is not configured to apply different adapters to different tokens");
+        OPENVINO_ASSERT(!configs.empty(), "At least one adapter config is required");
+
+        // Adapters of all configs share A and B states, where they are concatenated along LoRA rank. Each token takes alphas
+        // of its config, which are zeros for the adapters that are not used by the config. The adapters which are not used
+        // anymore are dropped only when new adapters are added, so that changes of the batch composition don't lead to
+        // re-concatenation of A and B states on each inference.
+        const auto& current_adapters = current_config.get_adapters();
+        std::vector<Adapter> used_adapters;
+        bool has_new_adapters = false;
+        for (const auto& config : configs) {
+            for (const auto& adapter : config.get_adapters()) {
+                if (std::find(used_adapters.begin(), used_adapters.end(), adapter) == used_adapters.end()) {
+                    used_adapters.push_back(adapter);
+                    has_new_adapters |= std::find(current_adapters.begin(), current_adapters.end(), adapter) == current_adapters.end();
+                }
+            }
+        }
+        if (need_full_apply || has_new_adapters) {
+            need_full_apply = false;
+            std::vector<std::pair<Adapter, float>> adapters_and_alphas;
+            adapters_and_alphas.reserve(used_adapters.size());
+            for (const auto& adapter : used_adapters) {
+                adapters_and_alphas.emplace_back(adapter, 1.0f);
             }
+            current_config.set_adapters_and_alphas(adapters_and_alphas);
+            set_new_adapter_tensors(infer_request);
+            token_configs.clear();
+        }
+
+        std::vector<std::vector<std::pair<Adapter, float>>> new_token_configs;
+        new_token_configs.reserve(configs.size());
+        for (const auto& config : configs) {
+            new_token_configs.push_back(config.get_adapters_and_alphas());
+        }
+        if (new_token_configs != token_configs) {
+            token_configs = std::move(new_token_configs);
+            set_token_configs_alphas(infer_request);
         }
+
+        size_t num_tokens = 0;
+        for (const auto& [config_idx, config_num_tokens] : token_ranges) {
+            OPENVINO_ASSERT(config_idx < configs.size(), "Adapter config index ", config_idx, " is out of range");
+            num_tokens += config_num_tokens;
+        }
+        ov::Tensor token_configs_tensor(ov::element::i32, ov::Shape{num_tokens});
+        int32_t* token_configs_data = token_configs_tensor.data<int32_t>();
+        for (const auto& [config_idx, config_num_tokens] : token_ranges) {
+            token_configs_data = std::fill_n(token_configs_data, config_num_tokens, static_cast<int32_t>(config_idx));
+        }
+        get_token_configs_state(infer_request).set_state(token_configs_tensor);
+    }
+
+    VariableState get_token_configs_state(ov::InferRequest& infer_request) {
+        auto state = infer_request.query_state();
+        if (token_configs_state_index >= state.size() || state[token_configs_state_index].get_name() != token_configs_variable_id->variable_id) {
+            auto it = std::find_if(state.begin(), state.end(), [this](const VariableState& variable_state) {
+                return variable_state.get_name() == token_configs_variable_id->variable_id;
+            });
+            OPENVINO_ASSERT(it != state.end(), "Cannot find LoRA state ", token_configs_variable_id->variable_id);
+            token_configs_state_index = it - state.begin();
+        }
+        return state[token_configs_state_index];
+    }
+
+    void set_token_configs_alphas(ov::InferRequest& infer_request) {
+        // alpha of each current_config adapter for each of the token configs
+        const auto& adapters = current_config.get_adapters();
+        std::vector<std::vector<float>> config_alphas(token_configs.size(), std::vector<float>(adapters.size(), 0.0f));
+        for (size_t config_idx = 0; config_idx < token_configs.size(); ++config_idx) {
+            for (const auto& [adapter, alpha] : token_configs[config_idx]) {
+                auto it = std::find(adapters.begin(), adapters.end(), adapter);
+                OPENVINO_ASSERT(it != adapters.end());
+                config_alphas[config_idx][it - adapters.begin()] = alpha;
+            }
+        }
+
+        auto state = infer_request.query_state();
+        auto state_name_to_index = get_state_name_to_index(state);
+        for (const auto& lora_var_ids : variable_ids) {
+            auto ranks_it = applicable_adapter_ranks.find(lora_var_ids.first);
+            size_t lora_rank = 0;
+            if (ranks_it != applicable_adapter_ranks.end()) {
+                for (const auto& adapter_rank : ranks_it->second) {
+                    lora_rank += adapter_rank.second;
+                }
+            }
+            ov::Tensor alpha(ov::element::f32, ov::Shape{token_configs.size(), lora_rank});
+            float* alpha_data = alpha.data<float>();
+            for (size_t config_idx = 0; config_idx < token_configs.size() && lora_rank > 0; ++config_idx) {
+                for (const auto& [adapter_idx, adapter_rank] : ranks_it->second) {
+                    alpha_data = std::fill_n(alpha_data, adapter_rank, config_alphas[config_idx][adapter_idx]);
+                }
+            }
+            state[state_name_to_index.at(lora_var_ids.second.alpha.variable_id)].set_state(alpha);
+        }
+    }
+
+    std::map<std::string, size_t> get_state_name_to_index(const std::vector<VariableState>& state) {
+        std::map<std::string, size_t> state_name_to_index;
+        for(size_t i = 0; i < state.size(); ++i) {
+            auto name = state[i].get_name();
+            state_name_to_index[name] = i;
+        }
+        return state_name_to_index;
     }
 
     bool has_state_name(const std::string& name) {
@@ -1473,11 +1643,7 @@ struct AdapterControllerImpl {
 
         // Convert LoRAVarIDs to LoRAIndices to speedup search for state with a given name
         // TODO: If state order is stable, then the mapping should be done once for a given infer request, TODO: cache it based on the infer request
-        std::map<std::string, size_t> state_name_to_index;
-        for(size_t i = 0; i < state.size(); ++i) {
-            auto name = state[i].get_name();
-            state_name_to_index[name] = i;
-        }
+        auto state_name_to_index = get_state_name_to_index(state);
 
         for(const auto& lora_var_ids : variable_ids) {
             // FIXME: Remove this mapping when the order of state will be the same as the order of variables
@@ -1520,11 +1686,14 @@ struct AdapterControllerImpl {
         OPENVINO_ASSERT(weight_getters.size() == adapters.size());
         std::vector<LoRAWeight> result;
         result.reserve(weight_getters.size());
+        auto& adapter_ranks = applicable_adapter_ranks[lora_name];
+        adapter_ranks.clear();
         for(size_t i = 0; i < adapters.size(); ++i) {
             if(auto lora_tensors = weight_getters[i](lora_name)) {
                 // TODO: Is it practical to use alpha from the adapter file itself. In the current code it is ignored and only alpha from config is used.
                 OPENVINO_ASSERT(lora_tensors->A);
                 OPENVINO_ASSERT(lora_tensors->B);
+                adapter_ranks.emplace_back(i, lora_tensors->A->get_output_partial_shape(0)[0].get_length());
                 lora_tensors->alpha = alpha_as_constant(current_config.get_alpha(adapters[i]));
                 result.push_back(LoRAWeight(
                     std::dynamic_pointer_cast<v0::Constant>(lora_tensors->alpha),
@@ -1741,7 +1910,11 @@ struct AdapterControllerImpl {
 };
 
 
-AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device)
+AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device) :
+    AdapterController(model, config, device, false) {}
+
+
+AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device, bool per_token_adapters)
 {
     // If AdapterConfig::MODE_AUTO is used, then set real mode depending on the device capabilities
     // TODO: Remove this code when devices become aligned on their capabilities for LoRA adapters
@@ -1758,7 +1931,7 @@ AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const Ada
         if(default_mode != default_modes.end()) {
             AdapterConfig updated_config = config;
             updated_config.set_mode(default_mode->second);
-            m_pimpl = std::make_shared<AdapterControllerImpl>(model, updated_config);
+            m_pimpl = std::make_shared<AdapterControllerImpl>(model, updated_config, per_token_adapters);
             return;
         } else {
             std::string device_msg;
@@ -1773,7 +1946,7 @@ AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const Ada
                 << "To avoid this warning set one of the AdapterConfig::Mode values except MODE_AUTO.";
         }
     }
-    m_pimpl = std::make_shared<AdapterControllerImpl>(model, config);
+    m_pimpl = std::make_shared<AdapterControllerImpl>(model, config, per_token_adapters);
 }
 
 
@@ -1787,6 +1960,13 @@ void AdapterController::apply(ov::InferRequest request, const std::optional<Adap
     }
 }
 
+void AdapterController::apply_per_token(ov::InferRequest request,
+                                        const std::vector<AdapterConfig>& configs,
+                                        const std::vector<std::pair<size_t, size_t>>& token_ranges) {
+    OPENVINO_ASSERT(m_pimpl, "AdapterController is not configured to use adapters");
+    m_pimpl->apply_per_token(request, configs, token_ranges);
+}
+
 bool AdapterController::has_state_name(const std::string& name) {
     return m_pimpl->has_state_name(name);
 }
@@ -0,0 +1,151 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "prompt_lookup/ngram_index.hpp"
+
+#include <algorithm>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+
+constexpr uint64_t HASH_SEED = 0xcbf29ce484222325ULL;
+
+// n-gram hashes are built from the last token backwards, so that hashes of all n-grams ending at a position
+// are computed in a single pass
+uint64_t combine_hash(uint64_t hash, int64_t token) {
+    return (hash ^ static_cast<uint64_t>(token)) * 0x100000001b3ULL + 0x9e3779b97f4a7c15ULL;
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+NGramIndex::NGramIndex(size_t max_ngram_size) :
+    m_max_ngram_size(max_ngram_size),
+    m_occurrences(max_ngram_size),
+    m_prev_occurrence(max_ngram_size) {}
+
+void NGramIndex::append(int64_t token) {
+    m_tokens.push_back(token);
+    const size_t end = m_tokens.size();
+
+    uint64_t hash = HASH_SEED;
+    for (size_t ngram_size = 1; ngram_size <= std::min(m_max_ngram_size, end); ++ngram_size) {
+        const size_t start = end - ngram_size;
+        hash = combine_hash(hash, m_tokens[start]);
+
+        auto& prev_occurrence = m_prev_occurrence[ngram_size - 1];
+        auto [it, inserted] = m_occurrences[ngram_size - 1].try_emplace(hash, Occurrences{start, start});
+        if (inserted) {
+            prev_occurrence.push_back(NO_POSITION);
+        } else {
+            prev_occurrence.push_back(it->second.last);
+            it->second.last = start;
+        }
+    }
+}
+
+void NGramIndex::truncate(size_t length) {
+    while (m_tokens.size() > length) {
+        const size_t end = m_tokens.size();
+
+        uint64_t hash = HASH_SEED;
+        for (size_t ngram_size = 1; ngram_size <= std::min(m_max_ngram_size, end); ++ngram_size) {
+            const size_t start = end - ngram_size;
+            hash = combine_hash(hash, m_tokens[start]);
+
+            auto& prev_occurrence = m_prev_occurrence[ngram_size - 1];
+            auto it = m_occurrences[ngram_size - 1].find(hash);
+            OPENVINO_ASSERT(it != m_occurrences[ngram_size - 1].end() && it->second.last == start,
+                            "internal error - n-gram index is inconsistent");
+
+            const size_t prev = prev_occurrence[start];
+            if (prev == NO_POSITION) {
+                m_occurrences[ngram_size - 1].erase(it);
+            } else {
+                it->second.last = prev;
+            }
+            prev_occurrence.pop_back();
+        }
+        m_tokens.pop_back();
+    }
+}
+
+void NGramIndex::update(const TokenIds& prompt_ids, const TokenIds& generated_ids) {
+    const size_t length = prompt_ids.size() + generated_ids.size();
+    auto token_at = [&](size_t position) {
+        return position < prompt_ids.size() ? prompt_ids[position] : generated_ids[position - prompt_ids.size()];
+    };
+
+    // the prompt doesn't change, while any of the indexed generated tokens may have been replaced, e.g. a rejected
+    // candidate may be followed by the same token as before, so the indexed generated tokens are compared one by one
+    const size_t max_common_length = std::min(m_tokens.size(), length);
+    size_t common_length = std::min(max_common_length, prompt_ids.size());
+    while (common_length < max_common_length && m_tokens[common_length] == token_at(common_length)) {
+        ++common_length;
+    }
+    truncate(common_length);
+
+    for (size_t position = common_length; position < length; ++position) {
+        append(token_at(position));
+    }
+}
+
+size_t NGramIndex::_get_max_ngram_size(size_t max_ngram_size) const {
+    if (max_ngram_size >= m_tokens.size()) {
+        // Comparing the whole input_ids is not very meaningful until the ngram length reaches half the length of
+        // `input_ids`, because the ngrams will overlap with `input_ids`.
+        max_ngram_size = m_tokens.size() / 2;
+    }
+    return std::min(max_ngram_size, m_max_ngram_size);
+}
+
+bool NGramIndex::_is_suffix_at(size_t position, size_t ngram_size) const {
+    return std::equal(m_tokens.end() - ngram_size, m_tokens.end(), m_tokens.begin() + position);
+}
+
+size_t NGramIndex::_find_first_occurrence(size_t ngram_size) const {
+    const size_t suffix_start = m_tokens.size() - ngram_size;
+    uint64_t hash = HASH_SEED;
+    for (size_t i = 1; i <= ngram_size; ++i) {
+        hash = combine_hash(hash, m_tokens[m_tokens.size() - i]);
+    }
+
+    auto it = m_occurrences[ngram_size - 1].find(hash);
+    if (it == m_occurrences[ngram_size - 1].end() || it->second.first >= suffix_start) {
+        return NO_POSITION;
+    }
+    if (_is_suffix_at(it->second.first, ngram_size)) {
+        return it->second.first;
+    }
+
+    // hash collision, fall back to scanning
+    for (size_t position = 0; position < suffix_start; ++position) {
+        if (_is_suffix_at(position, ngram_size)) {
+            return position;
+        }
+    }
+    return NO_POSITION;
+}
+
+NGramIndex::TokenIds NGramIndex::_get_continuation(size_t position, size_t num_pred_tokens) const {
+    size_t available_num_pred = std::min(m_tokens.size() - position, num_pred_tokens);
+    return TokenIds{m_tokens.begin() + position, m_tokens.begin() + position + available_num_pred};
+}
+
+NGramIndex::TokenIds NGramIndex::find_candidates(size_t num_pred_tokens, size_t max_ngram_size) const {
+    if (num_pred_tokens == 0) {
+        return {};
+    }
+
+    for (size_t ngram_size = _get_max_ngram_size(max_ngram_size); ngram_size > 0; ngram_size--) {
+        size_t position = _find_first_occurrence(ngram_size);
+        if (position != NO_POSITION) {
+            return _get_continuation(position + ngram_size, num_pred_tokens);
+        }
+    }
+    return {};
+}
+
+}  // namespace ov::genai
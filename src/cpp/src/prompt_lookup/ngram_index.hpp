@@ -0,0 +1,79 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief Incrementally maintained index of all n-grams (up to a given size) of a token sequence, used by prompt lookup
+ * decoding to find earlier occurrences of the sequence suffix without re-scanning the whole sequence on each step.
+ * Each occurrence of an n-gram links to the previous one, so the index supports appending tokens and removing them
+ * from the end (e.g. rejected candidates).
+ */
+class NGramIndex {
+public:
+    using TokenIds = std::vector<int64_t>;
+
+    /**
+     * @param max_ngram_size The max size of indexed n-grams.
+     */
+    explicit NGramIndex(size_t max_ngram_size);
+
+    /**
+     * @return Number of indexed tokens.
+     */
+    size_t size() const {
+        return m_tokens.size();
+    }
+
+    void append(int64_t token);
+
+    /**
+     * Removes the tokens after a given length from the index.
+     */
+    void truncate(size_t length);
+
+    /**
+     * Brings the index in line with a sequence, which consists of the prompt and generated tokens. The prompt must be
+     * the same as on the previous update, while generated tokens may have been removed from the end and replaced by
+     * other ones since then.
+     */
+    void update(const TokenIds& prompt_ids, const TokenIds& generated_ids);
+
+    /**
+     * Looks for the earliest occurrence of the longest sequence suffix which occurs earlier in the sequence.
+     * @param num_pred_tokens Max number of candidate tokens to return.
+     * @param max_ngram_size Max size of the suffix to look for.
+     * @return Tokens following the found occurrence, or an empty vector if the suffix doesn't occur earlier.
+     */
+    TokenIds find_candidates(size_t num_pred_tokens, size_t max_ngram_size) const;
+
+private:
+    static constexpr size_t NO_POSITION = std::numeric_limits<size_t>::max();
+
+    struct Occurrences {
+        size_t first;
+        size_t last;
+    };
+
+    size_t m_max_ngram_size;
+    TokenIds m_tokens;
+    // n-gram hash -> its first and last occurrences, for each n-gram size
+    std::vector<std::unordered_map<uint64_t, Occurrences>> m_occurrences;
+    // previous occurrence of the n-gram starting at a given position, for each n-gram size
+    std::vector<std::vector<size_t>> m_prev_occurrence;
+
+    size_t _get_max_ngram_size(size_t max_ngram_size) const;
+    size_t _find_first_occurrence(size_t ngram_size) const;
+    bool _is_suffix_at(size_t position, size_t ngram_size) const;
+    TokenIds _get_continuation(size_t position, size_t num_pred_tokens) const;
+};
+
+}  // namespace ov::genai
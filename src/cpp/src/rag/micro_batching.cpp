@@ -0,0 +1,152 @@
+// Copyright (C) 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "rag/micro_batching.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <numeric>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+std::vector<std::vector<size_t>> split_into_micro_batches(const std::vector<size_t>& lengths, size_t max_batch_tokens) {
+    OPENVINO_ASSERT(max_batch_tokens > 0, "max_batch_tokens should be greater than 0");
+
+    std::vector<size_t> order(lengths.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&lengths](size_t lhs, size_t rhs) {
+        return lengths[lhs] < lengths[rhs];
+    });
+
+    std::vector<std::vector<size_t>> micro_batches;
+    for (size_t idx : order) {
+        // inputs go in ascending order of lengths, so the current input is the longest one of the micro batch
+        const size_t padded_length = std::max<size_t>(lengths[idx], 1);
+        if (micro_batches.empty() || (micro_batches.back().size() + 1) * padded_length > max_batch_tokens) {
+            micro_batches.emplace_back();
+        }
+        micro_batches.back().push_back(idx);
+    }
+    return micro_batches;
+}
+
+std::vector<size_t> get_sequence_lengths(const ov::Tensor& attention_mask) {
+    const auto shape = attention_mask.get_shape();
+    OPENVINO_ASSERT(shape.size() == 2, "Attention mask is expected to have shape [batch, seq_len]");
+    const int64_t* mask_data = attention_mask.data<const int64_t>();
+
+    std::vector<size_t> lengths(shape[0]);
+    for (size_t row = 0; row < shape[0]; ++row) {
+        const int64_t* row_mask = mask_data + row * shape[1];
+        lengths[row] = std::count(row_mask, row_mask + shape[1], 1);
+    }
+    return lengths;
+}
+
+ov::Tensor gather_padded_rows(const ov::Tensor& tensor,
+                              const ov::Tensor& attention_mask,
+                              const std::vector<size_t>& rows,
+                              int64_t pad_value) {
+    OPENVINO_ASSERT(tensor.get_element_type() == ov::element::i64, "Only i64 tensors can be split into micro batches");
+    OPENVINO_ASSERT(tensor.get_shape() == attention_mask.get_shape(), "Tensor and attention mask shapes mismatch");
+    const size_t seq_len = tensor.get_shape()[1];
+    const int64_t* data = tensor.data<const int64_t>();
+    const int64_t* mask_data = attention_mask.data<const int64_t>();
+    const std::vector<size_t> lengths = get_sequence_lengths(attention_mask);
+
+    size_t max_length = 0;
+    for (size_t row : rows) {
+        max_length = std::max(max_length, lengths[row]);
+    }
+
+    ov::Tensor result{ov::element::i64, {rows.size(), max_length}};
+    int64_t* result_data = result.data<int64_t>();
+    std::fill_n(result_data, result.get_size(), pad_value);
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const size_t row = rows[i], length = lengths[row];
+        const bool is_left_padded = length < seq_len && mask_data[row * seq_len] == 0;
+        const int64_t* src = data + row * seq_len + (is_left_padded ? seq_len - length : 0);
+        int64_t* dst = result_data + i * max_length + (is_left_padded ? max_length - length : 0);
+        std::copy_n(src, length, dst);
+    }
+    return result;
+}
+
+MicroBatchedInference::MicroBatchedInference(ov::CompiledModel& compiled_model, size_t num_requests) {
+    OPENVINO_ASSERT(num_requests > 0, "Number of infer requests should be greater than 0");
+    m_requests.reserve(num_requests);
+    for (size_t i = 0; i < num_requests; ++i) {
+        m_requests.push_back(compiled_model.create_infer_request());
+    }
+}
+
+void MicroBatchedInference::_start_micro_batch(size_t micro_batch_idx) {
+    auto& request = m_requests[micro_batch_idx % m_requests.size()];
+    m_set_inputs(request, m_micro_batches[micro_batch_idx]);
+    request.start_async();
+    ++m_num_started_micro_batches;
+}
+
+void MicroBatchedInference::start(std::vector<std::vector<size_t>> micro_batches,
+                                  SetInputsCallback set_inputs,
+                                  ReadOutputsCallback read_outputs) {
+    m_micro_batches = std::move(micro_batches);
+    m_set_inputs = std::move(set_inputs);
+    m_read_outputs = std::move(read_outputs);
+    m_num_started_micro_batches = 0;
+
+    try {
+        for (size_t micro_batch_idx = 0; micro_batch_idx < std::min(m_requests.size(), m_micro_batches.size()); ++micro_batch_idx) {
+            _start_micro_batch(micro_batch_idx);
+        }
+    } catch (...) {
+        // the requests must not be running when the caller releases the inputs
+        for (size_t micro_batch_idx = 0; micro_batch_idx < m_num_started_micro_batches; ++micro_batch_idx) {
+            try {
+                m_requests[micro_batch_idx].wait();
+            } catch (...) {
+                // the first error is rethrown
+            }
+        }
+        m_micro_batches.clear();
+        m_num_started_micro_batches = 0;
+        throw;
+    }
+}
+
+void MicroBatchedInference::wait() {
+    std::exception_ptr error;
+    for (size_t micro_batch_idx = 0; micro_batch_idx < m_num_started_micro_batches; ++micro_batch_idx) {
+        auto& request = m_requests[micro_batch_idx % m_requests.size()];
+        try {
+            request.wait();
+            if (error) {
+                continue;
+            }
+            m_read_outputs(request, m_micro_batches[micro_batch_idx]);
+
+            // the request is free now, give it the next micro batch in round robin order
+            if (micro_batch_idx + m_requests.size() < m_micro_batches.size()) {
+                _start_micro_batch(micro_batch_idx + m_requests.size());
+            }
+        } catch (...) {
+            // the micro batches which are already started are awaited, the rest are not started
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    m_micro_batches.clear();
+    m_num_started_micro_batches = 0;
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
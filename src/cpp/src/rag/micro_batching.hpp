@@ -0,0 +1,89 @@
+// Copyright (C) 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/infer_request.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+/**
+ * @brief Splits inputs into micro batches of inputs with similar lengths to reduce padding. Inputs are sorted by length
+ * and consecutive ones are grouped while the micro batch padded to its longest input fits the token budget.
+ * @param lengths Number of tokens in each input.
+ * @param max_batch_tokens Max number of tokens including padding in a micro batch. An input longer than the budget
+ * forms a micro batch of its own.
+ * @return Indices of inputs in each micro batch.
+ */
+std::vector<std::vector<size_t>> split_into_micro_batches(const std::vector<size_t>& lengths, size_t max_batch_tokens);
+
+/**
+ * @return Number of tokens in each row of an attention mask of shape [batch, seq_len].
+ */
+std::vector<size_t> get_sequence_lengths(const ov::Tensor& attention_mask);
+
+/**
+ * @brief Gathers rows of a padded i64 tensor of shape [batch, seq_len] into a new tensor padded to the longest of the
+ * gathered rows. Token positions are taken from the attention mask, so left and right padding are both kept.
+ * @param tensor Tensor to gather rows from, e.g. input_ids.
+ * @param attention_mask Attention mask of the tensor.
+ * @param rows Indices of rows to gather.
+ * @param pad_value Value to fill the padded positions with.
+ */
+ov::Tensor gather_padded_rows(const ov::Tensor& tensor,
+                              const ov::Tensor& attention_mask,
+                              const std::vector<size_t>& rows,
+                              int64_t pad_value);
+
+/**
+ * @brief Runs micro batches of inputs on a pool of infer requests concurrently. Micro batches are assigned to the
+ * requests in round robin order, so outputs are read in the order of micro batches.
+ */
+class MicroBatchedInference {
+public:
+    /**
+     * Sets model inputs for the given rows of the whole batch.
+     */
+    using SetInputsCallback = std::function<void(ov::InferRequest&, const std::vector<size_t>&)>;
+    /**
+     * Reads model outputs for the given rows of the whole batch.
+     */
+    using ReadOutputsCallback = std::function<void(ov::InferRequest&, const std::vector<size_t>&)>;
+
+    MicroBatchedInference(ov::CompiledModel& compiled_model, size_t num_requests);
+
+    /**
+     * Starts inference of the first micro batches, one per infer request. If a micro batch can't be started, the error
+     * is rethrown once the started ones are finished.
+     */
+    void start(std::vector<std::vector<size_t>> micro_batches,
+               SetInputsCallback set_inputs,
+               ReadOutputsCallback read_outputs);
+
+    /**
+     * Reads outputs of all micro batches, starting the remaining ones as infer requests become free. If a micro batch
+     * fails, the remaining ones are not started, and the first error is rethrown once the started ones are finished.
+     */
+    void wait();
+
+private:
+    std::vector<ov::InferRequest> m_requests;
+    std::vector<std::vector<size_t>> m_micro_batches;
+    // micro batches are started in order, so the first ones are started
+    size_t m_num_started_micro_batches = 0;
+    SetInputsCallback m_set_inputs;
+    ReadOutputsCallback m_read_outputs;
+
+    void _start_micro_batch(size_t micro_batch_idx);
+};
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
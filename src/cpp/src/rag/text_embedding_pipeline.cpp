@@ -11,6 +11,7 @@
 #include "npu/text_embedding_pipeline.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/genai/tokenizer.hpp"
+#include "rag/micro_batching.hpp"
 #include "text_embedding_utils.hpp"
 #include "utils.hpp"
 
@@ -24,6 +25,7 @@ ov::AnyMap remove_config_properties(const ov::AnyMap& properties) {
     properties_copy.erase(max_length.name());
     properties_copy.erase(pad_to_max_length.name());
     properties_copy.erase(batch_size.name());
+    properties_copy.erase(max_batch_tokens.name());
     properties_copy.erase(pooling_type.name());
     properties_copy.erase(normalize.name());
     properties_copy.erase(embed_instruction.name());
@@ -62,6 +64,7 @@ TextEmbeddingPipeline::Config::Config(const ov::AnyMap& properties) {
     read_anymap_param(properties, ov::genai::max_length.name(), max_length);
     read_anymap_param(properties, ov::genai::pad_to_max_length.name(), pad_to_max_length);
     read_anymap_param(properties, ov::genai::batch_size.name(), batch_size);
+    read_anymap_param(properties, ov::genai::max_batch_tokens.name(), max_batch_tokens);
     read_anymap_param(properties, ov::genai::pooling_type.name(), pooling_type);
     read_anymap_param(properties, ov::genai::normalize.name(), normalize);
     read_anymap_param(properties, ov::genai::embed_instruction.name(), embed_instruction);
@@ -77,6 +80,12 @@ void TextEmbeddingPipeline::Config::validate() const {
     if (batch_size.has_value()) {
         OPENVINO_ASSERT(batch_size.value() > 0, "batch_size should be greater than 0");
     }
+
+    if (max_batch_tokens.has_value()) {
+        OPENVINO_ASSERT(max_batch_tokens.value() > 0, "max_batch_tokens should be greater than 0");
+        OPENVINO_ASSERT(!batch_size.has_value(), "max_batch_tokens is not compatible with batch_size");
+        OPENVINO_ASSERT(!pad_to_max_length.value_or(false), "max_batch_tokens is not compatible with pad_to_max_length");
+    }
 }
 
 class TextEmbeddingPipeline::TextEmbeddingPipelineImpl {
@@ -113,6 +122,7 @@ public:
         }
 
         if (device == "NPU") {
+            OPENVINO_ASSERT(!m_config.max_batch_tokens.has_value(), "max_batch_tokens is not supported on NPU");
             m_request = create_text_embedding_npu_request(model,
                                                           m_config,
                                                           properties,
@@ -126,8 +136,18 @@ public:
             model = utils::apply_postprocessing(model, m_config);
             auto compiled_model = core.compile_model(model, device, properties);
             utils::print_compiled_model_properties(compiled_model, "text embedding model");
-            m_request = compiled_model.create_infer_request();
+            if (m_config.max_batch_tokens.has_value()) {
+                m_has_token_type_ids = utils::has_token_type_ids_input(compiled_model.inputs());
+                m_micro_batched_inference = std::make_unique<utils::MicroBatchedInference>(
+                    compiled_model,
+                    compiled_model.get_property(ov::optimal_number_of_infer_requests));
+            } else {
+                m_request = compiled_model.create_infer_request();
+            }
         }
+        // micro batches are pooled by the embedding model itself, the post-processing model is run for a single request
+        OPENVINO_ASSERT(!m_micro_batched_inference || !m_post_request,
+                        "max_batch_tokens is not supported with a post-processing embedding model");
     };
 
     EmbeddingResults embed_documents(const std::vector<std::string>& texts) {
@@ -174,6 +194,11 @@ private:
     AnyMap m_tokenization_params;
     std::optional<size_t> m_max_position_embeddings;
     ov::Tensor m_attention_mask;
+    // set if documents are split into micro batches by length
+    std::unique_ptr<utils::MicroBatchedInference> m_micro_batched_inference;
+    TokenizedInputs m_encoded;
+    std::vector<std::vector<float>> m_micro_batch_results;
+    bool m_has_token_type_ids = false;
 
     ov::Tensor post_model_infer(const ov::Tensor& input) {
         if (!m_post_request) {
@@ -224,6 +249,11 @@ private:
                             ")");
         }
 
+        if (m_micro_batched_inference) {
+            start_micro_batched_embed_async(texts);
+            return;
+        }
+
         const auto encoded = m_tokenizer.encode(texts, m_tokenization_params);
         m_request.set_tensor("input_ids", encoded.input_ids);
         m_request.set_tensor("attention_mask", encoded.attention_mask);
@@ -241,7 +271,43 @@ private:
         m_request.start_async();
     };
 
+    void start_micro_batched_embed_async(const std::vector<std::string>& texts) {
+        m_encoded = m_tokenizer.encode(texts, m_tokenization_params);
+        m_micro_batch_results.assign(texts.size(), {});
+
+        auto set_inputs = [this](ov::InferRequest& request, const std::vector<size_t>& rows) {
+            const auto& attention_mask = m_encoded.attention_mask;
+            ov::Tensor input_ids =
+                utils::gather_padded_rows(m_encoded.input_ids, attention_mask, rows, m_tokenizer.get_pad_token_id());
+            request.set_tensor("input_ids", input_ids);
+            request.set_tensor("attention_mask", utils::gather_padded_rows(attention_mask, attention_mask, rows, 0));
+
+            if (m_has_token_type_ids) {
+                ov::Tensor token_type_ids{ov::element::i64, input_ids.get_shape()};
+                std::fill_n(token_type_ids.data<int64_t>(), input_ids.get_size(), 0);
+                request.set_tensor("token_type_ids", token_type_ids);
+            }
+        };
+
+        auto read_outputs = [this](ov::InferRequest& request, const std::vector<size_t>& rows) {
+            auto embeddings = to_embedding_result(request.get_tensor("last_hidden_state"));
+            for (size_t i = 0; i < rows.size(); ++i) {
+                m_micro_batch_results[rows[i]] = std::move(embeddings[i]);
+            }
+        };
+
+        const auto lengths = utils::get_sequence_lengths(m_encoded.attention_mask);
+        m_micro_batched_inference->start(utils::split_into_micro_batches(lengths, *m_config.max_batch_tokens),
+                                         set_inputs,
+                                         read_outputs);
+    }
+
     EmbeddingResults wait_embed() {
+        if (m_micro_batched_inference) {
+            m_micro_batched_inference->wait();
+            return std::move(m_micro_batch_results);
+        }
+
         m_request.wait();
 
         // [batch_size, hidden_size]
@@ -271,7 +337,7 @@ private:
         return *m_config.query_instruction + text;
     }
 
-    EmbeddingResults to_embedding_result(const Tensor& last_hidden_state) {
+    std::vector<std::vector<float>> to_embedding_result(const Tensor& last_hidden_state) {
         const float* last_hidden_state_data = last_hidden_state.data<float>();
 
         std::vector<std::vector<float>> result;
@@ -12,6 +12,7 @@
 #include "openvino/opsets/opset.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset8.hpp"
+#include "rag/micro_batching.hpp"
 #include "utils.hpp"
 
 namespace {
@@ -25,6 +26,7 @@ ov::AnyMap remove_config_properties(const ov::AnyMap& properties) {
     properties_copy.erase(max_length.name());
     properties_copy.erase(pad_to_max_length.name());
     properties_copy.erase(padding_side.name());
+    properties_copy.erase(max_batch_tokens.name());
 
     return properties_copy;
 }
@@ -142,8 +144,16 @@ TextRerankPipeline::Config::Config(const ov::AnyMap& properties) {
     read_anymap_param(properties, ov::genai::max_length.name(), max_length);
     read_anymap_param(properties, ov::genai::padding_side.name(), padding_side);
     read_anymap_param(properties, ov::genai::pad_to_max_length.name(), pad_to_max_length);
+    read_anymap_param(properties, ov::genai::max_batch_tokens.name(), max_batch_tokens);
 };
 
+void TextRerankPipeline::Config::validate() const {
+    if (max_batch_tokens.has_value()) {
+        OPENVINO_ASSERT(max_batch_tokens.value() > 0, "max_batch_tokens should be greater than 0");
+        OPENVINO_ASSERT(!pad_to_max_length.value_or(false), "max_batch_tokens is not compatible with pad_to_max_length");
+    }
+}
+
 class TextRerankPipeline::TextRerankPipelineImpl {
 public:
     TextRerankPipelineImpl(const std::filesystem::path& models_path,
@@ -151,6 +161,8 @@ public:
                            const Config& config,
                            const ov::AnyMap& properties = {})
         : m_config{config} {
+        m_config.validate();
+
         const auto model_type = read_model_type(models_path);
         const bool is_qwen3 = model_type.has_value() && model_type.value() == "qwen3";
 
@@ -188,7 +200,13 @@ public:
         ov::CompiledModel compiled_model = core.compile_model(model, device, properties);
 
         utils::print_compiled_model_properties(compiled_model, "text rerank model");
-        m_request = compiled_model.create_infer_request();
+        if (m_config.max_batch_tokens) {
+            m_micro_batched_inference = std::make_unique<utils::MicroBatchedInference>(
+                compiled_model,
+                compiled_model.get_property(ov::optimal_number_of_infer_requests));
+        } else {
+            m_request = compiled_model.create_infer_request();
+        }
     };
 
     std::vector<std::pair<size_t, float>> rerank(const std::string& query, const std::vector<std::string>& texts) {
@@ -197,46 +215,24 @@ public:
     }
 
     void start_rerank_async(const std::string& query, const std::vector<std::string>& texts) {
-        const TokenizedInputs& encoded = tokenize(query, texts);
-
-        m_request.set_tensor("input_ids", encoded.input_ids);
-        m_request.set_tensor("attention_mask", encoded.attention_mask);
-
-        if (encoded.token_type_ids.has_value()) {
-            m_request.set_tensor("token_type_ids", *encoded.token_type_ids);
-        }
-
-        if (m_has_position_ids) {
-            ov::Tensor position_ids(encoded.input_ids.get_element_type(), encoded.input_ids.get_shape());
-            utils::initialize_position_ids(position_ids, encoded.attention_mask, 0);
-            m_request.set_tensor("position_ids", position_ids);
-        }
-
-        if (m_has_beam_idx) {
-            const size_t batch_size = encoded.input_ids.get_shape()[0];
-            ov::Tensor beam_idx = ov::Tensor(ov::element::i32, {batch_size});
-            std::fill_n(beam_idx.data<int32_t>(), batch_size, 0);
-            m_request.set_tensor("beam_idx", beam_idx);
+        if (m_micro_batched_inference) {
+            start_micro_batched_rerank_async(query, texts);
+            return;
         }
 
+        const TokenizedInputs& encoded = tokenize(query, texts);
+        set_inputs(m_request, encoded.input_ids, encoded.attention_mask, encoded.token_type_ids);
         m_request.start_async();
     }
 
     std::vector<std::pair<size_t, float>> wait_rerank() {
-        m_request.wait();
-
-        // postprocessing applied to output, it's the scores tensor
-        auto scores_tensor = m_request.get_tensor("logits");
-        auto scores_tensor_shape = scores_tensor.get_shape();
-        const size_t batch_size = scores_tensor_shape[0];
-
-        auto scores_data = scores_tensor.data<float>();
-
         std::vector<std::pair<size_t, float>> results;
-        results.reserve(batch_size);
-
-        for (size_t batch = 0; batch < batch_size; batch++) {
-            results.emplace_back(batch, scores_data[batch]);
+        if (m_micro_batched_inference) {
+            m_micro_batched_inference->wait();
+            results = std::move(m_micro_batch_results);
+        } else {
+            m_request.wait();
+            results = read_scores(m_request);
         }
 
         const size_t top_n = m_config.top_n;
@@ -253,10 +249,6 @@ public:
             results.resize(top_n);
         }
 
-        if (m_has_beam_idx) {
-            m_request.reset_state();
-        }
-
         return results;
     }
 
@@ -267,6 +259,86 @@ private:
     AnyMap m_tokenization_params;
     bool m_has_position_ids = false;
     bool m_has_beam_idx = false;
+    // set if documents are split into micro batches by length
+    std::unique_ptr<utils::MicroBatchedInference> m_micro_batched_inference;
+    TokenizedInputs m_encoded;
+    std::vector<std::pair<size_t, float>> m_micro_batch_results;
+
+    void set_inputs(ov::InferRequest& request,
+                    const ov::Tensor& input_ids,
+                    const ov::Tensor& attention_mask,
+                    const std::optional<ov::Tensor>& token_type_ids) {
+        request.set_tensor("input_ids", input_ids);
+        request.set_tensor("attention_mask", attention_mask);
+
+        if (token_type_ids.has_value()) {
+            request.set_tensor("token_type_ids", *token_type_ids);
+        }
+
+        if (m_has_position_ids) {
+            ov::Tensor position_ids(input_ids.get_element_type(), input_ids.get_shape());
+            utils::initialize_position_ids(position_ids, attention_mask, 0);
+            request.set_tensor("position_ids", position_ids);
+        }
+
+        if (m_has_beam_idx) {
+            const size_t batch_size = input_ids.get_shape()[0];
+            ov::Tensor beam_idx = ov::Tensor(ov::element::i32, {batch_size});
+            std::fill_n(beam_idx.data<int32_t>(), batch_size, 0);
+            request.set_tensor("beam_idx", beam_idx);
+        }
+    }
+
+    std::vector<std::pair<size_t, float>> read_scores(ov::InferRequest& request) {
+        // postprocessing applied to output, it's the scores tensor
+        auto scores_tensor = request.get_tensor("logits");
+        auto scores_tensor_shape = scores_tensor.get_shape();
+        const size_t batch_size = scores_tensor_shape[0];
+
+        auto scores_data = scores_tensor.data<float>();
+
+        std::vector<std::pair<size_t, float>> results;
+        results.reserve(batch_size);
+
+        for (size_t batch = 0; batch < batch_size; batch++) {
+            results.emplace_back(batch, scores_data[batch]);
+        }
+
+        if (m_has_beam_idx) {
+            request.reset_state();
+        }
+
+        return results;
+    }
+
+    void start_micro_batched_rerank_async(const std::string& query, const std::vector<std::string>& texts) {
+        m_encoded = tokenize(query, texts);
+        m_micro_batch_results.clear();
+        m_micro_batch_results.reserve(texts.size());
+
+        auto set_micro_batch_inputs = [this](ov::InferRequest& request, const std::vector<size_t>& rows) {
+            const auto& attention_mask = m_encoded.attention_mask;
+            std::optional<ov::Tensor> token_type_ids;
+            if (m_encoded.token_type_ids.has_value()) {
+                token_type_ids = utils::gather_padded_rows(*m_encoded.token_type_ids, attention_mask, rows, 0);
+            }
+            set_inputs(request,
+                       utils::gather_padded_rows(m_encoded.input_ids, attention_mask, rows, m_tokenizer.get_pad_token_id()),
+                       utils::gather_padded_rows(attention_mask, attention_mask, rows, 0),
+                       token_type_ids);
+        };
+
+        auto read_outputs = [this](ov::InferRequest& request, const std::vector<size_t>& rows) {
+            for (const auto& [row, score] : read_scores(request)) {
+                m_micro_batch_results.emplace_back(rows[row], score);
+            }
+        };
+
+        const auto lengths = utils::get_sequence_lengths(m_encoded.attention_mask);
+        m_micro_batched_inference->start(utils::split_into_micro_batches(lengths, *m_config.max_batch_tokens),
+                                         set_micro_batch_inputs,
+                                         read_outputs);
+    }
 
     TokenizedInputs tokenize(const std::string& query, const std::vector<std::string>& texts) {
         if (m_tokenizer.supports_paired_input()) {
@@ -4,7 +4,10 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 
 #include "openvino/genai/generation_config.hpp"
 
@@ -26,14 +29,33 @@ struct Logits {
 
     Logits(float* data, size_t size): m_data(data), m_size(size) {}
 
+    Logits(const Logits&) = default;
+    Logits(Logits&&) = default;
+    Logits& operator=(const Logits&) = default;
+    Logits& operator=(Logits&&) = default;
+
+    ~Logits() {
+        // give the vocabulary-sized buffer back to the thread, so that the next Logits doesn't have to allocate it
+        auto& scratch = _get_thread_scratch();
+        if (m_vector.capacity() > scratch.capacity()) {
+            m_vector.clear();
+            scratch.swap(m_vector);
+        }
+    }
 
     void initialize_vector() {
-        OPENVINO_ASSERT(m_vector.size() == 0, "Logits vector already initialized");
-        m_vector.reserve(m_size);
+        _acquire_scratch();
         for (size_t i = 0; i < m_size; i++)
             m_vector.emplace_back(m_data[i], i);
     }
 
+    /**
+     * Initializes vector with the tokens which sortable keys (see get_sortable_key) fall into a given bucket or higher ones.
+     * @param min_bucket Min bucket of the tokens to keep.
+     * @param bucket_shift Number of low key bits dropped to get a bucket.
+     */
+    void initialize_vector(uint32_t min_bucket, uint32_t bucket_shift);
+
     bool is_vector_initialized() const {
         return m_vector.size() > 0;
     }
@@ -42,8 +64,42 @@ struct Logits {
         m_size = new_size;
         m_vector.resize(new_size);
     }
+
+private:
+    static std::vector<Token>& _get_thread_scratch() {
+        thread_local std::vector<Token> scratch;
+        return scratch;
+    }
+
+    void _acquire_scratch() {
+        OPENVINO_ASSERT(m_vector.size() == 0, "Logits vector already initialized");
+        auto& scratch = _get_thread_scratch();
+        if (scratch.capacity() > m_vector.capacity()) {
+            m_vector.swap(scratch);
+            m_vector.clear();
+        }
+        m_vector.reserve(m_size);
+    }
 };
 
+/**
+ * @brief Maps float to an unsigned integer key, which preserves the order of floats. High bits of the key are used as
+ * a histogram bucket to select top tokens without sorting the whole vocabulary.
+ */
+inline uint32_t get_sortable_key(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+inline void Logits::initialize_vector(uint32_t min_bucket, uint32_t bucket_shift) {
+    _acquire_scratch();
+    for (size_t i = 0; i < m_size; i++) {
+        if ((get_sortable_key(m_data[i]) >> bucket_shift) >= min_bucket)
+            m_vector.emplace_back(m_data[i], i);
+    }
+}
+
 namespace LogitTransformers {
 
 using TokenIds = std::vector<int64_t>;
@@ -73,29 +129,6 @@ class TopPFilter : public ILogitTransformer {
 public:
     TopPFilter(double top_p) : m_top_p(top_p) {}
 
-    bool partial_sort_and_resize(Logits& logits) {
-        // Since most of the time huge part of logits vector contains minimal values
-        // expensive sorting of entire vector might be unnecessary, especially for low values of top_p.
-        // This method partially sorts vector finding M top elements and stops when top_p condition is met.
-        // It iterates a few times starting with M = 16 and multiplying it by 2 each iteration until M = 1024.
-        // If top_p is found in considered scope it resizes logits vector and returns true. Otherwise it returns false.
-        // Note that it can we less performant than standard approach if logits value are more evenly distributed across the vector.
-        for (size_t step = 16; step <= 1024; step *= 2) {
-            if (logits.m_vector.size() <= step)
-                break;
-            std::partial_sort(logits.m_vector.begin(), logits.m_vector.begin() + step, logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
-            float sum = 0.0;
-            for (int i = 0; i < step; i++) {
-                sum += logits.m_vector[i].m_log_prob;
-                if (sum > m_top_p) {
-                    logits.resize(i+1);
-                    return true;
-                }
-            }
-        }
-        return false;
-    }
-
     void full_sort_and_resize(Logits& logits) {
         std::sort(logits.m_vector.begin(), logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
         float probability_sum = 0.0f;
@@ -108,14 +141,48 @@ public:
         logits.resize(nucleus_size);
     }
 
+    bool bucket_sort_and_resize(Logits& logits) {
+        // Probabilities are summed up per bucket of high bits of their sortable keys, which gives a lower bound of the
+        // probability value covering top_p. Only tokens above it are copied and sorted.
+        // If the selected tokens turn out not to cover top_p due to float rounding, returns false.
+        std::array<double, NUM_BUCKETS> bucket_sums{};
+        for (size_t i = 0; i < logits.m_size; i++) {
+            bucket_sums[get_sortable_key(logits.m_data[i]) >> BUCKET_SHIFT] += logits.m_data[i];
+        }
+
+        uint32_t min_bucket = NUM_BUCKETS - 1;
+        double cumulative_sum = bucket_sums[min_bucket];
+        while (min_bucket > 0 && cumulative_sum <= m_top_p + TOP_P_MARGIN) {
+            cumulative_sum += bucket_sums[--min_bucket];
+        }
+
+        logits.initialize_vector(min_bucket, BUCKET_SHIFT);
+        std::sort(logits.m_vector.begin(), logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
+        float probability_sum = 0.0f;
+        for (size_t i = 0; i < logits.m_vector.size(); i++) {
+            probability_sum += logits.m_vector[i].m_log_prob;
+            if (probability_sum > m_top_p) {
+                logits.resize(i + 1);
+                return true;
+            }
+        }
+        return min_bucket == 0;
+    }
+
     void apply(Logits& logits) override {
-        // Initialize and sort vector. Try partial sorting first and if it's not enough, sort entire vector.
+        // Sort only tokens from the buckets covering top_p. If it's not enough, sort entire vector.
+        if (bucket_sort_and_resize(logits))
+            return;
+        logits.m_vector.clear();
         logits.initialize_vector();
-        if(!partial_sort_and_resize(logits))
-            full_sort_and_resize(logits);
+        full_sort_and_resize(logits);
     }
 
 protected:
+    static constexpr uint32_t BUCKET_SHIFT = 20;
+    static constexpr uint32_t NUM_BUCKETS = 1u << (32 - BUCKET_SHIFT);
+    static constexpr double TOP_P_MARGIN = 1e-3;
+
     double m_top_p = 0.f;
 };
 
@@ -131,14 +198,29 @@ public:
 
         // If top_p is also used vector is already initialized and sorted
         if (!logits.is_vector_initialized()) {
-            // Initialize and partially sort vector
-            logits.initialize_vector();
+            // Find the histogram bucket of the k-th largest logit and copy only tokens from it and higher buckets,
+            // then partially sort them
+            std::array<uint32_t, NUM_BUCKETS> histogram{};
+            for (size_t i = 0; i < logits.m_size; i++) {
+                ++histogram[get_sortable_key(logits.m_data[i]) >> BUCKET_SHIFT];
+            }
+
+            uint32_t min_bucket = NUM_BUCKETS - 1;
+            size_t num_selected = histogram[min_bucket];
+            while (num_selected < m_top_k) {
+                num_selected += histogram[--min_bucket];
+            }
+
+            logits.initialize_vector(min_bucket, BUCKET_SHIFT);
             std::partial_sort(logits.m_vector.begin(), logits.m_vector.begin() + m_top_k, logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
         }
         logits.resize(m_top_k);
     }
 
 protected:
+    static constexpr uint32_t BUCKET_SHIFT = 20;
+    static constexpr uint32_t NUM_BUCKETS = 1u << (32 - BUCKET_SHIFT);
+
     size_t m_top_k = 0;
 };
 
@@ -154,14 +236,17 @@ public:
             }
         }
 
+        // multiplications by precomputed inverse values let the compiler vectorize the loops
+        const float inv_temperature = 1.0f / m_temperature;
         float norm_sum = 0.0;
         for (size_t i = 0; i < logits.m_size; i++) {
-            logits.m_data[i] = expf((logits.m_data[i] - max_logit) / this->m_temperature);
+            logits.m_data[i] = expf((logits.m_data[i] - max_logit) * inv_temperature);
             norm_sum += logits.m_data[i];
         }
 
+        const float inv_norm_sum = 1.0f / norm_sum;
         for (size_t i = 0; i < logits.m_size; i++) {
-            logits.m_data[i] /= norm_sum;
+            logits.m_data[i] *= inv_norm_sum;
         }
     }
 
@@ -7,47 +7,16 @@
 #include "tokenizer/tokenizer_impl.hpp"
 
 namespace ov::genai {
-// Modified Knuth–Morris–Pratt algorithm which returns tokens following after every needle occurrence in haystack
-std::vector<int64_t> kmp_search(const std::vector<int64_t>& haystack, const std::vector<int64_t>& needle) {
-    if (needle.empty()) {  // no_repeat_ngram_size == 1, ban every token
-        return {haystack.begin(), haystack.end()};
-    }
-    std::vector<int> partial_match_table(needle.size() + 1, -1);
-    int cnd = 0;
-    for (size_t pos = 1; pos < needle.size(); ++pos) {
-        if (needle.at(pos) == needle.at(size_t(cnd))) {
-            partial_match_table.at(pos) = partial_match_table.at(size_t(cnd));
-        } else {
-            partial_match_table.at(pos) = cnd;
-            while (cnd >= 0 && needle.at(pos) != needle.at(size_t(cnd))) {
-                cnd = partial_match_table.at(size_t(cnd));
-            }
-        }
-        ++cnd;
-    }
-    partial_match_table.back() = cnd;
-    std::vector<int64_t> res;
-    size_t haystack_id = 0;
-    int needle_id = 0;
-    while (haystack_id < haystack.size() - 1) {
-        if (needle.at(size_t(needle_id)) == haystack.at(haystack_id)) {
-            ++haystack_id;
-            ++needle_id;
-            if (needle_id == int(needle.size())) {
-                res.push_back(haystack.at(haystack_id));
-                needle_id = partial_match_table.at(size_t(needle_id));
-            }
-        } else {
-            needle_id = partial_match_table.at(size_t(needle_id));
-            if (needle_id < 0) {
-                ++haystack_id;
-                ++needle_id;
-            }
-        }
-    }
-    return res;
+namespace {
+
+constexpr uint64_t NGRAM_HASH_SEED = 0xcbf29ce484222325ULL;
+
+uint64_t combine_ngram_hash(uint64_t hash, int64_t token) {
+    return (hash ^ static_cast<uint64_t>(token)) * 0x100000001b3ULL;
 }
 
+}  // namespace
+
 std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx) {
     ov::Shape shape = logits.get_shape();
     OPENVINO_ASSERT(shape.size() == 3);
@@ -70,6 +39,128 @@ std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx) {
     return tokens;
 }
 
+void select_top_log_probs(const ov::Tensor& logits,
+                          size_t batch_idx,
+                          size_t top_k,
+                          const std::vector<Token>& adjustments,
+                          std::vector<Token>& top_tokens) {
+    ov::Shape shape = logits.get_shape();
+    OPENVINO_ASSERT(shape.size() == 3);
+    size_t batch = shape[0], seq_len = shape[1], vocab_size = shape[2];
+    OPENVINO_ASSERT(batch_idx < batch, "Logits batch size doesn't match the number of beams");
+
+    size_t batch_offset = batch_idx * seq_len * vocab_size, sequence_offset = (seq_len - 1) * vocab_size;
+    const float* beam_logits = logits.data<const float>() + batch_offset + sequence_offset;
+    float max_logit = *std::max_element(beam_logits, beam_logits + vocab_size);
+    float sum = 0.0f;
+    for (size_t idx = 0; idx < vocab_size; ++idx)
+        sum += std::exp(beam_logits[idx] - max_logit);
+    const float log_sum = std::log(sum);
+
+    // Equal log probabilities are ordered by token index to make selection deterministic
+    auto is_better = [](const Token& left, const Token& right) {
+        return left.m_log_prob > right.m_log_prob || (left.m_log_prob == right.m_log_prob && left.m_index < right.m_index);
+    };
+
+    // Select by raw logits first. Adjusted tokens may be among the selected ones, so that many extra tokens are kept
+    // to have top_k unadjusted ones in any case. The worst selected token is in front of the heap.
+    const size_t num_selected = std::min(top_k + adjustments.size(), vocab_size);
+    top_tokens.clear();
+    for (size_t idx = 0; idx < vocab_size; ++idx) {
+        if (top_tokens.size() < num_selected) {
+            top_tokens.emplace_back(beam_logits[idx], int64_t(idx));
+            std::push_heap(top_tokens.begin(), top_tokens.end(), is_better);
+        } else if (beam_logits[idx] > top_tokens.front().m_log_prob) {
+            std::pop_heap(top_tokens.begin(), top_tokens.end(), is_better);
+            top_tokens.back() = Token(beam_logits[idx], int64_t(idx));
+            std::push_heap(top_tokens.begin(), top_tokens.end(), is_better);
+        }
+    }
+
+    auto is_adjusted = [&adjustments](const Token& token) {
+        return std::binary_search(adjustments.begin(), adjustments.end(), token, [](const Token& left, const Token& right) {
+            return left.m_index < right.m_index;
+        });
+    };
+    top_tokens.erase(std::remove_if(top_tokens.begin(), top_tokens.end(), is_adjusted), top_tokens.end());
+    for (Token& token : top_tokens)
+        token.m_log_prob = token.m_log_prob - max_logit - log_sum;
+    for (const Token& adjustment : adjustments)
+        top_tokens.emplace_back(beam_logits[adjustment.m_index] - max_logit - log_sum + adjustment.m_log_prob, adjustment.m_index);
+
+    const size_t num_top = std::min(top_k, top_tokens.size());
+    std::partial_sort(top_tokens.begin(), top_tokens.begin() + ptrdiff_t(num_top), top_tokens.end(), is_better);
+    top_tokens.resize(num_top);
+}
+
+NoRepeatNgramBans::NoRepeatNgramBans(const TokenIds& prompt_ids, size_t ngram_size)
+    : m_ngram_size(ngram_size) {
+    if (ngram_size == 1) {
+        m_unique_prompt_ids = prompt_ids;
+        std::sort(m_unique_prompt_ids.begin(), m_unique_prompt_ids.end());
+        m_unique_prompt_ids.erase(std::unique(m_unique_prompt_ids.begin(), m_unique_prompt_ids.end()), m_unique_prompt_ids.end());
+    } else if (ngram_size != std::numeric_limits<size_t>::max()) {
+        const size_t needle_len = ngram_size - 1;
+        for (size_t position = 0; position + needle_len <= prompt_ids.size(); ++position) {
+            uint64_t hash = NGRAM_HASH_SEED;
+            for (size_t i = position; i < position + needle_len; ++i)
+                hash = combine_ngram_hash(hash, prompt_ids[i]);
+            m_prompt_ngram_positions[hash].push_back(position);
+        }
+    }
+}
+
+void NoRepeatNgramBans::add_bans(const TokenIds& prompt_ids, const TokenIds& generated_ids, std::vector<Token>& adjustments) const {
+    const size_t prompt_len = prompt_ids.size(), length = prompt_len + generated_ids.size();
+    if (length <= 1 || length < m_ngram_size)
+        return;
+
+    auto token_at = [&](size_t position) {
+        return position < prompt_len ? prompt_ids[position] : generated_ids[position - prompt_len];
+    };
+    auto ban = [&adjustments](int64_t token) {
+        adjustments.emplace_back(-std::numeric_limits<float>::infinity(), token);
+    };
+
+    if (m_ngram_size == 1) {
+        // every token of the sequence is banned
+        for (int64_t token : m_unique_prompt_ids)
+            ban(token);
+        for (int64_t token : generated_ids)
+            ban(token);
+        return;
+    }
+
+    // a token is banned if it follows an earlier occurrence of the last (ngram_size - 1) tokens
+    const size_t needle_len = m_ngram_size - 1, needle_start = length - needle_len;
+    auto occurs_at = [&](size_t position) {
+        for (size_t i = 0; i < needle_len; ++i) {
+            if (token_at(position + i) != token_at(needle_start + i))
+                return false;
+        }
+        return true;
+    };
+
+    // occurrences within the prompt are looked up in the index built once
+    uint64_t hash = NGRAM_HASH_SEED;
+    for (size_t i = needle_start; i < length; ++i)
+        hash = combine_ngram_hash(hash, token_at(i));
+    auto it = m_prompt_ngram_positions.find(hash);
+    if (it != m_prompt_ngram_positions.end()) {
+        for (size_t position : it->second) {
+            if (position < needle_start && occurs_at(position))
+                ban(token_at(position + needle_len));
+        }
+    }
+
+    // the rest of occurrences overlap generated tokens, which are few compared to the prompt
+    const size_t first_overlapping = prompt_len >= needle_len ? prompt_len - needle_len + 1 : 0;
+    for (size_t position = first_overlapping; position < needle_start; ++position) {
+        if (occurs_at(position))
+            ban(token_at(position + needle_len));
+    }
+}
+
 std::vector<int64_t> wrap_tokens(const std::vector<int64_t>& tokens, const std::vector<int64_t>& prefix_tokens, const std::vector<int64_t>& suffix_tokens) {
     std::vector<int64_t> all_tokens = prefix_tokens;
     all_tokens.insert(all_tokens.end(), tokens.begin(), tokens.end());
@@ -210,7 +301,8 @@ Sampler::GroupBeamSearcher::GroupBeamSearcher(SequenceGroup::Ptr sequence_group,
     : m_sequence_group(sequence_group),
         m_parameters{m_sequence_group->get_sampling_parameters()},
         m_groups{m_parameters.num_beam_groups},
-        m_tokenizer(tokenizer) {
+        m_tokenizer(tokenizer),
+        m_no_repeat_ngram_bans(m_sequence_group->get_prompt_ids(), m_parameters.no_repeat_ngram_size) {
     OPENVINO_ASSERT(m_sequence_group->num_running_seqs() == 1);
     assert(m_parameters.num_beams % m_parameters.num_beam_groups == 0 &&
         "number of beams should be divisible by number of groups");
@@ -337,35 +429,42 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
         if (group.done)
             continue;
 
-        std::vector<Beam> candidates;
+        std::vector<Beam>& candidates = m_candidates;
+        candidates.clear();
         candidates.reserve(group_size * 2 * group_size);
         for (const Beam& beam : group.ongoing) {
-            std::vector<Token> tokens = log_softmax(logits, beam.m_global_beam_idx);
+            m_token_adjustments.clear();
 
             // apply diversity penalty
-            for (auto prev_group_id = 0; prev_group_id < group_id; ++prev_group_id) {
-                for (const Beam& prev_beam : child_beams_per_group[prev_group_id]) {
-                    tokens[prev_beam.m_token_id].m_log_prob -= m_parameters.diversity_penalty;
+            if (m_parameters.diversity_penalty != 0.0f) {
+                for (auto prev_group_id = 0; prev_group_id < group_id; ++prev_group_id) {
+                    for (const Beam& prev_beam : child_beams_per_group[prev_group_id]) {
+                        m_token_adjustments.emplace_back(-m_parameters.diversity_penalty, prev_beam.m_token_id);
+                    }
                 }
             }
 
             // apply n_gramm
-            std::vector<int64_t> full_text{m_sequence_group->get_prompt_ids()};
-            full_text.insert(full_text.end(), beam.m_sequence->get_generated_ids().begin(), beam.m_sequence->get_generated_ids().end());
-            if (full_text.size() > 1 && full_text.size() >= m_parameters.no_repeat_ngram_size) {
-                auto tail_start = full_text.end() - ptrdiff_t(m_parameters.no_repeat_ngram_size) + 1;
-                for (int64_t banned_token : kmp_search(full_text, {tail_start, full_text.end()})) {
-                    tokens[banned_token].m_log_prob = -std::numeric_limits<float>::infinity();
+            m_no_repeat_ngram_bans.add_bans(m_sequence_group->get_prompt_ids(), beam.m_sequence->get_generated_ids(), m_token_adjustments);
+
+            // merge adjustments of the same token
+            std::sort(m_token_adjustments.begin(), m_token_adjustments.end(), [](const Token& left, const Token& right) {
+                return left.m_index < right.m_index;
+            });
+            size_t num_adjustments = 0;
+            for (const Token& adjustment : m_token_adjustments) {
+                if (num_adjustments > 0 && m_token_adjustments[num_adjustments - 1].m_index == adjustment.m_index) {
+                    m_token_adjustments[num_adjustments - 1].m_log_prob += adjustment.m_log_prob;
+                } else {
+                    m_token_adjustments[num_adjustments++] = adjustment;
                 }
             }
+            m_token_adjustments.resize(num_adjustments);
 
-            // sort tokens
-            std::sort(tokens.begin(), tokens.end(), [](Token left, Token right) {
-                return left.m_log_prob > right.m_log_prob;  // Most probable tokens in front
-            });
+            // select the most probable tokens
+            select_top_log_probs(logits, beam.m_global_beam_idx, 2 * group_size, m_token_adjustments, m_top_tokens);
 
-            size_t add_count = 0;
-            for (Token token : tokens) {
+            for (const Token& token : m_top_tokens) {
                 Beam new_candidate = beam;
                 new_candidate.m_score += new_candidate.m_log_prob = token.m_log_prob;
                 new_candidate.m_token_id = token.m_index;
@@ -376,9 +475,6 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
                     try_to_finish_candidate(group, new_candidate);
                 } else {
                     candidates.push_back(new_candidate);
-                    if (++add_count == 2 * group_size) {
-                        break;
-                    }
                 }
             }
         }
@@ -541,22 +637,38 @@ Token Sampler::_greedy_sample(const Logits& logits, size_t top_logprobs) const {
 
 std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence) {
     // If top_p or top_k was applied we use sorted vector, if not we go with original buffer.
-    std::vector<float> multinomial_weights;
-    multinomial_weights.reserve(logits.m_size);
-    if (logits.is_vector_initialized())
-        for (auto& logit: logits.m_vector) multinomial_weights.emplace_back(logit.m_log_prob);
-    else
-        multinomial_weights.assign(logits.m_data, logits.m_data + logits.m_size);
-
-    // std::discrete_distribution returns corrupted results when applied to log probabilities
-    // which result returning NAN only logprobs.
-    // so log() is applied after this line
-    auto dist = std::discrete_distribution<size_t>(multinomial_weights.begin(), multinomial_weights.end()); // equivalent to multinomial with number of trials == 1
+    const bool use_vector = logits.is_vector_initialized();
+    const size_t num_weights = use_vector ? logits.m_vector.size() : logits.m_size;
+    auto get_weight = [&](size_t idx) -> double {
+        return use_vector ? logits.m_vector[idx].m_log_prob : logits.m_data[idx];
+    };
+
+    // Inverse CDF sampling, the same as std::discrete_distribution does (multinomial with number of trials == 1),
+    // but with cumulative probabilities kept in a buffer reused across sampling calls of the thread.
+    // Weights are probabilities, since sampling from log probabilities results in NAN only logprobs,
+    // so log() is applied to the picked elements.
+    thread_local std::vector<double> cumulative_probs;
+    cumulative_probs.resize(num_weights);
+    double weights_sum = 0.0;
+    for (size_t idx = 0; idx < num_weights; ++idx)
+        weights_sum += get_weight(idx);
+    double cumulative_prob = 0.0;
+    for (size_t idx = 0; idx < num_weights; ++idx) {
+        cumulative_prob += get_weight(idx) / weights_sum;
+        cumulative_probs[idx] = cumulative_prob;
+    }
+    if (num_weights > 0)
+        cumulative_probs.back() = 1.0;
 
     std::vector<Token> out_tokens;
+    out_tokens.reserve(num_tokens_per_sequence);
     for (size_t token_idx = 0; token_idx < num_tokens_per_sequence; ++token_idx) {
-        size_t element_to_pick = dist(rng_engine);
-        if (logits.is_vector_initialized()) {
+        size_t element_to_pick = 0;
+        if (num_weights > 1) {
+            double p = std::generate_canonical<double, std::numeric_limits<double>::digits>(rng_engine);
+            element_to_pick = std::lower_bound(cumulative_probs.begin(), cumulative_probs.end(), p) - cumulative_probs.begin();
+        }
+        if (use_vector) {
             auto logit = logits.m_vector[element_to_pick];
             logit.m_log_prob = std::log(logit.m_log_prob);
             out_tokens.push_back(logit);
@@ -45,6 +45,42 @@ inline bool is_stop_token_id_hit_in_sequence_group(SequenceGroup::Ptr sequence_g
 
 std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx);
 
+/**
+ * Computes log-softmax of the last position logits of a batch element and selects the most probable tokens without
+ * materializing log probabilities of the whole vocabulary.
+ * @param top_k Number of tokens to select.
+ * @param adjustments Tokens sorted by unique index, whose log probabilities are shifted by m_log_prob before selection
+ * (e.g. -inf for banned tokens).
+ * @param top_tokens Output buffer, the most probable tokens go first. It's reused between calls to avoid allocations.
+ */
+void select_top_log_probs(const ov::Tensor& logits,
+                          size_t batch_idx,
+                          size_t top_k,
+                          const std::vector<Token>& adjustments,
+                          std::vector<Token>& top_tokens);
+
+/**
+ * Bans tokens which would repeat an n-gram of no_repeat_ngram_size tokens in the prompt and generated tokens of a
+ * sequence. (ngram_size - 1)-grams of the prompt are indexed once, so that a step doesn't rescan the whole prompt.
+ */
+class NoRepeatNgramBans {
+public:
+    NoRepeatNgramBans(const TokenIds& prompt_ids, size_t ngram_size);
+
+    /**
+     * Appends -inf adjustments of tokens which can't follow the sequence to adjustments. A token may be appended
+     * several times.
+     * @param prompt_ids Prompt the bans were created for.
+     */
+    void add_bans(const TokenIds& prompt_ids, const TokenIds& generated_ids, std::vector<Token>& adjustments) const;
+
+private:
+    size_t m_ngram_size;
+    // Prompt positions of (ngram_size - 1)-grams by their hash, or unique prompt tokens if ngram_size is 1
+    std::unordered_map<uint64_t, std::vector<size_t>> m_prompt_ngram_positions;
+    std::vector<int64_t> m_unique_prompt_ids;
+};
+
 struct SamplerOutput {
     // IDs of sequences that need to be dropped
     std::vector<uint64_t> m_dropped_sequences;
@@ -169,6 +205,13 @@ class Sampler::GroupBeamSearcher {
     ov::genai::GenerationConfig m_parameters;
     std::vector<Group> m_groups;
     Tokenizer m_tokenizer;
+
+    NoRepeatNgramBans m_no_repeat_ngram_bans;
+
+    // Scratch buffers reused between beams and steps
+    std::vector<Token> m_token_adjustments;
+    std::vector<Token> m_top_tokens;
+    std::vector<Beam> m_candidates;
 public:
     explicit GroupBeamSearcher(SequenceGroup::Ptr sequence_group, Tokenizer tokenizer);
 
@@ -23,6 +23,9 @@ size_t Sequence::_make_hash(size_t content_length) {
         OPENVINO_ASSERT(filled_blocks_count <= m_prefix_hashes.size());
         if (filled_blocks_count > 0) {
             content.emplace_back(m_prefix_hashes[filled_blocks_count - 1]);
+        } else if (sequence_group->get_prefix_cache_salt() != 0) {
+            // the first block carries the salt, the next ones inherit it through the prefix hashes
+            content.emplace_back(sequence_group->get_prefix_cache_salt());
         }
 
         // get tokens corresponding to current block
@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <cassert>
+#include <chrono>
 #include <set>
 #include <cstdlib>
 #include <string_view>
@@ -351,6 +352,13 @@ class SequenceGroup  : public std::enable_shared_from_this<SequenceGroup> {
 
     size_t m_num_streamed_tokens = 0, m_stream_window_size = 0;
 
+    // time when the request was added to the pipeline, used by deadline-aware scheduling
+    std::chrono::steady_clock::time_point m_arrival_time = std::chrono::steady_clock::now();
+
+    // mixed into hashes of KV cache blocks, so that blocks of the same tokens computed under different conditions,
+    // e.g. LoRA adapters, aren't shared by prefix caching
+    size_t m_prefix_cache_salt = 0;
+
     SequenceGroup(uint64_t request_id, const ov::genai::GenerationConfig& sampling_params, std::size_t block_size)
         : m_request_id(request_id),
           m_sampling_params(sampling_params),
@@ -777,6 +785,14 @@ public:
         return m_block_size;
     }
 
+    void set_prefix_cache_salt(size_t salt) {
+        m_prefix_cache_salt = salt;
+    }
+
+    size_t get_prefix_cache_salt() const {
+        return m_prefix_cache_salt;
+    }
+
     Sequence::Ptr fork_sequence(Sequence::CPtr sequence) {
         auto forked_sequence = Sequence::fork(sequence, m_next_sequence_id++);
         m_sequences.emplace_back(forked_sequence);
@@ -787,6 +803,17 @@ public:
         return m_sampling_params;
     }
 
+    std::chrono::steady_clock::time_point get_arrival_time() const {
+        return m_arrival_time;
+    }
+
+    // returns std::nullopt if request has no deadline
+    std::optional<std::chrono::steady_clock::time_point> get_deadline() const {
+        if (m_sampling_params.deadline_ms == 0)
+            return std::nullopt;
+        return m_arrival_time + std::chrono::milliseconds(m_sampling_params.deadline_ms);
+    }
+
     void set_out_of_memory() {
         for (size_t seq_id = 0; seq_id < m_sequences.size(); ++seq_id) {
             if (m_sequences[seq_id]->is_running()) {
@@ -3,6 +3,8 @@
 
 #include "openvino/genai/text_streamer.hpp"
 
+#include <algorithm>
+
 namespace {
 bool is_incomplete(std::string& text) {
     // MSVC with /utf-8 fails to compile � directly with newline in string literal error.
@@ -12,6 +14,13 @@ bool is_incomplete(std::string& text) {
 
 constexpr size_t delay_n_tokens = 3;
 
+// Number of already decoded tokens which are decoded together with the new ones to provide the detokenizer
+// with a context (leading spaces, characters split across several tokens, etc.)
+constexpr size_t lookback_n_tokens = 4;
+
+// Max number of tokens in the decoding window, after which the window is moved forward
+constexpr size_t max_window_n_tokens = 32;
+
 }  // namespace
 
 namespace ov {
@@ -25,20 +34,63 @@ TextStreamer::TextStreamer(const Tokenizer& tokenizer,
     m_additional_detokenization_params = detokenization_params;
 }
 
+std::string TextStreamer::decode_window(size_t end) {
+    // Text of the tokens before m_window_anchor is already known, so only the window is decoded.
+    // The text of the window tokens before the anchor is skipped by the callers using m_window_anchor_text_len,
+    // this way the detokenizer sees the context of the new tokens and its output doesn't depend on the cache length.
+    std::vector<int64_t> window(m_tokens_cache.begin() + m_window_begin, m_tokens_cache.begin() + end);
+    return m_tokenizer.decode(window, m_additional_detokenization_params);
+}
+
+int64_t TextStreamer::get_decoded_length(const std::string& window_text) const {
+    return static_cast<int64_t>(m_anchor_decoded_len + window_text.size()) - static_cast<int64_t>(m_window_anchor_text_len);
+}
+
+size_t TextStreamer::get_window_text_offset(size_t decoded_len) const {
+    return m_window_anchor_text_len + decoded_len - m_anchor_decoded_len;
+}
+
+void TextStreamer::move_decoding_window() {
+    if (m_tokens_cache.size() - m_window_begin <= max_window_n_tokens || m_decoded_lengths.size() < delay_n_tokens) {
+        return;
+    }
+
+    // the text up to the last position with a known decoded length is already printed and won't be changed
+    size_t anchor = m_decoded_lengths.size() - delay_n_tokens + 1;
+    int64_t anchor_decoded_len = m_decoded_lengths[anchor - 1];
+    if (anchor <= m_window_anchor || anchor_decoded_len < 0 || static_cast<size_t>(anchor_decoded_len) > m_printed_len) {
+        return;
+    }
+
+    m_window_begin = anchor > lookback_n_tokens ? anchor - lookback_n_tokens : 0;
+    m_window_anchor = anchor;
+    m_anchor_decoded_len = anchor_decoded_len;
+    m_window_anchor_text_len = decode_window(anchor).size();
+}
+
+void TextStreamer::reset_decoding_window() {
+    m_window_begin = 0;
+    m_window_anchor = 0;
+    m_window_anchor_text_len = 0;
+    m_anchor_decoded_len = 0;
+}
+
 StreamingStatus TextStreamer::write(int64_t token) {
     std::stringstream res;
     m_tokens_cache.push_back(token);
-    std::string text = m_tokenizer.decode(m_tokens_cache, m_additional_detokenization_params);
-    m_decoded_lengths.push_back(text.length());
+    std::string text = decode_window(m_tokens_cache.size());
+    int64_t decoded_len = get_decoded_length(text);
+    m_decoded_lengths.push_back(decoded_len);
 
-    if (!text.empty() && '\n' == text.back() && text.size() > m_printed_len) {
+    if (!text.empty() && '\n' == text.back() && decoded_len > static_cast<int64_t>(m_printed_len)) {
         // Flush the cache after the new line symbol
-        res << std::string_view{text.data() + m_printed_len, text.size() - m_printed_len};
+        res << std::string_view{text}.substr(get_window_text_offset(m_printed_len));
 
         auto res_status = run_callback_if_needed(res.str());
         m_tokens_cache.clear();
         m_decoded_lengths.clear();
         m_printed_len = 0;
+        reset_decoding_window();
         return res_status;
     }
 
@@ -58,11 +110,12 @@ StreamingStatus TextStreamer::write(int64_t token) {
     compute_decoded_length_for_position(m_decoded_lengths.size() - delay_n_tokens);
 
     auto print_until = m_decoded_lengths[m_decoded_lengths.size() - delay_n_tokens];
+    size_t print_from = get_window_text_offset(m_printed_len);
 
-    if (print_until > -1 && print_until > m_printed_len) {
+    if (print_until > -1 && print_until > m_printed_len && print_from < text.size()) {
         // It is possible to have a shorter text after adding new token.
         // Print to output only if text length is increased.
-        res << std::string_view{text.data() + m_printed_len, print_until - m_printed_len} << std::flush;
+        res << std::string_view{text}.substr(print_from, print_until - m_printed_len) << std::flush;
     }
     
     auto status = run_callback_if_needed(res.str());
@@ -70,6 +123,7 @@ StreamingStatus TextStreamer::write(int64_t token) {
     if (print_until > -1 && print_until > m_printed_len) {
         m_printed_len = print_until;
     }
+    move_decoding_window();
     return status;
 }
 
@@ -79,13 +133,21 @@ void TextStreamer::compute_decoded_length_for_position(size_t cache_position) {
         return;
     }
 
-    auto cache_for_position = std::vector(m_tokens_cache.begin(), m_tokens_cache.begin() + cache_position + 1);
-    std::string text_for_position = m_tokenizer.decode(cache_for_position, m_additional_detokenization_params);
+    std::string text_for_position;
+    int64_t decoded_len = 0;
+    if (cache_position >= m_window_anchor) {
+        text_for_position = decode_window(cache_position + 1);
+        decoded_len = std::max(get_decoded_length(text_for_position), int64_t(0));
+    } else {
+        auto cache_for_position = std::vector(m_tokens_cache.begin(), m_tokens_cache.begin() + cache_position + 1);
+        text_for_position = m_tokenizer.decode(cache_for_position, m_additional_detokenization_params);
+        decoded_len = text_for_position.size();
+    }
 
     if (is_incomplete(text_for_position)) {
         m_decoded_lengths[cache_position] = -1;
     } else {
-        m_decoded_lengths[cache_position] = text_for_position.size();
+        m_decoded_lengths[cache_position] = decoded_len;
     }
 };
 
@@ -120,13 +182,16 @@ StreamingStatus TextStreamer::run_callback_if_needed(const std::string& text) {
 
 void TextStreamer::end() {
     std::stringstream res;
-    std::string text = m_tokenizer.decode(m_tokens_cache, m_additional_detokenization_params);
-    if (text.size() <= m_printed_len)
+    if (m_tokens_cache.empty())
+        return;
+    std::string text = decode_window(m_tokens_cache.size());
+    if (get_decoded_length(text) <= static_cast<int64_t>(m_printed_len))
         return;
-    res << std::string_view{text.data() + m_printed_len, text.size() - m_printed_len} << std::flush;
+    res << std::string_view{text}.substr(get_window_text_offset(m_printed_len)) << std::flush;
     m_tokens_cache.clear();
     m_decoded_lengths.clear();
     m_printed_len = 0;
+    reset_decoding_window();
     m_subword_callback(res.str());
     return;
 }
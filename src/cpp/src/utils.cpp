@@ -5,8 +5,14 @@
 
 #include <variant>
 #include <fstream>
+#include <limits>
 #include <memory>
 
+#ifdef __APPLE__
+#include <sys/types.h>
+#include <sys/sysctl.h>
+#endif
+
 #include "openvino/op/add.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/gather.hpp"
@@ -404,7 +410,13 @@ std::shared_ptr<ov::Model> read_model(const std::filesystem::path& model_dir,  c
     auto [filtered_properties, enable_save_ov_model] = extract_gguf_properties(properties);
     if (is_gguf_model(model_dir)) {
 #ifdef ENABLE_GGUF
-        return create_from_gguf(model_dir.string(), enable_save_ov_model);
+        // the model generated from GGUF is cached along with compiled models when the cache is enabled
+        std::optional<std::filesystem::path> cache_dir;
+        auto cache_dir_it = filtered_properties.find(ov::cache_dir.name());
+        if (cache_dir_it != filtered_properties.end() && !cache_dir_it->second.as<std::string>().empty()) {
+            cache_dir = cache_dir_it->second.as<std::string>();
+        }
+        return create_from_gguf(model_dir.string(), enable_save_ov_model, cache_dir);
 #else
         OPENVINO_ASSERT("GGUF support is switched off. Please, recompile with 'cmake -DENABLE_GGUF=ON'");
 #endif
@@ -785,7 +797,8 @@ std::pair<ov::AnyMap, std::string> extract_attention_backend(const ov::AnyMap& e
     ov::AnyMap properties = external_properties;
 
     auto it = properties.find("ATTENTION_BACKEND");
-    if (it != properties.end()) {
+    const bool is_backend_set = it != properties.end();
+    if (is_backend_set) {
         attention_backend = it->second.as<std::string>();
         OPENVINO_ASSERT(attention_backend == PA_BACKEND || attention_backend == SDPA_BACKEND,
             "Attention backend must be either '", PA_BACKEND, "' or '", SDPA_BACKEND, "', got '", attention_backend, "'");
@@ -797,6 +810,13 @@ std::pair<ov::AnyMap, std::string> extract_attention_backend(const ov::AnyMap& e
             "User properties are conflicting: some of them requires PagedAttention backend, while 'ATTENTION_BACKEND' is set to 'SDPA'");
     }
 
+    // KV caches of chat sessions are stored by the stateful pipeline only
+    if (properties.count(ov::genai::session_cache_size.name()) || properties.count(ov::genai::session_cache_precision.name())) {
+        OPENVINO_ASSERT(attention_backend == SDPA_BACKEND,
+            "'", ov::genai::session_cache_size.name(), "' and '", ov::genai::session_cache_precision.name(),
+            "' properties require 'ATTENTION_BACKEND' to be set to '", SDPA_BACKEND, "' explicitly");
+    }
+
     return {properties, attention_backend};
 };
 
@@ -853,6 +873,39 @@ ov::Tensor merge_text_and_image_embeddings_llava(const ov::Tensor& input_ids, ov
     return inputs_embeds;
 }
 
+size_t get_available_cpu_memory() {
+#ifdef __APPLE__
+    int64_t memsize;
+    size_t len = sizeof(memsize);
+    if (sysctlbyname("hw.memsize", &memsize, &len, NULL, 0) == 0) {
+        return memsize;
+    }
+#endif
+
+#if !defined(_WIN32)
+    std::string token;
+    std::ifstream file("/proc/meminfo");
+    if(file.is_open()) {
+        while(file >> token) {
+            if(token == "MemTotal:") {
+                size_t mem;
+                if(file >> mem) {
+                    constexpr auto max_bytes = std::numeric_limits<size_t>::max() / 1024;
+                    if (mem > max_bytes) {
+                        return std::numeric_limits<size_t>::max();
+                    }
+                    return mem * 1024;
+                } else {
+                    return std::numeric_limits<size_t>::max();
+                }
+            }
+            file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+    }
+#endif
+    return std::numeric_limits<size_t>::max();
+}
+
 size_t get_available_gpu_memory(const std::string& device, size_t num_decoder_layers) {
     OPENVINO_ASSERT(device.find("GPU") != std::string::npos, "get_available_gpu_memory() is applicable for GPU only.");
 
@@ -296,6 +296,9 @@ void save_openvino_model(const std::shared_ptr<ov::Model>& model, const std::str
 
 ov::Tensor merge_text_and_image_embeddings_llava(const ov::Tensor& input_ids, ov::Tensor& text_embeds, const std::vector<ov::Tensor>& image_embeds, int64_t image_token_id);
 
+// Returns available RAM memory on system if possible, otherwise returns std::numeric_limits<size_t>::max()
+size_t get_available_cpu_memory();
+
 size_t get_available_gpu_memory(const std::string& device, size_t num_decoder_layers);
 
 /**
@@ -18,7 +18,9 @@
 
 #include "image_generation/numpy_utils.hpp"
 #include "image_generation/schedulers/ischeduler.hpp"
+#include "image_generation/text_encoder_cache.hpp"
 #include "image_generation/threaded_callback.hpp"
+#include "diffusion_caching/taylorseer_lite.hpp"
 #include "logger.hpp"
 #include "openvino/genai/video_generation/ltx_video_transformer_3d_model.hpp"
 #include "generation_config_utils.hpp"
@@ -333,6 +335,7 @@ class Text2VideoPipeline::LTXPipeline {
 
         auto infer_end = std::chrono::steady_clock::now();
         m_perf_metrics.encoder_inference_duration["text_encoder"] = Ms{infer_end - infer_start}.count();
+        add_text_encoder_cache_stats(m_perf_metrics, *m_t5_text_encoder);
 
         ov::Tensor prompt_attention_mask = m_t5_text_encoder->get_prompt_attention_mask();
 
@@ -455,6 +458,7 @@ public:
 
         VideoGenerationConfig merged_generation_config = m_generation_config;
         utils::update_generation_config(merged_generation_config, properties);
+        m_vae->set_tiling_config(merged_generation_config.vae_tiling_config);
         replace_defaults(merged_generation_config);
         const float requested_guidance_scale = merged_generation_config.guidance_scale;
 
@@ -564,6 +568,8 @@ public:
 
         // Denoising loop
         ov::Tensor noisy_residual_tensor(ov::element::f32, {});
+        // Initialize TaylorSeer if configured
+        TaylorSeerState ts_state(merged_generation_config.taylorseer_config, timesteps.size());
         for (size_t inference_step = 0; inference_step < timesteps.size(); ++inference_step) {
             auto step_start = std::chrono::steady_clock::now();
             // concat the same latent twice along a batch dimension in case of CFG
@@ -590,7 +596,9 @@ public:
             timestep_data[0] = timesteps[inference_step];
 
             auto infer_start = std::chrono::steady_clock::now();
-            ov::Tensor noise_pred_tensor = m_transformer->infer(latent_cfg, timestep);
+            ov::Tensor noise_pred_tensor = ts_state.infer_or_predict(inference_step, [&] {
+                return m_transformer->infer(latent_cfg, timestep);
+            });
             auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
             m_perf_metrics.raw_metrics.transformer_inference_durations.emplace_back(MicroSeconds(infer_duration));
 
@@ -18,6 +18,7 @@
 #include "utils.hpp"
 #include "json_utils.hpp"
 #include "lora/helper.hpp"
+#include "image_generation/vae_tiling.hpp"
 
 using namespace ov::genai;
 
@@ -54,6 +55,23 @@ std::pair<int64_t, int64_t> get_transformer_patch_size(const std::filesystem::pa
     return {patch_size, patch_size_t};
 }
 
+VAETilingParams get_tiling_params(const VAETilingConfig& tiling_config, size_t spatial_compression_ratio, size_t temporal_compression_ratio) {
+    // a tile of n latent frames is decoded to (n - 1) * temporal_compression_ratio + 1 frames, so neighbouring tiles
+    // share at least one latent frame to cover all frames
+    const size_t frame_overlap = tiling_config.frame_overlap <= 1 ? 1 : (tiling_config.frame_overlap - 2) / temporal_compression_ratio + 2;
+
+    VAETilingParams params;
+    params.tile_size = {(tiling_config.tile_num_frames - 1) / temporal_compression_ratio + 1,
+                        tiling_config.tile_size / spatial_compression_ratio,
+                        tiling_config.tile_size / spatial_compression_ratio};
+    params.overlap = {frame_overlap,
+                      tiling_config.tile_overlap / spatial_compression_ratio,
+                      tiling_config.tile_overlap / spatial_compression_ratio};
+    params.spatial_scale_num = spatial_compression_ratio;
+    params.temporal_scale = temporal_compression_ratio;
+    return params;
+}
+
 } // namespace
 
 AutoencoderKLLTXVideo::Config::Config(const std::filesystem::path& config_path) {
@@ -144,16 +162,8 @@ AutoencoderKLLTXVideo& AutoencoderKLLTXVideo::reshape(int64_t batch_size,
     // TODO: for img2video
     // if (m_encoder_model) {...}
 
-    int64_t spatial_compression_ratio =
-        get_config().patch_size *
-        std::pow(
-            2,
-            std::accumulate(get_config().spatio_temporal_scaling.begin(), get_config().spatio_temporal_scaling.end(), 0));
-    int64_t temporal_compression_ratio =
-        get_config().patch_size_t *
-        std::pow(
-            2,
-            std::accumulate(get_config().spatio_temporal_scaling.begin(), get_config().spatio_temporal_scaling.end(), 0));
+    int64_t spatial_compression_ratio = get_spatial_compression_ratio();
+    int64_t temporal_compression_ratio = get_temporal_compression_ratio();
 
     num_frames = ((num_frames - 1) / temporal_compression_ratio + 1) / m_transformer_patch_size_t;
     height /= (spatial_compression_ratio * m_transformer_patch_size);
@@ -169,11 +179,52 @@ AutoencoderKLLTXVideo& AutoencoderKLLTXVideo::reshape(int64_t batch_size,
 ov::Tensor AutoencoderKLLTXVideo::decode(const ov::Tensor& latent) {
     OPENVINO_ASSERT(m_decoder_request, "VAE decoder model must be compiled first. Cannot infer non-compiled model");
 
+    if (m_tiling_config) {
+        init_tile_infer_requests(m_decoder_tile_requests, m_decoder_request, m_tiling_config->num_infer_requests);
+        return infer_tiled(m_decoder_tile_requests, latent,
+                           get_tiling_params(*m_tiling_config, get_spatial_compression_ratio(), get_temporal_compression_ratio()));
+    }
+
     m_decoder_request.set_input_tensor(latent);
     m_decoder_request.infer();
     return m_decoder_request.get_output_tensor();
 }
 
+void AutoencoderKLLTXVideo::decode(const ov::Tensor& latent, const std::function<void(const ov::Tensor&)>& frames_callback) {
+    OPENVINO_ASSERT(m_decoder_request, "VAE decoder model must be compiled first. Cannot infer non-compiled model");
+
+    if (!m_tiling_config) {
+        frames_callback(decode(latent));
+        return;
+    }
+
+    init_tile_infer_requests(m_decoder_tile_requests, m_decoder_request, m_tiling_config->num_infer_requests);
+    infer_tiled(m_decoder_tile_requests, latent,
+                get_tiling_params(*m_tiling_config, get_spatial_compression_ratio(), get_temporal_compression_ratio()),
+                frames_callback);
+}
+
+void AutoencoderKLLTXVideo::set_tiling_config(const std::optional<VAETilingConfig>& tiling_config) {
+    if (tiling_config) {
+        OPENVINO_ASSERT(tiling_config->tile_size >= get_spatial_compression_ratio(),
+                        "VAETilingConfig: tile_size must be at least ", get_spatial_compression_ratio(), ", got ", tiling_config->tile_size);
+        OPENVINO_ASSERT(tiling_config->tile_num_frames > get_temporal_compression_ratio(),
+                        "VAETilingConfig: tile_num_frames must be greater than ", get_temporal_compression_ratio(), ", got ", tiling_config->tile_num_frames);
+        OPENVINO_ASSERT(tiling_config->num_infer_requests > 0, "VAETilingConfig: num_infer_requests must be greater than 0");
+    }
+    m_tiling_config = tiling_config;
+}
+
+size_t AutoencoderKLLTXVideo::get_spatial_compression_ratio() const {
+    return m_config.patch_size *
+           std::pow(2, std::accumulate(m_config.spatio_temporal_scaling.begin(), m_config.spatio_temporal_scaling.end(), 0));
+}
+
+size_t AutoencoderKLLTXVideo::get_temporal_compression_ratio() const {
+    return m_config.patch_size_t *
+           std::pow(2, std::accumulate(m_config.spatio_temporal_scaling.begin(), m_config.spatio_temporal_scaling.end(), 0));
+}
+
 const AutoencoderKLLTXVideo::Config& AutoencoderKLLTXVideo::get_config() const {
     return m_config;
 }
@@ -0,0 +1,289 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "visual_language/encoded_image_cache.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325;
+constexpr uint64_t FNV_PRIME = 0x100000001b3;
+// bumped on each change of the layout of encoded images stored on disk
+constexpr uint32_t FILE_FORMAT_VERSION = 1;
+
+uint64_t hash_combine(uint64_t hash, uint64_t value) {
+    return (hash ^ value) * FNV_PRIME;
+}
+
+template <typename T>
+void write_value(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read_value(std::istream& stream) {
+    T value{};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+
+void write_shape(std::ostream& stream, const ov::Shape& shape) {
+    write_value<uint64_t>(stream, shape.size());
+    for (size_t dim : shape) {
+        write_value<uint64_t>(stream, dim);
+    }
+}
+
+ov::Shape read_shape(std::istream& stream) {
+    ov::Shape shape(read_value<uint64_t>(stream));
+    for (auto& dim : shape) {
+        dim = read_value<uint64_t>(stream);
+    }
+    return shape;
+}
+
+void write_tensor(std::ostream& stream, const ov::Tensor& tensor) {
+    write_value<uint8_t>(stream, static_cast<bool>(tensor));
+    if (!tensor) {
+        return;
+    }
+    ov::Tensor continuous_tensor = tensor;
+    if (!tensor.is_continuous()) {
+        continuous_tensor = ov::Tensor(tensor.get_element_type(), tensor.get_shape());
+        tensor.copy_to(continuous_tensor);
+    }
+    const std::string type_name = tensor.get_element_type().get_type_name();
+    write_value<uint64_t>(stream, type_name.size());
+    stream.write(type_name.data(), type_name.size());
+    write_shape(stream, tensor.get_shape());
+    stream.write(static_cast<const char*>(continuous_tensor.data()), continuous_tensor.get_byte_size());
+}
+
+ov::Tensor read_tensor(std::istream& stream) {
+    if (!read_value<uint8_t>(stream)) {
+        return {};
+    }
+    std::string type_name(read_value<uint64_t>(stream), '\0');
+    stream.read(type_name.data(), type_name.size());
+    ov::Tensor tensor(ov::element::Type(type_name), read_shape(stream));
+    stream.read(static_cast<char*>(tensor.data()), tensor.get_byte_size());
+    return tensor;
+}
+
+void write_encoded_image(std::ostream& stream, const EncodedImage& encoded_image) {
+    write_value(stream, FILE_FORMAT_VERSION);
+    write_tensor(stream, encoded_image.resized_source);
+    write_value<uint64_t>(stream, encoded_image.resized_source_size.height);
+    write_value<uint64_t>(stream, encoded_image.resized_source_size.width);
+    write_shape(stream, encoded_image.slices_shape);
+    write_value<int32_t>(stream, encoded_image.patches_grid.first);
+    write_value<int32_t>(stream, encoded_image.patches_grid.second);
+    write_value<uint64_t>(stream, encoded_image.original_image_size.height);
+    write_value<uint64_t>(stream, encoded_image.original_image_size.width);
+    write_tensor(stream, encoded_image.images_features_projection);
+    write_tensor(stream, encoded_image.resampled_image.resampled_source);
+    write_value<uint64_t>(stream, encoded_image.resampled_image.vision_embed_tensors.size());
+    for (const auto& row : encoded_image.resampled_image.vision_embed_tensors) {
+        write_value<uint64_t>(stream, row.size());
+        for (const auto& tensor : row) {
+            write_tensor(stream, tensor);
+        }
+    }
+    write_value<uint64_t>(stream, encoded_image.num_image_tokens);
+}
+
+std::optional<EncodedImage> read_encoded_image(std::istream& stream) {
+    if (read_value<uint32_t>(stream) != FILE_FORMAT_VERSION) {
+        return std::nullopt;
+    }
+    EncodedImage encoded_image;
+    encoded_image.resized_source = read_tensor(stream);
+    encoded_image.resized_source_size.height = read_value<uint64_t>(stream);
+    encoded_image.resized_source_size.width = read_value<uint64_t>(stream);
+    encoded_image.slices_shape = read_shape(stream);
+    encoded_image.patches_grid.first = read_value<int32_t>(stream);
+    encoded_image.patches_grid.second = read_value<int32_t>(stream);
+    encoded_image.original_image_size.height = read_value<uint64_t>(stream);
+    encoded_image.original_image_size.width = read_value<uint64_t>(stream);
+    encoded_image.images_features_projection = read_tensor(stream);
+    encoded_image.resampled_image.resampled_source = read_tensor(stream);
+    encoded_image.resampled_image.vision_embed_tensors.resize(read_value<uint64_t>(stream));
+    for (auto& row : encoded_image.resampled_image.vision_embed_tensors) {
+        row.resize(read_value<uint64_t>(stream));
+        for (auto& tensor : row) {
+            tensor = read_tensor(stream);
+        }
+    }
+    encoded_image.num_image_tokens = read_value<uint64_t>(stream);
+    if (!stream) {
+        return std::nullopt;
+    }
+    return encoded_image;
+}
+
+size_t get_tensor_size(const ov::Tensor& tensor) {
+    return tensor ? tensor.get_byte_size() : 0;
+}
+
+size_t get_encoded_image_size(const EncodedImage& encoded_image) {
+    size_t size = get_tensor_size(encoded_image.resized_source) +
+                  get_tensor_size(encoded_image.images_features_projection) +
+                  get_tensor_size(encoded_image.resampled_image.resampled_source);
+    for (const auto& row : encoded_image.resampled_image.vision_embed_tensors) {
+        for (const auto& tensor : row) {
+            size += get_tensor_size(tensor);
+        }
+    }
+    return size;
+}
+
+}  // namespace
+
+EncodedImageCache::EncodedImageCache(size_t max_size_in_bytes, std::optional<std::filesystem::path> cache_dir)
+    : m_max_size_in_bytes(max_size_in_bytes),
+      m_cache_dir(std::move(cache_dir)) {
+    if (m_cache_dir) {
+        std::filesystem::create_directories(*m_cache_dir);
+    }
+}
+
+std::shared_ptr<EncodedImageCache> EncodedImageCache::get_instance() {
+    static std::shared_ptr<EncodedImageCache> instance = []() -> std::shared_ptr<EncodedImageCache> {
+        size_t cache_size_mb = 0;
+        if (const char* env = std::getenv("VISION_ENCODER_CACHE_SIZE_MB")) {
+            try {
+                cache_size_mb = std::stoul(env);
+            } catch (...) {
+                cache_size_mb = 0;
+            }
+        }
+        if (cache_size_mb == 0) {
+            return nullptr;
+        }
+
+        std::optional<std::filesystem::path> cache_dir;
+        if (const char* env = std::getenv("VISION_ENCODER_CACHE_DIR")) {
+            cache_dir = env;
+        }
+        return std::make_shared<EncodedImageCache>(cache_size_mb * 1024 * 1024, cache_dir);
+    }();
+    return instance;
+}
+
+EncodedImageCache::Key EncodedImageCache::compute_key(uint64_t model_hash, const ov::Tensor& image) {
+    uint64_t hash = hash_combine(FNV_OFFSET_BASIS, model_hash);
+    for (const auto dim : image.get_shape()) {
+        hash = hash_combine(hash, dim);
+    }
+    hash = hash_combine(hash, image.get_element_type().hash());
+
+    // the whole content is hashed, since a collision would make the model see another image
+    const uint8_t* data = static_cast<const uint8_t*>(image.data());
+    const size_t byte_size = image.get_byte_size();
+    size_t offset = 0;
+    for (; offset + sizeof(uint64_t) <= byte_size; offset += sizeof(uint64_t)) {
+        uint64_t chunk;
+        std::memcpy(&chunk, data + offset, sizeof(chunk));
+        hash = hash_combine(hash, chunk);
+    }
+    for (; offset < byte_size; ++offset) {
+        hash = hash_combine(hash, data[offset]);
+    }
+    return hash;
+}
+
+std::filesystem::path EncodedImageCache::_get_file_path(Key key) const {
+    std::stringstream file_name;
+    file_name << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+    return *m_cache_dir / file_name.str();
+}
+
+void EncodedImageCache::_insert(Key key, const EncodedImage& encoded_image) {
+    const size_t size_in_bytes = get_encoded_image_size(encoded_image);
+    if (size_in_bytes > m_max_size_in_bytes) {
+        return;
+    }
+
+    m_entries.push_front(Entry{key, encoded_image, size_in_bytes});
+    m_key_to_entry[key] = m_entries.begin();
+    m_size_in_bytes += size_in_bytes;
+
+    while (m_size_in_bytes > m_max_size_in_bytes) {
+        const Entry& lru_entry = m_entries.back();
+        m_size_in_bytes -= lru_entry.size_in_bytes;
+        m_key_to_entry.erase(lru_entry.key);
+        m_entries.pop_back();
+    }
+}
+
+std::optional<EncodedImage> EncodedImageCache::get(Key key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_key_to_entry.find(key);
+    if (it != m_key_to_entry.end()) {
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return it->second->encoded_image;
+    }
+
+    if (!m_cache_dir) {
+        return std::nullopt;
+    }
+    std::ifstream file(_get_file_path(key), std::ios::binary);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+    std::optional<EncodedImage> encoded_image;
+    try {
+        encoded_image = read_encoded_image(file);
+    } catch (const std::exception&) {
+        // a corrupted file is treated as a miss and overwritten by the next put
+    }
+    if (encoded_image) {
+        _insert(key, *encoded_image);
+    }
+    return encoded_image;
+}
+
+void EncodedImageCache::put(Key key, const EncodedImage& encoded_image) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_key_to_entry.find(key);
+    if (it != m_key_to_entry.end()) {
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+
+    if (m_cache_dir) {
+        // write to a temporary file first, so that other processes sharing the directory never read a partial one
+        const auto file_path = _get_file_path(key);
+        auto tmp_file_path = file_path;
+        tmp_file_path += ".tmp";
+        {
+            std::ofstream file(tmp_file_path, std::ios::binary);
+            OPENVINO_ASSERT(file.is_open(), "Failed to open ", tmp_file_path, " to store an encoded image");
+            write_encoded_image(file, encoded_image);
+        }
+        std::error_code error;
+        std::filesystem::rename(tmp_file_path, file_path, error);
+    }
+    _insert(key, encoded_image);
+}
+
+size_t EncodedImageCache::num_entries() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t EncodedImageCache::size_in_bytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_size_in_bytes;
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,80 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include "visual_language/vision_encoder.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief LRU cache of encoded images bounded by the total size of their tensors. Entries are keyed by a hash of the
+ * image content and of the model encoding it, so that the same image sent in different requests or chat sessions
+ * passes through the vision encoder once. Optionally, encoded images are also persisted in a directory and loaded
+ * from it on a memory miss, which lets them survive evictions and process restarts.
+ */
+class EncodedImageCache {
+public:
+    using Key = uint64_t;
+
+    /**
+     * @param max_size_in_bytes Max total size of tensors of encoded images kept in memory.
+     * @param cache_dir Directory to persist encoded images in. Persistence is disabled if not set.
+     */
+    explicit EncodedImageCache(size_t max_size_in_bytes, std::optional<std::filesystem::path> cache_dir = std::nullopt);
+
+    /**
+     * Process-wide cache shared by all VLM pipelines. The cache is configured by environment variables:
+     * VISION_ENCODER_CACHE_SIZE_MB sets its memory budget and VISION_ENCODER_CACHE_DIR enables persistence.
+     * @return The cache or nullptr if VISION_ENCODER_CACHE_SIZE_MB is not set or zero.
+     */
+    static std::shared_ptr<EncodedImageCache> get_instance();
+
+    /**
+     * @param model_hash Hash identifying the model and the device which encode the image.
+     * @param image Image tensor.
+     * @return Cache key of the encoded image. Unlike VisionRegistry ids, the whole image content is hashed.
+     */
+    static Key compute_key(uint64_t model_hash, const ov::Tensor& image);
+
+    /**
+     * Looks for an encoded image and marks it as the most recently used one.
+     * @return The encoded image or std::nullopt on a miss.
+     */
+    std::optional<EncodedImage> get(Key key);
+
+    /**
+     * Adds an encoded image evicting the least recently used ones if the memory budget is exceeded.
+     */
+    void put(Key key, const EncodedImage& encoded_image);
+
+    size_t num_entries() const;
+
+    size_t size_in_bytes() const;
+
+private:
+    struct Entry {
+        Key key;
+        EncodedImage encoded_image;
+        size_t size_in_bytes;
+    };
+
+    size_t m_max_size_in_bytes;
+    std::optional<std::filesystem::path> m_cache_dir;
+    size_t m_size_in_bytes = 0;
+    // most recently used entries go first
+    std::list<Entry> m_entries;
+    std::unordered_map<Key, std::list<Entry>::iterator> m_key_to_entry;
+    mutable std::mutex m_mutex;
+
+    void _insert(Key key, const EncodedImage& encoded_image);
+    std::filesystem::path _get_file_path(Key key) const;
+};
+
+}  // namespace ov::genai
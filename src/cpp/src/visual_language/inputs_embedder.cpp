@@ -4,9 +4,12 @@
 #include "openvino/genai/visual_language/perf_metrics.hpp"
 #include "visual_language/inputs_embedder.hpp"
 
+#include <random>
+
 #include "visual_language/clip.hpp"
 #include "visual_language/vision_encoder.hpp"
 #include "visual_language/embedding_model.hpp"
+#include "visual_language/encoded_image_cache.hpp"
 
 #include "visual_language/qwen2vl/classes.hpp"
 #include "visual_language/qwen2_5_vl/classes.hpp"
@@ -257,7 +260,8 @@ const std::unordered_map<std::string, ov::Tensor>& InputsEmbedder::IInputsEmbedd
 
 InputsEmbedder::InputsEmbedder(const std::filesystem::path& model_dir,
                                const std::string& device,
-                               const ov::AnyMap device_config) {
+                               const ov::AnyMap device_config) :
+    m_encoded_image_cache_model_hash(std::hash<std::string>{}(std::filesystem::absolute(model_dir).string() + "|" + device)) {
     auto vlm_config = utils::from_config_json_if_exists<VLMConfig>(model_dir, "config.json");
 
     if (vlm_config.model_type == VLMModelType::MINICPM) {
@@ -293,7 +297,9 @@ InputsEmbedder::InputsEmbedder(const ModelsMap& models_map,
                                const Tokenizer& tokenizer,
                                const std::filesystem::path& config_dir_path,
                                const std::string& device,
-                               const ov::AnyMap device_config) {
+                               const ov::AnyMap device_config) :
+    // models from memory can't be identified, so their encoded images are never shared with other pipelines
+    m_encoded_image_cache_model_hash((static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}()) {
     auto vlm_config = utils::from_config_json_if_exists<VLMConfig>(config_dir_path, "config.json");
 
     if (vlm_config.model_type == VLMModelType::MINICPM) {
@@ -385,7 +391,43 @@ const std::unordered_map<std::string, ov::Tensor>& InputsEmbedder::get_lm_extra_
 }
 
 std::vector<ov::genai::EncodedImage> InputsEmbedder::encode_images(const std::vector<ov::Tensor>& images) {
-    return m_impl->encode_images(images);
+    auto cache = EncodedImageCache::get_instance();
+    // a batched image tensor is encoded to several images, such inputs are not cached
+    const bool has_batched_images = std::any_of(images.begin(), images.end(), [](const ov::Tensor& image) {
+        return image.get_shape().size() == 4 && image.get_shape().at(0) != 1;
+    });
+    if (!cache || has_batched_images) {
+        return m_impl->encode_images(images);
+    }
+
+    std::vector<std::optional<EncodedImage>> cached_images;
+    std::vector<EncodedImageCache::Key> keys;
+    std::vector<ov::Tensor> images_to_encode;
+    for (const auto& image : images) {
+        keys.push_back(EncodedImageCache::compute_key(m_encoded_image_cache_model_hash, image));
+        cached_images.push_back(cache->get(keys.back()));
+        if (!cached_images.back()) {
+            images_to_encode.push_back(image);
+        }
+    }
+
+    std::vector<EncodedImage> newly_encoded_images;
+    if (!images_to_encode.empty()) {
+        newly_encoded_images = m_impl->encode_images(images_to_encode);
+        OPENVINO_ASSERT(newly_encoded_images.size() == images_to_encode.size(), "Input images size and encoded images size mismatch!");
+    }
+
+    std::vector<EncodedImage> encoded_images;
+    encoded_images.reserve(images.size());
+    for (size_t i = 0, encoded_idx = 0; i < images.size(); ++i) {
+        if (cached_images[i]) {
+            encoded_images.push_back(std::move(*cached_images[i]));
+        } else {
+            cache->put(keys[i], newly_encoded_images[encoded_idx]);
+            encoded_images.push_back(std::move(newly_encoded_images[encoded_idx++]));
+        }
+    }
+    return encoded_images;
 }
 
 std::vector<ov::genai::EncodedVideo> InputsEmbedder::encode_videos(const std::vector<ov::Tensor>& videos) {
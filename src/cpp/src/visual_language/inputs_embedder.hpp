@@ -351,6 +351,8 @@ private:
     };
 
     std::shared_ptr<IInputsEmbedder> m_impl;
+    // identifies the model and the device in keys of the process-wide cache of encoded images
+    uint64_t m_encoded_image_cache_model_hash = 0;
 
     friend class InputsEmbedderMiniCPM;
     friend class InputsEmbedderLLaVA;
@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <complex>
 #include <fstream>
 #include <iostream>
 #include <nlohmann/json.hpp>
@@ -40,91 +41,52 @@ static bool hann_window(const size_t length, const bool periodic, std::vector<fl
     return true;
 }
 
-// naive Discrete Fourier Transform
-// input is real-valued
-// output is complex-valued
-static void dft(const std::vector<float>& in,
-                std::vector<float>& out,
-                const std::vector<float>& sin_vals,
-                const std::vector<float>& cos_vals,
-                const size_t n_fft) {
-    int N = in.size();
-
-    out.resize(N * 2);
-    const int sin_cos_step = n_fft / N;
-
-    for (int k = 0; k < N; k++) {
-        float re = 0;
-        float im = 0;
-
-        for (int n = 0; n < N; n++) {
-            int idx = (k * n * sin_cos_step) % (n_fft);  // t = 2*M_PI*k*n/N
-            re += in[n] * cos_vals[idx];                 // cos(t)
-            im -= in[n] * sin_vals[idx];                 // sin(t)
-        }
-
-        out[k * 2 + 0] = re;
-        out[k * 2 + 1] = im;
+// log10 mel energies of the frame starting at samples, samples past num_samples are zeros
+static void log_mel_frame(const float* samples,
+                          int num_samples,
+                          const std::vector<float>& hann,
+                          const ov::genai::RealFFT& fft_plan,
+                          const std::vector<float>& mel_filter,
+                          const std::vector<std::pair<size_t, size_t>>& mel_filter_ranges,
+                          std::vector<float>& fft_in,
+                          std::vector<std::complex<float>>& fft_out,
+                          std::vector<std::complex<float>>& fft_work,
+                          float* output,
+                          size_t output_stride) {
+    const int frame_size = fft_plan.get_size();
+    const int n_fft = 1 + (frame_size / 2);
+    num_samples = std::max(num_samples, 0);
+
+    // apply Hanning window (~10% faster)
+    for (int j = 0; j < std::min(frame_size, num_samples); j++) {
+        fft_in[j] = hann[j] * samples[j];
     }
-}
-
-// Cooley-Tukey FFT
-// input is real-valued
-// output is complex-valued
-static void fft(const std::vector<float>& in,
-                std::vector<float>& out,
-                const std::vector<float>& sin_vals,
-                const std::vector<float>& cos_vals,
-                const size_t n_fft) {
-    out.resize(in.size() * 2);
-
-    int N = in.size();
-
-    if (N == 1) {
-        out[0] = in[0];
-        out[1] = 0;
-        return;
+    // fill the rest with zeros
+    if (num_samples < frame_size) {
+        std::fill(fft_in.begin() + num_samples, fft_in.end(), 0.0);
     }
 
-    if (N % 2 == 1) {
-        dft(in, out, sin_vals, cos_vals, n_fft);
-        return;
-    }
+    fft_plan.transform(fft_in.data(), fft_out.data(), fft_work.data());
 
-    std::vector<float> even;
-    std::vector<float> odd;
-
-    even.reserve(N / 2);
-    odd.reserve(N / 2);
-
-    for (int i = 0; i < N; i++) {
-        if (i % 2 == 0) {
-            even.push_back(in[i]);
-        } else {
-            odd.push_back(in[i]);
-        }
+    // Calculate modulus^2 of complex numbers, the power spectrum overwrites the real parts of the bins
+    // Use pow(fft_out[2 * j + 0], 2) + pow(fft_out[2 * j + 1], 2) causes inference quality problem? Interesting.
+    // The loop over interleaved floats is vectorized by the compiler.
+    float* power = reinterpret_cast<float*>(fft_out.data());
+    for (int j = 0; j < n_fft; j++) {
+        power[j] = power[2 * j + 0] * power[2 * j + 0] + power[2 * j + 1] * power[2 * j + 1];
     }
 
-    std::vector<float> even_fft;
-    std::vector<float> odd_fft;
-
-    fft(even, even_fft, sin_vals, cos_vals, n_fft);
-    fft(odd, odd_fft, sin_vals, cos_vals, n_fft);
-
-    const int sin_cos_step = n_fft / N;
-    for (int k = 0; k < N / 2; k++) {
-        int idx = k * sin_cos_step;  // t = 2*M_PI*k/N
-        float re = cos_vals[idx];    // cos(t)
-        float im = -sin_vals[idx];   // sin(t)
-
-        float re_odd = odd_fft[2 * k + 0];
-        float im_odd = odd_fft[2 * k + 1];
+    // mel spectrogram, each triangular filter covers a few neighbouring bins only
+    for (size_t j = 0; j < mel_filter_ranges.size(); j++) {
+        const float* filter = mel_filter.data() + j * n_fft;
+        double sum = 0.0;
+        for (size_t k = mel_filter_ranges[j].first; k < mel_filter_ranges[j].second; k++) {
+            sum += power[k] * filter[k];
+        }
 
-        out[2 * k + 0] = even_fft[2 * k + 0] + re * re_odd - im * im_odd;
-        out[2 * k + 1] = even_fft[2 * k + 1] + re * im_odd + im * re_odd;
+        sum = log10(std::max(sum, 1e-10));
 
-        out[2 * (k + N / 2) + 0] = even_fft[2 * k + 0] - re * re_odd + im * im_odd;
-        out[2 * (k + N / 2) + 1] = even_fft[2 * k + 1] - re * im_odd - im * re_odd;
+        output[j * output_stride] = sum;
     }
 }
 
@@ -132,62 +94,36 @@ static void log_mel_spectrogram_worker_thread(int ith,
                                               const std::vector<float>& hann,
                                               const std::vector<float>& samples,
                                               int n_samples,
-                                              int frame_size,
                                               int frame_step,
                                               int n_threads,
+                                              const ov::genai::RealFFT& fft_plan,
                                               const std::vector<float>& mel_filter,
-                                              WhisperFeatures& features,
-                                              const std::vector<float>& sin_vals,
-                                              const std::vector<float>& cos_vals) {
+                                              const std::vector<std::pair<size_t, size_t>>& mel_filter_ranges,
+                                              WhisperFeatures& features) {
+    const int frame_size = fft_plan.get_size();
     std::vector<float> fft_in(frame_size, 0.0);
-    std::vector<float> fft_out(2 * frame_size);
+    std::vector<std::complex<float>> fft_out(frame_size / 2 + 1);
+    std::vector<std::complex<float>> fft_work(fft_plan.get_work_size());
     int n_fft = 1 + (frame_size / 2);
     int i = ith;
 
     OPENVINO_ASSERT(mel_filter.size() == n_fft * features.feature_size);
+    OPENVINO_ASSERT(mel_filter_ranges.size() == features.feature_size);
 
     // calculate FFT only when fft_in are not all zero
     for (; i < std::min(n_samples / frame_step + 1, int(features.n_frames)); i += n_threads) {
         const int offset = i * frame_step;
-
-        // apply Hanning window (~10% faster)
-        for (int j = 0; j < std::min(frame_size, n_samples - offset); j++) {
-            fft_in[j] = hann[j] * samples[offset + j];
-        }
-        // fill the rest with zeros
-        if (n_samples - offset < frame_size) {
-            std::fill(fft_in.begin() + (n_samples - offset), fft_in.end(), 0.0);
-        }
-
-        // FFT
-        fft(fft_in, fft_out, sin_vals, cos_vals, frame_size);
-
-        // Calculate modulus^2 of complex numbers
-        // Use pow(fft_out[2 * j + 0], 2) + pow(fft_out[2 * j + 1], 2) causes inference quality problem? Interesting.
-        for (int j = 0; j < n_fft; j++) {
-            fft_out[j] = (fft_out[2 * j + 0] * fft_out[2 * j + 0] + fft_out[2 * j + 1] * fft_out[2 * j + 1]);
-        }
-
-        // mel spectrogram
-        for (int j = 0; j < features.feature_size; j++) {
-            double sum = 0.0;
-
-            // unroll loop (suggested by GH user @lunixbochs)
-            int k = 0;
-            for (k = 0; k < n_fft - 3; k += 4) {
-                sum += fft_out[k + 0] * mel_filter[j * n_fft + k + 0] + fft_out[k + 1] * mel_filter[j * n_fft + k + 1] +
-                       fft_out[k + 2] * mel_filter[j * n_fft + k + 2] + fft_out[k + 3] * mel_filter[j * n_fft + k + 3];
-            }
-
-            // handle n_fft remainder
-            for (; k < n_fft; k++) {
-                sum += fft_out[k] * mel_filter[j * n_fft + k];
-            }
-
-            sum = log10(std::max(sum, 1e-10));
-
-            features.data[j * features.n_frames + i] = sum;
-        }
+        log_mel_frame(samples.data() + offset,
+                      n_samples - offset,
+                      hann,
+                      fft_plan,
+                      mel_filter,
+                      mel_filter_ranges,
+                      fft_in,
+                      fft_out,
+                      fft_work,
+                      features.data.data() + i,
+                      features.n_frames);
     }
 
     // Otherwise fft_out are all zero
@@ -199,6 +135,26 @@ static void log_mel_spectrogram_worker_thread(int ith,
     }
 }
 
+// clamping and normalization
+void normalize_log_mel(std::vector<float>& data) {
+    double mmax = -1e20;
+    for (int i = 0; i < data.size(); i++) {
+        if (data[i] > mmax) {
+            mmax = data[i];
+        }
+    }
+
+    mmax -= 8.0;
+
+    for (int i = 0; i < data.size(); i++) {
+        if (data[i] < mmax) {
+            data[i] = mmax;
+        }
+
+        data[i] = (data[i] + 4.0) / 4.0;
+    }
+}
+
 // python implementation: https://github.com/huggingface/transformers/blob/check_gemma/src/transformers/audio_utils.py
 
 float hertz_to_mel(const float freq) {
@@ -302,19 +258,6 @@ std::vector<std::vector<float>> mel_filter_bank(const int64_t num_frequency_bins
     return mel_filters;
 }
 
-// In FFT, we frequently use sine and cosine operations with the same values.
-// We can use precalculated values to speed up the process.
-void fill_sin_cos_table(std::vector<float>& sin_vals, std::vector<float>& cos_vals, const size_t n_fft) {
-    sin_vals.resize(n_fft);
-    cos_vals.resize(n_fft);
-
-    for (size_t i = 0; i < n_fft; i++) {
-        double theta = (2 * M_PI * i) / n_fft;
-        sin_vals[i] = sinf(theta);
-        cos_vals[i] = cosf(theta);
-    }
-}
-
 std::vector<float> pad(const std::vector<float>& raw_speech,
                        const size_t minimum_length,
                        const size_t reflect_pad_size) {
@@ -340,18 +283,13 @@ std::vector<float> pad(const std::vector<float>& raw_speech,
 WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_speech,
                                               const size_t sampling_rate,
                                               const size_t feature_size,
-                                              const size_t n_fft,
                                               const size_t hop_length,
                                               const size_t n_threads,
+                                              const std::vector<float>& hann,
+                                              const ov::genai::RealFFT& fft_plan,
                                               const std::vector<float>& mel_filter,
-                                              const std::vector<float>& sin_vals,
-                                              const std::vector<float>& cos_vals) {
-    // Hanning window (Use cosf to eliminate difference)
-    // ref: https://pytorch.org/docs/stable/generated/torch.hann_window.html
-    // ref: https://github.com/openai/whisper/blob/main/whisper/audio.py#L147
-    std::vector<float> hann;
-    hann_window(n_fft, true, hann);
-
+                                              const std::vector<std::pair<size_t, size_t>>& mel_filter_ranges) {
+    const size_t n_fft = fft_plan.get_size();
     const size_t reflect_pad_size = n_fft / 2;
     auto padded_raw_speech = pad(raw_speech, sampling_rate * 30, reflect_pad_size);
 
@@ -369,15 +307,14 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
             workers[iw] = std::thread(log_mel_spectrogram_worker_thread,
                                       iw + 1,
                                       std::cref(hann),
-                                      padded_raw_speech,
+                                      std::cref(padded_raw_speech),
                                       raw_speech.size() + reflect_pad_size,
-                                      n_fft,
                                       hop_length,
                                       n_threads,
+                                      std::cref(fft_plan),
                                       std::cref(mel_filter),
-                                      std::ref(features),
-                                      std::cref(sin_vals),
-                                      std::cref(cos_vals));
+                                      std::cref(mel_filter_ranges),
+                                      std::ref(features));
         }
 
         // main thread
@@ -385,36 +322,19 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
                                           hann,
                                           padded_raw_speech,
                                           raw_speech.size() + reflect_pad_size,
-                                          n_fft,
                                           hop_length,
                                           n_threads,
+                                          fft_plan,
                                           mel_filter,
-                                          features,
-                                          sin_vals,
-                                          cos_vals);
+                                          mel_filter_ranges,
+                                          features);
 
         for (int iw = 0; iw < n_threads - 1; ++iw) {
             workers[iw].join();
         }
     }
 
-    // clamping and normalization
-    double mmax = -1e20;
-    for (int i = 0; i < features.feature_size * features.n_frames; i++) {
-        if (features.data[i] > mmax) {
-            mmax = features.data[i];
-        }
-    }
-
-    mmax -= 8.0;
-
-    for (int i = 0; i < features.feature_size * features.n_frames; i++) {
-        if (features.data[i] < mmax) {
-            features.data[i] = mmax;
-        }
-
-        features.data[i] = (features.data[i] + 4.0) / 4.0;
-    }
+    normalize_log_mel(features.data);
 
     return features;
 }
@@ -443,7 +363,11 @@ std::vector<float> WhisperFeatures::get_data_with_offset(const size_t frame_offs
 
 WhisperFeatureExtractor::WhisperFeatureExtractor(const std::filesystem::path& preprocessor_json_path) {
     init_parameters(preprocessor_json_path);
-    fill_sin_cos_table(sin_vals, cos_vals, n_fft);
+    fft_plan = RealFFT(n_fft);
+    // Hanning window (Use cosf to eliminate difference)
+    // ref: https://pytorch.org/docs/stable/generated/torch.hann_window.html
+    // ref: https://github.com/openai/whisper/blob/main/whisper/audio.py#L147
+    hann_window(n_fft, true, hann);
     init_mel_filter();
 }
 
@@ -478,6 +402,21 @@ void WhisperFeatureExtractor::init_mel_filter() {
             mel_filter[col * mel_data.size() + row] = mel_data[row][col];
         }
     }
+
+    // bins outside of [first, last] nonzero weights of a filter are skipped by the spectrogram computation
+    const size_t num_bins = mel_data.size();
+    mel_filter_ranges.assign(feature_size, {0, 0});
+    for (size_t col = 0; col < feature_size; col++) {
+        const float* filter = mel_filter.data() + col * num_bins;
+        size_t begin = 0, end = num_bins;
+        while (begin < end && filter[begin] == 0.f) {
+            begin++;
+        }
+        while (end > begin && filter[end - 1] == 0.f) {
+            end--;
+        }
+        mel_filter_ranges[col] = {begin, end};
+    }
 }
 
 WhisperFeatures WhisperFeatureExtractor::extract(const std::vector<float>& raw_speech) {
@@ -485,12 +424,129 @@ WhisperFeatures WhisperFeatureExtractor::extract(const std::vector<float>& raw_s
     return mel_spectrogram_convert_audio(raw_speech,
                                          sampling_rate,
                                          feature_size,
-                                         n_fft,
                                          hop_length,
                                          n_threads,
+                                         hann,
+                                         fft_plan,
                                          mel_filter,
-                                         sin_vals,
-                                         cos_vals);
+                                         mel_filter_ranges);
+}
+
+void WhisperFeatureExtractor::extract_log_mel_frames(const float* samples,
+                                                     size_t num_samples,
+                                                     size_t num_frames,
+                                                     std::vector<float>& output) const {
+    std::vector<float> fft_in(n_fft, 0.0);
+    std::vector<std::complex<float>> fft_out(n_fft / 2 + 1);
+    std::vector<std::complex<float>> fft_work(fft_plan.get_work_size());
+
+    const size_t output_offset = output.size();
+    output.resize(output_offset + num_frames * feature_size);
+    for (size_t i = 0; i < num_frames; i++) {
+        const size_t offset = i * hop_length;
+        log_mel_frame(samples + std::min(offset, num_samples),
+                      static_cast<int>(num_samples) - static_cast<int>(offset),
+                      hann,
+                      fft_plan,
+                      mel_filter,
+                      mel_filter_ranges,
+                      fft_in,
+                      fft_out,
+                      fft_work,
+                      output.data() + output_offset + i * feature_size,
+                      1);
+    }
+}
+
+WhisperStreamingFeatures::WhisperStreamingFeatures(const WhisperFeatureExtractor& feature_extractor)
+    : m_feature_extractor(feature_extractor),
+      m_reflect_pad_size(feature_extractor.n_fft / 2) {}
+
+void WhisperStreamingFeatures::append(const std::vector<float>& raw_speech) {
+    OPENVINO_ASSERT(!m_is_finished, "Audio can't be appended to the finished stream");
+    m_samples.insert(m_samples.end(), raw_speech.begin(), raw_speech.end());
+    m_num_raw_samples += raw_speech.size();
+
+    // the reflect padding in front of the stream needs reflect_pad_size + 1 first samples
+    if (!m_is_padded) {
+        if (m_num_raw_samples <= m_reflect_pad_size) {
+            return;
+        }
+        _pad_front();
+    }
+
+    // only frames which have all their samples are computed until the stream is finished
+    const size_t num_padded_samples = m_reflect_pad_size + m_num_raw_samples;
+    if (num_padded_samples >= m_feature_extractor.n_fft) {
+        _compute_frames((num_padded_samples - m_feature_extractor.n_fft) / m_feature_extractor.hop_length + 1);
+    }
+}
+
+void WhisperStreamingFeatures::finish() {
+    if (m_is_finished) {
+        return;
+    }
+    if (!m_is_padded) {
+        _pad_front();
+    }
+    // as WhisperFeatureExtractor::extract() does, the last frames are padded with zeros rather than reflected samples
+    _compute_frames((m_reflect_pad_size + m_num_raw_samples) / m_feature_extractor.hop_length + 1);
+    m_is_finished = true;
+}
+
+void WhisperStreamingFeatures::drop_frames(size_t frame) {
+    OPENVINO_ASSERT(frame <= m_num_frames, "Frame ", frame, " hasn't been computed yet");
+    if (frame <= m_first_frame) {
+        return;
+    }
+    m_frames.erase(m_frames.begin(), m_frames.begin() + (frame - m_first_frame) * m_feature_extractor.feature_size);
+    m_first_frame = frame;
+}
+
+std::vector<float> WhisperStreamingFeatures::get_window(size_t first_frame) const {
+    OPENVINO_ASSERT(first_frame >= m_first_frame, "Frame ", first_frame, " has been dropped");
+    const size_t feature_size = m_feature_extractor.feature_size;
+    const size_t nb_max_frames = m_feature_extractor.nb_max_frames;
+    const size_t num_frames = std::min(m_num_frames - std::min(first_frame, m_num_frames), nb_max_frames);
+
+    // frames past the received audio are silence, as the audio shorter than 30s is padded with zeros
+    std::vector<float> window(feature_size * nb_max_frames, static_cast<float>(log10(1e-10)));
+    const float* frames = m_frames.data() + (first_frame - m_first_frame) * feature_size;
+    for (size_t i = 0; i < num_frames; i++) {
+        for (size_t j = 0; j < feature_size; j++) {
+            window[j * nb_max_frames + i] = frames[i * feature_size + j];
+        }
+    }
+    normalize_log_mel(window);
+    return window;
+}
+
+void WhisperStreamingFeatures::_pad_front() {
+    std::vector<float> padding(m_reflect_pad_size, 0.f);
+    for (size_t i = 0; i < m_reflect_pad_size; i++) {
+        const size_t sample = m_reflect_pad_size - i;
+        padding[i] = sample < m_samples.size() ? m_samples[sample] : 0.f;
+    }
+    m_samples.insert(m_samples.begin(), padding.begin(), padding.end());
+    m_is_padded = true;
+}
+
+void WhisperStreamingFeatures::_compute_frames(size_t num_frames) {
+    if (num_frames <= m_num_frames) {
+        return;
+    }
+    const size_t hop_length = m_feature_extractor.hop_length;
+    const size_t offset = m_num_frames * hop_length - m_first_sample;
+    m_feature_extractor.extract_log_mel_frames(m_samples.data() + offset,
+                                               m_samples.size() - offset,
+                                               num_frames - m_num_frames,
+                                               m_frames);
+    m_num_frames = num_frames;
+
+    // samples before the next frame aren't needed anymore
+    const size_t num_consumed = std::min(m_num_frames * hop_length - m_first_sample, m_samples.size());
+    m_samples.erase(m_samples.begin(), m_samples.begin() + num_consumed);
+    m_first_sample += num_consumed;
 }
 
 }  // namespace genai
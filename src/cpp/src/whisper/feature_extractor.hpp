@@ -4,9 +4,11 @@
 #pragma once
 
 #include <filesystem>
+#include <utility>
 #include <vector>
 
 #include "openvino/genai/visibility.hpp"
+#include "whisper/fft.hpp"
 
 namespace ov {
 namespace genai {
@@ -56,14 +58,85 @@ public:
      */
     WhisperFeatures extract(const std::vector<float>& raw_speech);
 
+    /**
+     * @brief Compute log10 mel energies of consecutive STFT frames, before the clamping and normalization done by
+     * extract()
+     *
+     * @param samples padded samples, frame i covers samples [i * hop_length, i * hop_length + n_fft)
+     * @param num_samples number of samples, the missing samples of the last frames are zeros
+     * @param num_frames number of frames to compute
+     * @param output flattened 2d array with shape [n_frames, feature_size] to append the frames to
+     */
+    void extract_log_mel_frames(const float* samples,
+                                size_t num_samples,
+                                size_t num_frames,
+                                std::vector<float>& output) const;
+
 private:
-    std::vector<float> sin_vals;
-    std::vector<float> cos_vals;
+    RealFFT fft_plan;
+    std::vector<float> hann;
+    // flattened 2d array with shape [feature_size, n_fft / 2 + 1]
     std::vector<float> mel_filter;
+    // [first, last + 1) nonzero bins of each mel filter
+    std::vector<std::pair<size_t, size_t>> mel_filter_ranges;
 
     void init_mel_filter();
     void init_parameters(const std::filesystem::path& preprocessor_json_path);
 };
 
+/**
+ * @brief Log-mel spectrogram of an audio stream computed incrementally: appended samples produce only the STFT frames
+ * they complete. Frames are kept until they are dropped, so that overlapping windows of the stream are taken without
+ * processing the audio again. Frames match the ones extract() computes for the whole audio, windows are clamped and
+ * normalized as extract() does for audio of up to 30s.
+ */
+class WhisperStreamingFeatures {
+public:
+    explicit WhisperStreamingFeatures(const WhisperFeatureExtractor& feature_extractor);
+
+    void append(const std::vector<float>& raw_speech);
+
+    /**
+     * Computes the frames which cover the end of the stream, no audio can be appended after that.
+     */
+    void finish();
+
+    /**
+     * @return number of frames computed since the start of the stream
+     */
+    size_t get_num_frames() const {
+        return m_num_frames;
+    }
+
+    /**
+     * Releases frames before a given one, windows can't start before it after that.
+     */
+    void drop_frames(size_t frame);
+
+    /**
+     * @return flattened 2d array with shape [feature_size, nb_max_frames] of frames starting from a given one, padded
+     * with silence past the computed frames
+     */
+    std::vector<float> get_window(size_t first_frame) const;
+
+private:
+    const WhisperFeatureExtractor& m_feature_extractor;
+    size_t m_reflect_pad_size;
+    bool m_is_padded = false;
+    bool m_is_finished = false;
+    size_t m_num_raw_samples = 0;
+    // samples of the stream preceded by the reflect padding, which aren't consumed by the computed frames
+    std::vector<float> m_samples;
+    // index of m_samples[0] in the padded stream
+    size_t m_first_sample = 0;
+    // flattened 2d array with shape [n_frames, feature_size] of frames starting from m_first_frame
+    std::vector<float> m_frames;
+    size_t m_first_frame = 0;
+    size_t m_num_frames = 0;
+
+    void _pad_front();
+    void _compute_frames(size_t num_frames);
+};
+
 }  // namespace genai
 }  // namespace ov
@@ -0,0 +1,176 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifdef _WIN32
+#    define _USE_MATH_DEFINES
+#endif
+
+#include "whisper/fft.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+using Complex = std::complex<float>;
+
+// w_length^index
+Complex root_of_unity(size_t index, size_t length) {
+    const double angle = -2.0 * M_PI * static_cast<double>(index) / static_cast<double>(length);
+    return Complex(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+}
+
+// std::complex multiplication handles inf and nan operands with a slow library call
+inline Complex mul(const Complex& a, const Complex& b) {
+    return Complex(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+}
+
+// a * (-i)
+inline Complex mul_neg_i(const Complex& a) {
+    return Complex(a.imag(), -a.real());
+}
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+RealFFT::RealFFT(size_t size) : m_size(size) {
+    OPENVINO_ASSERT(size > 0, "Real FFT size must be positive");
+    // there is no split step for odd sizes, the input is transformed as a complex sequence of the same size
+    m_length = size % 2 == 0 ? size / 2 : size;
+
+    // radix 4 stages are the cheapest per element, the rest of the factors go in ascending order
+    std::vector<size_t> radices;
+    size_t rest = m_length;
+    while (rest % 4 == 0) {
+        radices.push_back(4);
+        rest /= 4;
+    }
+    for (size_t radix = 2; rest > 1; radix++) {
+        while (rest % radix == 0) {
+            radices.push_back(radix);
+            rest /= radix;
+        }
+    }
+
+    size_t length = m_length, stride = 1;
+    for (size_t radix : radices) {
+        Stage stage{radix, length, stride, {}, {}};
+        const size_t num_groups = length / radix;
+        stage.twiddles.resize(num_groups * (radix - 1));
+        for (size_t p = 0; p < num_groups; p++) {
+            for (size_t k = 1; k < radix; k++) {
+                stage.twiddles[p * (radix - 1) + k - 1] = root_of_unity(p * k, length);
+            }
+        }
+        if (radix != 2 && radix != 4) {
+            for (size_t j = 0; j < radix; j++) {
+                stage.roots.push_back(root_of_unity(j, radix));
+            }
+        }
+        m_stages.push_back(std::move(stage));
+        length = num_groups;
+        stride *= radix;
+    }
+
+    if (size % 2 == 0) {
+        for (size_t k = 0; k <= size / 4; k++) {
+            m_split_twiddles.push_back(root_of_unity(k, size));
+        }
+    }
+}
+
+// A stage splits each of the stride interleaved sequences x[q + stride * i] of the given length into radix sequences
+// of length / radix: y[q + stride * (radix * p + k)] = w_length^(p * k) * sum_j x[q + stride * (p + j * length / radix)]
+// * w_radix^(j * k), the next stage transforms them as stride * radix interleaved sequences. The output of the last
+// stage is in natural order.
+void RealFFT::_run_stage(const Stage& stage, const Complex* x, Complex* y) {
+    const size_t radix = stage.radix, s = stage.stride, m = stage.length / radix;
+    const Complex* twiddles = stage.twiddles.data();
+
+    if (radix == 2) {
+        for (size_t p = 0; p < m; p++) {
+            const Complex w = twiddles[p];
+            for (size_t q = 0; q < s; q++) {
+                const Complex a = x[q + s * p], b = x[q + s * (p + m)];
+                y[q + s * (2 * p)] = a + b;
+                y[q + s * (2 * p + 1)] = mul(a - b, w);
+            }
+        }
+    } else if (radix == 4) {
+        for (size_t p = 0; p < m; p++) {
+            const Complex w1 = twiddles[3 * p], w2 = twiddles[3 * p + 1], w3 = twiddles[3 * p + 2];
+            for (size_t q = 0; q < s; q++) {
+                const Complex a0 = x[q + s * p], a1 = x[q + s * (p + m)];
+                const Complex a2 = x[q + s * (p + 2 * m)], a3 = x[q + s * (p + 3 * m)];
+                const Complex t0 = a0 + a2, t1 = a0 - a2, t2 = a1 + a3, t3 = mul_neg_i(a1 - a3);
+                y[q + s * (4 * p)] = t0 + t2;
+                y[q + s * (4 * p + 1)] = mul(t1 + t3, w1);
+                y[q + s * (4 * p + 2)] = mul(t0 - t2, w2);
+                y[q + s * (4 * p + 3)] = mul(t1 - t3, w3);
+            }
+        }
+    } else {
+        const Complex* roots = stage.roots.data();
+        for (size_t p = 0; p < m; p++) {
+            for (size_t q = 0; q < s; q++) {
+                for (size_t k = 0; k < radix; k++) {
+                    Complex sum = x[q + s * p];
+                    for (size_t j = 1, jk = k; j < radix; j++, jk = (jk + k) % radix) {
+                        sum += mul(x[q + s * (p + j * m)], roots[jk]);
+                    }
+                    y[q + s * (radix * p + k)] = k == 0 ? sum : mul(sum, twiddles[p * (radix - 1) + k - 1]);
+                }
+            }
+        }
+    }
+}
+
+void RealFFT::transform(const float* input, Complex* output, Complex* work) const {
+    if (m_size % 2 != 0) {
+        // output is too short for the intermediate sequences, so the stages alternate the halves of work
+        Complex* x = work;
+        Complex* y = work + m_size;
+        for (size_t i = 0; i < m_size; i++) {
+            x[i] = Complex(input[i], 0.f);
+        }
+        for (const auto& stage : m_stages) {
+            _run_stage(stage, x, y);
+            std::swap(x, y);
+        }
+        std::copy(x, x + m_size / 2 + 1, output);
+        return;
+    }
+
+    const size_t half_size = m_size / 2;
+
+    // stages alternate the buffers, the input goes to the one which makes the last stage write to output
+    Complex* x = m_stages.size() % 2 == 0 ? output : work;
+    Complex* y = x == output ? work : output;
+    for (size_t i = 0; i < half_size; i++) {
+        x[i] = Complex(input[2 * i], input[2 * i + 1]);
+    }
+    for (const auto& stage : m_stages) {
+        _run_stage(stage, x, y);
+        std::swap(x, y);
+    }
+
+    // z = FFT(even samples + i * odd samples) gives the spectrum of the real input:
+    // X[k] = (z[k] + conj(z[n - k])) / 2 - i * w_size^k * (z[k] - conj(z[n - k])) / 2, X[n - k] = conj(X'[k]) where
+    // X'[k] is the same with the sign of the second term flipped
+    const Complex z0 = output[0];
+    output[0] = Complex(z0.real() + z0.imag(), 0.f);
+    output[half_size] = Complex(z0.real() - z0.imag(), 0.f);
+    for (size_t k = 1; k <= half_size / 2; k++) {
+        const Complex z = output[k], z_conj = std::conj(output[half_size - k]);
+        const Complex even = (z + z_conj) * 0.5f;
+        const Complex odd = mul(mul_neg_i(z - z_conj) * 0.5f, m_split_twiddles[k]);
+        output[k] = even + odd;
+        output[half_size - k] = std::conj(even - odd);
+    }
+}
+
+}  // namespace genai
+}  // namespace ov
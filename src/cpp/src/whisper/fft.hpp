@@ -0,0 +1,69 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <complex>
+#include <vector>
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Precomputed plan of a Fast Fourier Transform of real input of a given size. Input of an even size is
+ * transformed as a complex sequence of half the size by an iterative self-sorting (Stockham) mixed-radix FFT with
+ * radix 4 and 2 butterflies and a generic one for odd prime factors (200 = 4 * 2 * 5 * 5 for Whisper's n_fft = 400),
+ * followed by a split step which recovers the spectrum of the real input. Input of an odd size is transformed as
+ * a complex sequence of the same size. Twiddle factors of all stages are computed once by the plan, so transforms
+ * don't allocate and a plan can be shared by threads which use their own buffers.
+ */
+class RealFFT {
+public:
+    RealFFT() = default;
+
+    explicit RealFFT(size_t size);
+
+    size_t get_size() const {
+        return m_size;
+    }
+
+    /**
+     * @return Number of complex values in the work buffer of transform()
+     */
+    size_t get_work_size() const {
+        return m_size % 2 == 0 ? m_size / 2 : 2 * m_size;
+    }
+
+    /**
+     * @brief Compute the first size / 2 + 1 bins of the discrete Fourier transform of real input
+     *
+     * @param input size real samples
+     * @param output size / 2 + 1 complex bins
+     * @param work buffer of get_work_size() complex values
+     */
+    void transform(const float* input, std::complex<float>* output, std::complex<float>* work) const;
+
+private:
+    struct Stage {
+        size_t radix;
+        // length of the sequences transformed by the stage and their stride
+        size_t length;
+        size_t stride;
+        // twiddle factors w_length^(p * k) for k in [1, radix), p in [0, length / radix)
+        std::vector<std::complex<float>> twiddles;
+        // w_radix^j for j in [0, radix), set for the generic radix stages only
+        std::vector<std::complex<float>> roots;
+    };
+
+    size_t m_size = 0;
+    // length of the complex sequence transformed by the stages
+    size_t m_length = 0;
+    std::vector<Stage> m_stages;
+    // w_size^k for k in [0, size / 4], used by the split step
+    std::vector<std::complex<float>> m_split_twiddles;
+
+    static void _run_stage(const Stage& stage, const std::complex<float>* x, std::complex<float>* y);
+};
+
+}  // namespace genai
+}  // namespace ov
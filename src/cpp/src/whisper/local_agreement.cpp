@@ -0,0 +1,55 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "whisper/local_agreement.hpp"
+
+#include <algorithm>
+
+namespace {
+
+size_t common_prefix_length(const std::vector<int64_t>& a, const std::vector<int64_t>& b) {
+    return std::mismatch(a.begin(), a.begin() + std::min(a.size(), b.size()), b.begin()).first - a.begin();
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+std::vector<int64_t> LocalAgreement::commit(const std::vector<int64_t>& hypothesis, size_t num_tokens) {
+    num_tokens = std::min(num_tokens, hypothesis.size());
+    const size_t num_stable_tokens = m_stable_tokens.size();
+    const size_t num_agreed_tokens = common_prefix_length(hypothesis, m_stable_tokens);
+    if (num_agreed_tokens < num_stable_tokens) {
+        // the hypothesis revises emitted tokens, its tokens take their places so that the next ones stay aligned
+        const size_t num_replaced_tokens = std::min(num_stable_tokens, hypothesis.size());
+        std::copy(hypothesis.begin() + num_agreed_tokens,
+                  hypothesis.begin() + num_replaced_tokens,
+                  m_stable_tokens.begin() + num_agreed_tokens);
+    }
+    if (num_tokens <= num_stable_tokens) {
+        return {};
+    }
+    m_stable_tokens.assign(hypothesis.begin(), hypothesis.begin() + num_tokens);
+    return std::vector<int64_t>(hypothesis.begin() + num_stable_tokens, hypothesis.begin() + num_tokens);
+}
+
+std::vector<int64_t> LocalAgreement::update(const std::vector<int64_t>& hypothesis) {
+    std::vector<int64_t> stable_tokens = commit(hypothesis, common_prefix_length(hypothesis, m_hypothesis));
+    m_hypothesis = hypothesis;
+    return stable_tokens;
+}
+
+std::vector<int64_t> LocalAgreement::get_partial_tokens() const {
+    return std::vector<int64_t>(m_hypothesis.begin() + std::min(m_stable_tokens.size(), m_hypothesis.size()),
+                                m_hypothesis.end());
+}
+
+void LocalAgreement::advance(size_t num_tokens) {
+    m_stable_tokens.erase(m_stable_tokens.begin(),
+                          m_stable_tokens.begin() + std::min(num_tokens, m_stable_tokens.size()));
+    m_hypothesis.erase(m_hypothesis.begin(), m_hypothesis.begin() + std::min(num_tokens, m_hypothesis.size()));
+}
+
+}  // namespace genai
+}  // namespace ov
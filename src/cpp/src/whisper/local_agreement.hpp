@@ -0,0 +1,53 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Tokens of a streaming window which become stable once two consecutive hypotheses agree on them (local
+ * agreement policy). Stable tokens are emitted once and never revised. A later hypothesis may still transcribe their
+ * audio differently, it is then assumed to take as many tokens for it, so that only its tokens past the stable ones
+ * are emitted and no text is lost or repeated when the window start moves past the committed audio.
+ */
+class LocalAgreement {
+public:
+    /**
+     * @brief Commits the first num_tokens tokens of the hypothesis.
+     * @return tokens which became stable
+     */
+    std::vector<int64_t> commit(const std::vector<int64_t>& hypothesis, size_t num_tokens);
+
+    /**
+     * @brief Commits the tokens on which the hypothesis agrees with the previous one and keeps it for the next call.
+     * @return tokens which became stable
+     */
+    std::vector<int64_t> update(const std::vector<int64_t>& hypothesis);
+
+    /**
+     * @return tokens of the latest hypothesis which aren't stable yet
+     */
+    std::vector<int64_t> get_partial_tokens() const;
+
+    size_t get_num_stable_tokens() const {
+        return m_stable_tokens.size();
+    }
+
+    /**
+     * @brief Drops the first num_tokens tokens when the window start moves past their audio.
+     */
+    void advance(size_t num_tokens);
+
+private:
+    std::vector<int64_t> m_stable_tokens;
+    std::vector<int64_t> m_hypothesis;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -43,13 +43,24 @@ std::pair<int64_t, float> WhisperDecoder::detect_language(const ov::Tensor& enco
 }
 
 /**
- * Encoder hidden states expected to be with batch 1
+ * Encoder hidden states expected to be with batch 1 or with the requested batch_size
  * Expand encoder hidden state tensor from batch 1 to requested batch_size.
  * Set new encoder hidden states tensor to infer request.
  */
 void WhisperDecoder::_set_encoder_hidden_states_tensor(const Tensor& encoder_hidden_state,
                                                        const size_t batch_size,
                                                        InferRequest& request) {
+    // hidden states are given for each sequence, e.g. for a batch of audio inputs
+    if (encoder_hidden_state.get_shape().at(0) > 1) {
+        OPENVINO_ASSERT(encoder_hidden_state.get_shape().at(0) == batch_size,
+                        "Encoder hidden states batch size ",
+                        encoder_hidden_state.get_shape().at(0),
+                        " doesn't match the decoder batch size ",
+                        batch_size);
+        request.set_tensor("encoder_hidden_states", encoder_hidden_state);
+        return;
+    }
+
     const size_t current_batch_size = request.get_tensor("encoder_hidden_states").get_shape().at(0);
     // batch hasn't changed, skip
     if (current_batch_size == batch_size) {
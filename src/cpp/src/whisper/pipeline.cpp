@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <filesystem>
 #include <openvino/openvino.hpp>
+#include <optional>
 #include <variant>
 
 #include "openvino/genai/text_streamer.hpp"
@@ -113,15 +114,7 @@ public:
                                    OptionalWhisperGenerationConfig generation_config,
                                    const std::shared_ptr<StreamerBase> streamer) override {
         auto start_time = std::chrono::steady_clock::now();
-        WhisperGenerationConfig config = (generation_config.has_value()) ? *generation_config : m_generation_config;
-
-        // If stop_token_ids were not provided, take value from default m_generation_config
-        if (config.stop_token_ids.empty())
-            config.stop_token_ids = m_generation_config.stop_token_ids;
-        // If eos_token_id was not provided, take value from default m_generation_config
-        if (config.eos_token_id == -1)
-            config.set_eos_token_id(m_generation_config.eos_token_id);
-        config.validate();
+        WhisperGenerationConfig config = resolve_generation_config(generation_config);
 
         auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
 
@@ -135,6 +128,96 @@ public:
                                                            streamer,
                                                            m_sampler,
                                                            m_tokenizer);
+        WhisperDecodedResults result = decode_generate_result(generate_result);
+        result.perf_metrics.raw_metrics.tokenization_durations.emplace_back(tokenization_duration_microseconds);
+
+        auto& metrics = result.perf_metrics;
+        metrics.load_time = this->m_load_time_ms;
+        auto stop_time = std::chrono::steady_clock::now();
+        metrics.raw_metrics.generate_durations.emplace_back(PerfMetrics::get_microsec(stop_time - start_time));
+        metrics.evaluate_statistics(start_time);
+
+        return result;
+    }
+
+    std::vector<WhisperDecodedResults> generate(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                               OptionalWhisperGenerationConfig generation_config) override {
+        auto start_time = std::chrono::steady_clock::now();
+        WhisperGenerationConfig config = resolve_generation_config(generation_config);
+
+        auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
+
+        auto generate_results = ov::genai::whisper_generate_batch(config,
+                                                                  m_model_config,
+                                                                  context_tokens,
+                                                                  raw_speech_inputs,
+                                                                  m_encoder,
+                                                                  m_decoder,
+                                                                  m_feature_extractor,
+                                                                  m_sampler);
+        const auto generate_duration = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - start_time);
+
+        std::vector<WhisperDecodedResults> results;
+        results.reserve(generate_results.size());
+        for (auto& generate_result : generate_results) {
+            WhisperDecodedResults result = decode_generate_result(generate_result);
+            auto& metrics = result.perf_metrics;
+            metrics.raw_metrics.tokenization_durations.emplace_back(tokenization_duration_microseconds);
+            metrics.load_time = this->m_load_time_ms;
+            // inputs are transcribed together, so each of them takes the whole batch time
+            metrics.raw_metrics.generate_durations.emplace_back(generate_duration);
+            metrics.evaluate_statistics(start_time);
+            results.push_back(std::move(result));
+        }
+        return results;
+    }
+
+    void start_stream(OptionalWhisperGenerationConfig generation_config,
+                      const WhisperStreamingConfig& streaming_config) override {
+        WhisperGenerationConfig config = resolve_generation_config(generation_config);
+        auto context_tokens = prepare_context_tokens(config, m_tokenizer).first;
+        m_stream.emplace(config,
+                         streaming_config,
+                         m_model_config,
+                         context_tokens,
+                         m_encoder,
+                         m_decoder,
+                         m_feature_extractor,
+                         m_sampler);
+    }
+
+    WhisperStreamingResult push_audio(const RawSpeechInput& raw_speech_input) override {
+        OPENVINO_ASSERT(m_stream.has_value(), "Audio stream is not started, call start_stream() first");
+        return decode_streaming_step(m_stream->push(raw_speech_input));
+    }
+
+    WhisperStreamingResult finish_stream() override {
+        OPENVINO_ASSERT(m_stream.has_value(), "Audio stream is not started, call start_stream() first");
+        WhisperStreamingResult result = decode_streaming_step(m_stream->finish());
+        m_stream.reset();
+        return result;
+    }
+
+private:
+    ov::InferRequest m_encoder;
+    std::shared_ptr<ov::genai::WhisperDecoder> m_decoder;
+    Sampler m_sampler;
+    std::optional<WhisperStreamingTranscriber> m_stream;
+
+    WhisperGenerationConfig resolve_generation_config(const OptionalWhisperGenerationConfig& generation_config) const {
+        WhisperGenerationConfig config = (generation_config.has_value()) ? *generation_config : m_generation_config;
+
+        // If stop_token_ids were not provided, take value from default m_generation_config
+        if (config.stop_token_ids.empty())
+            config.stop_token_ids = m_generation_config.stop_token_ids;
+        // If eos_token_id was not provided, take value from default m_generation_config
+        if (config.eos_token_id == -1)
+            config.set_eos_token_id(m_generation_config.eos_token_id);
+        config.validate();
+        return config;
+    }
+
+    WhisperDecodedResults decode_generate_result(WhisperGenerateResult& generate_result) {
         auto decode_start_time = std::chrono::steady_clock::now();
         WhisperDecodedResults result{std::vector{m_tokenizer.decode(generate_result.output_tokens)}, std::vector{1.f}};
         generate_result.perf_metrics.raw_metrics.detokenization_durations.emplace_back(
@@ -143,7 +226,6 @@ public:
         result.words = generate_result.words;
 
         result.perf_metrics = generate_result.perf_metrics;
-        result.perf_metrics.raw_metrics.tokenization_durations.emplace_back(tokenization_duration_microseconds);
         auto& segments = generate_result.segments;
 
         if (segments.has_value()) {
@@ -161,19 +243,19 @@ public:
             result.chunks = chunks;
         }
 
-        auto& metrics = result.perf_metrics;
-        metrics.load_time = this->m_load_time_ms;
-        auto stop_time = std::chrono::steady_clock::now();
-        metrics.raw_metrics.generate_durations.emplace_back(PerfMetrics::get_microsec(stop_time - start_time));
-        metrics.evaluate_statistics(start_time);
-
         return result;
     }
 
-private:
-    ov::InferRequest m_encoder;
-    std::shared_ptr<ov::genai::WhisperDecoder> m_decoder;
-    Sampler m_sampler;
+    WhisperStreamingResult decode_streaming_step(const WhisperStreamingStep& step) {
+        WhisperStreamingResult result;
+        if (!step.stable_tokens.empty()) {
+            result.stable_text = m_tokenizer.decode(step.stable_tokens);
+        }
+        if (!step.partial_tokens.empty()) {
+            result.partial_text = m_tokenizer.decode(step.partial_tokens);
+        }
+        return result;
+    }
 };
 
 std::pair<std::string, Any> generation_config(const WhisperGenerationConfig& config) {
@@ -221,6 +303,25 @@ ov::genai::WhisperDecodedResults ov::genai::WhisperPipeline::generate(const RawS
     return m_impl->generate(raw_speech_input, config, base_streamer);
 }
 
+std::vector<ov::genai::WhisperDecodedResults> ov::genai::WhisperPipeline::generate(
+    const std::vector<RawSpeechInput>& raw_speech_inputs,
+    OptionalWhisperGenerationConfig generation_config) {
+    return m_impl->generate(raw_speech_inputs, generation_config);
+}
+
+void ov::genai::WhisperPipeline::start_stream(OptionalWhisperGenerationConfig generation_config,
+                                              const WhisperStreamingConfig& streaming_config) {
+    m_impl->start_stream(generation_config, streaming_config);
+}
+
+ov::genai::WhisperStreamingResult ov::genai::WhisperPipeline::push_audio(const RawSpeechInput& raw_speech_input) {
+    return m_impl->push_audio(raw_speech_input);
+}
+
+ov::genai::WhisperStreamingResult ov::genai::WhisperPipeline::finish_stream() {
+    return m_impl->finish_stream();
+}
+
 ov::genai::WhisperGenerationConfig ov::genai::WhisperPipeline::get_generation_config() const {
     return m_impl->m_generation_config;
 }
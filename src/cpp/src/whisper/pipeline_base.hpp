@@ -30,6 +30,29 @@ public:
                                            OptionalWhisperGenerationConfig generation_config,
                                            const std::shared_ptr<StreamerBase> streamer) = 0;
 
+    virtual std::vector<WhisperDecodedResults> generate(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                       OptionalWhisperGenerationConfig generation_config) {
+        std::vector<WhisperDecodedResults> results;
+        results.reserve(raw_speech_inputs.size());
+        for (const auto& raw_speech_input : raw_speech_inputs) {
+            results.push_back(generate(raw_speech_input, generation_config, nullptr));
+        }
+        return results;
+    }
+
+    virtual void start_stream(OptionalWhisperGenerationConfig generation_config,
+                              const WhisperStreamingConfig& streaming_config) {
+        OPENVINO_THROW("Audio streams are supported by the stateful Whisper pipeline only");
+    }
+
+    virtual WhisperStreamingResult push_audio(const RawSpeechInput& raw_speech_input) {
+        OPENVINO_THROW("Audio streams are supported by the stateful Whisper pipeline only");
+    }
+
+    virtual WhisperStreamingResult finish_stream() {
+        OPENVINO_THROW("Audio streams are supported by the stateful Whisper pipeline only");
+    }
+
     virtual ~WhisperPipelineImplBase() = default;
 };
 
@@ -3,7 +3,11 @@
 
 #include "whisper.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <numeric>
 #include <openvino/openvino.hpp>
 #include <thread>
 
@@ -27,11 +31,14 @@ using ov::genai::MicroSeconds;
 
 namespace {
 
+// forced_tokens are the first output tokens passed to the decoder as a part of its input, they are processed as if
+// they were generated
 void process_whisper_logits(ov::Tensor logits,
                             const ov::genai::WhisperGenerationConfig& config,
                             const bool return_timestamps,
-                            const std::map<size_t, std::vector<int64_t>>& batch_to_generated_ids) {
-    const bool initial_step = batch_to_generated_ids.empty();
+                            const std::map<size_t, std::vector<int64_t>>& batch_to_generated_ids,
+                            const std::vector<int64_t>& forced_tokens = {}) {
+    const bool initial_step = batch_to_generated_ids.empty() && forced_tokens.empty();
     const size_t batch_size = logits.get_shape().at(0);
 
     for (size_t batch = 0; batch < batch_size; batch++) {
@@ -42,12 +49,17 @@ void process_whisper_logits(ov::Tensor logits,
         ov::genai::do_suppress_tokens(logits, batch, config.suppress_tokens);
 
         if (return_timestamps) {
-            const auto& generated_ids = initial_step ? std::vector<int64_t>{} : batch_to_generated_ids.at(batch);
+            std::vector<int64_t> generated_ids = forced_tokens;
+            if (!batch_to_generated_ids.empty()) {
+                const auto& batch_generated_ids = batch_to_generated_ids.at(batch);
+                generated_ids.insert(generated_ids.end(), batch_generated_ids.begin(), batch_generated_ids.end());
+            }
             ov::genai::process_whisper_timestamp_logits(logits, batch, config, generated_ids, initial_step);
         }
     }
 }
 
+// input_ids end with forced_tokens, the first output tokens known in advance, which aren't returned as generated ones
 std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::WhisperDecoder> decoder,
                                                   const std::vector<int64_t>& input_ids,
                                                   const ov::Tensor& encoder_hidden_state,
@@ -56,7 +68,8 @@ std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::Whi
                                                   ov::genai::SequenceGroup::Ptr sequence_group,
                                                   const bool return_timestamps,
                                                   const ov::genai::WhisperGenerationConfig& config,
-                                                  ov::genai::RawPerfMetrics& raw_metrics) {
+                                                  ov::genai::RawPerfMetrics& raw_metrics,
+                                                  const std::vector<int64_t>& forced_tokens = {}) {
     const auto handle = std::make_shared<ov::genai::GenerationHandleImpl>(sequence_group->get_generation_stream(),
                                                                           sequence_group->get_sampling_parameters());
 
@@ -92,7 +105,7 @@ std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::Whi
     raw_metrics.m_new_token_times.emplace_back(infer_end);
     raw_metrics.m_batch_sizes.emplace_back(batch_size);
 
-    process_whisper_logits(logits, config, return_timestamps, {});
+    process_whisper_logits(logits, config, return_timestamps, {}, forced_tokens);
 
     // sample last token only
     int64_t output_sequence_len = logits.get_shape().at(1);
@@ -164,7 +177,7 @@ std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::Whi
         raw_metrics.m_new_token_times.emplace_back(infer_end);
         raw_metrics.m_batch_sizes.emplace_back(total_num_tokens);
 
-        process_whisper_logits(logits, config, return_timestamps, batch_to_generated_ids);
+        process_whisper_logits(logits, config, return_timestamps, batch_to_generated_ids, forced_tokens);
 
         sampler.sample({sequence_group}, logits);
     }
@@ -196,7 +209,8 @@ ov::Tensor encode(ov::InferRequest& request,
                   const size_t feature_size,
                   const size_t nb_max_frames,
                   ov::genai::RawPerfMetrics& raw_metrics) {
-    OPENVINO_ASSERT(mel_data.size() == feature_size * nb_max_frames,
+    // a batch of chunks is encoded at once if mel_data has several of them
+    OPENVINO_ASSERT(!mel_data.empty() && mel_data.size() % (feature_size * nb_max_frames) == 0,
                     "Mel spectrogram required size: ",
                     feature_size,
                     " * ",
@@ -204,7 +218,8 @@ ov::Tensor encode(ov::InferRequest& request,
                     ". Actual size: ",
                     mel_data.size(),
                     ".");
-    ov::Tensor input_tensor(ov::element::f32, {1, feature_size, nb_max_frames}, mel_data.data());
+    const size_t num_chunks = mel_data.size() / (feature_size * nb_max_frames);
+    ov::Tensor input_tensor(ov::element::f32, {num_chunks, feature_size, nb_max_frames}, mel_data.data());
 
     request.set_tensor("input_features", input_tensor);
 
@@ -222,6 +237,23 @@ ov::Tensor encode(ov::InferRequest& request,
     return request.get_tensor("last_hidden_state");
 }
 
+int64_t get_language_token_id(const ov::genai::WhisperGenerationConfig& config) {
+    std::string language = *config.language;
+    if (config.lang_to_id.count(language)) {
+        return config.lang_to_id.at(language);
+    }
+    return 0;
+}
+
+std::vector<int64_t> get_sot_tokens(const ov::genai::WhisperGenerationConfig& config, const int64_t language_token_id) {
+    int64_t task_token_id = config.transcribe_token_id;
+    if (config.task.has_value() && *config.task == "translate") {
+        task_token_id = config.translate_token_id;
+    }
+
+    return std::vector<int64_t>{config.decoder_start_token_id, language_token_id, task_token_id};
+}
+
 std::vector<int64_t> prepare_sot_tokens(ov::Tensor& encoder_hidden_state,
                                         std::shared_ptr<ov::genai::WhisperDecoder> decoder,
                                         const ov::genai::WhisperGenerationConfig& config,
@@ -232,22 +264,231 @@ std::vector<int64_t> prepare_sot_tokens(ov::Tensor& encoder_hidden_state,
 
     int64_t language_token_id = 0;
     if (config.language.has_value()) {
-        std::string language = *config.language;
-        if (config.lang_to_id.count(language)) {
-            language_token_id = config.lang_to_id.at(language);
-        }
+        language_token_id = get_language_token_id(config);
     } else {
         auto [language_token, infer_ms] = decoder->detect_language(encoder_hidden_state, config.decoder_start_token_id);
         language_token_id = language_token;
         raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
     }
 
-    int64_t task_token_id = config.transcribe_token_id;
-    if (config.task.has_value() && *config.task == "translate") {
-        task_token_id = config.translate_token_id;
+    return get_sot_tokens(config, language_token_id);
+}
+
+// encodes a batch of chunks, with an encoder compiled for a static batch (NPU) the chunks are encoded one by one
+ov::Tensor encode_batch(ov::InferRequest& request,
+                        std::vector<std::vector<float>>& chunks,
+                        const size_t feature_size,
+                        const size_t nb_max_frames,
+                        ov::genai::RawPerfMetrics& raw_metrics) {
+    const bool is_batch_static =
+        request.get_compiled_model().input("input_features").get_partial_shape()[0].is_static();
+
+    // the encoder output is copied to a host tensor, since the next chunks overwrite it
+    ov::Tensor hidden_states;
+    if (!is_batch_static) {
+        std::vector<float> mel_data;
+        mel_data.reserve(chunks.size() * feature_size * nb_max_frames);
+        for (const auto& chunk : chunks) {
+            mel_data.insert(mel_data.end(), chunk.begin(), chunk.end());
+        }
+        ov::Tensor hidden_state = encode(request, mel_data, feature_size, nb_max_frames, raw_metrics);
+        hidden_states = ov::Tensor(hidden_state.get_element_type(), hidden_state.get_shape());
+        hidden_state.copy_to(hidden_states);
+        return hidden_states;
     }
 
-    return std::vector<int64_t>{config.decoder_start_token_id, language_token_id, task_token_id};
+    for (size_t i = 0; i < chunks.size(); i++) {
+        ov::Tensor hidden_state = encode(request, chunks[i], feature_size, nb_max_frames, raw_metrics);
+        ov::Shape shape = hidden_state.get_shape();
+        if (!hidden_states) {
+            shape[0] = chunks.size();
+            hidden_states = ov::Tensor(hidden_state.get_element_type(), shape);
+        }
+        ov::Coordinate begin(shape.size(), 0), end(shape);
+        begin[0] = i;
+        end[0] = i + 1;
+        ov::Tensor row(hidden_states, begin, end);
+        hidden_state.copy_to(row);
+    }
+    return hidden_states;
+}
+
+// hidden states for the rows of a decoder batch, row i gets the hidden state of the chunk rows[i]
+ov::Tensor gather_hidden_states(const ov::Tensor& hidden_states, const std::vector<size_t>& rows) {
+    ov::Shape shape = hidden_states.get_shape();
+    const size_t row_size = hidden_states.get_byte_size() / shape[0];
+    shape[0] = rows.size();
+    ov::Tensor gathered(hidden_states.get_element_type(), shape);
+
+    const auto* src = static_cast<const uint8_t*>(hidden_states.data());
+    auto* dst = static_cast<uint8_t*>(gathered.data());
+    for (size_t i = 0; i < rows.size(); i++) {
+        std::memcpy(dst + i * row_size, src + rows[i] * row_size, row_size);
+    }
+    return gathered;
+}
+
+std::vector<int64_t> detect_languages(std::shared_ptr<ov::genai::WhisperDecoder> decoder,
+                                      const ov::Tensor& encoder_hidden_states,
+                                      const int64_t decoder_start_token_id,
+                                      ov::genai::RawPerfMetrics& raw_metrics) {
+    const size_t batch_size = encoder_hidden_states.get_shape().at(0);
+
+    ov::Tensor input_ids = decoder->create_host_tensor(ov::element::i64, {batch_size, 1});
+    std::fill_n(input_ids.data<int64_t>(), batch_size, decoder_start_token_id);
+    ov::Tensor beam_idx = decoder->create_host_tensor(ov::element::i32, {batch_size});
+    std::iota(beam_idx.data<int32_t>(), beam_idx.data<int32_t>() + batch_size, 0);
+
+    const auto infer_start = std::chrono::steady_clock::now();
+    decoder->start_async(encoder_hidden_states, input_ids, beam_idx);
+    auto logits = decoder->wait();
+    raw_metrics.m_inference_durations[0] +=
+        MicroSeconds(ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start));
+
+    std::vector<int64_t> language_token_ids(batch_size);
+    for (size_t batch = 0; batch < batch_size; batch++) {
+        language_token_ids[batch] = ov::genai::utils::argmax(logits, batch);
+    }
+    decoder->reset_state();
+    return language_token_ids;
+}
+
+// Decodes chunks of several audio inputs in one batch, a sequence group per chunk. The groups must have prompts of
+// the same length, since the rows of the batch share the KV cache length. Rows of the finished groups drop out of
+// the batch by the beam_idx reorder of the KV cache.
+std::vector<ov::genai::EncodedResults> decode_batch(std::shared_ptr<ov::genai::WhisperDecoder> decoder,
+                                                    const std::vector<ov::genai::SequenceGroup::Ptr>& sequence_groups,
+                                                    const ov::Tensor& encoder_hidden_states,
+                                                    ov::genai::Sampler& sampler,
+                                                    const bool return_timestamps,
+                                                    const ov::genai::WhisperGenerationConfig& config,
+                                                    ov::genai::RawPerfMetrics& raw_metrics) {
+    const size_t batch_size = sequence_groups.size();
+    const size_t prompt_len = sequence_groups.at(0)->get_prompt_len();
+
+    auto infer = [&](const ov::Tensor& hidden_states, const ov::Tensor& input_ids, const ov::Tensor& beam_idx) {
+        const auto infer_start = std::chrono::steady_clock::now();
+        decoder->start_async(hidden_states, input_ids, beam_idx);
+        auto logits = decoder->wait();
+        const auto infer_end = std::chrono::steady_clock::now();
+        const auto infer_ms = ov::genai::PerfMetrics::get_microsec(infer_end - infer_start);
+        raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
+        raw_metrics.m_token_infer_durations.emplace_back(infer_ms);
+        raw_metrics.m_new_token_times.emplace_back(infer_end);
+        raw_metrics.m_batch_sizes.emplace_back(input_ids.get_shape().at(0));
+        return logits;
+    };
+
+    ov::Tensor input_ids = decoder->create_host_tensor(ov::element::i64, {batch_size, prompt_len});
+    for (size_t i = 0; i < batch_size; i++) {
+        const auto& prompt_ids = sequence_groups[i]->get_prompt_ids();
+        OPENVINO_ASSERT(prompt_ids.size() == prompt_len, "Prompts of a decoder batch must have the same length");
+        std::copy(prompt_ids.begin(), prompt_ids.end(), input_ids.data<int64_t>() + i * prompt_len);
+    }
+    ov::Tensor beam_idx = decoder->create_host_tensor(ov::element::i32, {batch_size});
+    std::fill_n(beam_idx.data<int32_t>(), batch_size, 0);
+
+    auto logits = infer(encoder_hidden_states, input_ids, beam_idx);
+    process_whisper_logits(logits, config, return_timestamps, {});
+
+    for (auto& sequence_group : sequence_groups) {
+        sequence_group->schedule_tokens(prompt_len);
+        sequence_group->set_output_seq_len(logits.get_shape().at(1));
+    }
+    sampler.sample(sequence_groups, logits);
+
+    // chunk of each row of the previous inference and the first row of each group in it
+    std::vector<size_t> row_chunks(batch_size), first_rows(batch_size);
+    std::iota(row_chunks.begin(), row_chunks.end(), 0);
+    std::iota(first_rows.begin(), first_rows.end(), 0);
+    ov::Tensor row_hidden_states = encoder_hidden_states;
+
+    std::vector<size_t> active_groups(batch_size);
+    std::iota(active_groups.begin(), active_groups.end(), 0);
+    auto free_finished_groups = [&]() {
+        auto removed_it = std::remove_if(active_groups.begin(), active_groups.end(), [&](size_t i) {
+            const auto& sequence_group = sequence_groups[i];
+            return sequence_group->has_finished() || sequence_group->handle_stopped() ||
+                   sequence_group->handle_cancelled();
+        });
+        active_groups.erase(removed_it, active_groups.end());
+    };
+    free_finished_groups();
+
+    while (!active_groups.empty()) {
+        std::vector<int64_t> next_input_ids;
+        std::vector<int32_t> next_beams;
+        std::vector<size_t> next_row_chunks, next_first_rows(batch_size, 0);
+        std::map<size_t, std::vector<int64_t>> batch_to_generated_ids;
+        std::vector<ov::genai::SequenceGroup::Ptr> running_groups;
+
+        for (size_t i : active_groups) {
+            const auto& sequence_group = sequence_groups[i];
+            sequence_group->schedule_tokens(1);
+            running_groups.push_back(sequence_group);
+
+            std::map<size_t, int32_t> beam_idxs = sampler.get_beam_idxs(sequence_group);
+            next_first_rows[i] = next_beams.size();
+            for (const auto& sequence : sequence_group->get_running_sequences()) {
+                const auto& generated_ids = sequence->get_generated_ids();
+                batch_to_generated_ids[next_beams.size()] = generated_ids;
+                next_input_ids.push_back(generated_ids.back());
+                // beams of each group are numbered from 0, while the KV cache holds the rows of all groups
+                next_beams.push_back(static_cast<int32_t>(first_rows[i]) + beam_idxs[sequence->get_id()]);
+                next_row_chunks.push_back(i);
+            }
+        }
+
+        if (next_row_chunks != row_chunks) {
+            row_hidden_states = gather_hidden_states(encoder_hidden_states, next_row_chunks);
+        }
+        row_chunks = std::move(next_row_chunks);
+        first_rows = std::move(next_first_rows);
+
+        const size_t num_rows = next_beams.size();
+        ov::Tensor new_input_ids = decoder->create_host_tensor(ov::element::i64, {num_rows, 1});
+        std::copy(next_input_ids.begin(), next_input_ids.end(), new_input_ids.data<int64_t>());
+        ov::Tensor new_beam_idx = decoder->create_host_tensor(ov::element::i32, {num_rows});
+        std::copy(next_beams.begin(), next_beams.end(), new_beam_idx.data<int32_t>());
+
+        logits = infer(row_hidden_states, new_input_ids, new_beam_idx);
+        process_whisper_logits(logits, config, return_timestamps, batch_to_generated_ids);
+
+        sampler.sample(running_groups, logits);
+        free_finished_groups();
+    }
+
+    // there is also check in generation config validate function
+    OPENVINO_ASSERT(config.num_return_sequences == 1);
+    std::vector<ov::genai::EncodedResults> results(batch_size);
+    for (size_t i = 0; i < batch_size; i++) {
+        const auto& sequence_group = sequence_groups[i];
+        const auto sampling_params = sequence_group->get_sampling_parameters();
+        const auto& sequence = sequence_group->get_finished_sequences()[0];
+        const float score = sampling_params.is_beam_search() ? sequence->get_beam_search_score(sampling_params)
+                                                             : sequence->get_cumulative_log_prob();
+        results[i].tokens.push_back(sequence->get_generated_ids());
+        results[i].scores.push_back(score);
+        sampler.clear_request_info(sequence_group->get_request_id());
+    }
+    return results;
+}
+
+// tokens of a window transcription up to its num_tokens-th non-timestamp token, including the timestamps of the segments
+// which precede the token
+std::vector<int64_t> get_tokens_prefix(const std::vector<int64_t>& tokens,
+                                       const std::vector<std::pair<size_t, size_t>>& segment_ranges,
+                                       size_t num_tokens) {
+    size_t prefix_length = 0;
+    for (const auto& [segment_start, segment_end] : segment_ranges) {
+        if (num_tokens == 0) {
+            break;
+        }
+        const size_t num_segment_tokens = std::min(num_tokens, segment_end - segment_start);
+        prefix_length = segment_start + num_segment_tokens;
+        num_tokens -= num_segment_tokens;
+    }
+    return std::vector<int64_t>(tokens.begin(), tokens.begin() + prefix_length);
 }
 
 }  // namespace
@@ -406,5 +647,302 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
 
     return result;
 }
+
+std::vector<WhisperGenerateResult> whisper_generate_batch(const ov::genai::WhisperGenerationConfig& config,
+                                                          const ov::genai::WhisperConfig& model_config,
+                                                          const WhisperContextTokens& context_tokens,
+                                                          const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                          ov::InferRequest& encoder,
+                                                          std::shared_ptr<WhisperDecoder> decoder,
+                                                          WhisperFeatureExtractor& feature_extractor,
+                                                          Sampler& sampler) {
+    OPENVINO_ASSERT(!config.word_timestamps, "Word-level timestamps are not supported for a batch of audio inputs");
+
+    RawPerfMetrics raw_metrics;
+    raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+
+    const size_t num_inputs = raw_speech_inputs.size();
+    std::vector<WhisperGenerateResult> results(num_inputs);
+    std::vector<WhisperFeatures> input_features;
+    input_features.reserve(num_inputs);
+    for (size_t i = 0; i < num_inputs; i++) {
+        const auto infer_start = std::chrono::steady_clock::now();
+        input_features.push_back(feature_extractor.extract(raw_speech_inputs[i]));
+        const auto infer_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
+        results[i].perf_metrics.whisper_raw_metrics.features_extraction_durations.emplace_back(infer_ms);
+    }
+
+    // 0.02 by default
+    const float time_precision = static_cast<float>(feature_extractor.chunk_length) / model_config.max_source_positions;
+    OPENVINO_ASSERT(feature_extractor.sampling_rate != 0, "Sampling Rate for Feature Extractor is 0");
+    const float frame_length_in_seconds =
+        static_cast<float>(feature_extractor.hop_length) / feature_extractor.sampling_rate;
+
+    std::vector<size_t> chunk_offsets(num_inputs, 0);
+    std::vector<std::vector<int64_t>> sot_tokens(num_inputs);
+    std::vector<std::vector<Segment>> segments(num_inputs);
+
+    // inputs which have chunks left, the next chunks of all of them are processed in one batch
+    std::vector<size_t> active_inputs(num_inputs);
+    std::iota(active_inputs.begin(), active_inputs.end(), 0);
+
+    while (!active_inputs.empty()) {
+        std::vector<std::vector<float>> chunks;
+        chunks.reserve(active_inputs.size());
+        for (size_t input : active_inputs) {
+            chunks.push_back(
+                input_features[input].get_data_with_offset(chunk_offsets[input], feature_extractor.nb_max_frames));
+        }
+        ov::Tensor hidden_states =
+            encode_batch(encoder, chunks, feature_extractor.feature_size, feature_extractor.nb_max_frames, raw_metrics);
+
+        // prepare sot_tokens just once for each input, languages are detected in one batch
+        if (sot_tokens[active_inputs[0]].empty()) {
+            if (!config.is_multilingual) {
+                std::fill(sot_tokens.begin(), sot_tokens.end(), std::vector<int64_t>{config.decoder_start_token_id});
+            } else if (config.language.has_value()) {
+                std::fill(sot_tokens.begin(), sot_tokens.end(), get_sot_tokens(config, get_language_token_id(config)));
+            } else {
+                const auto language_token_ids =
+                    detect_languages(decoder, hidden_states, config.decoder_start_token_id, raw_metrics);
+                for (size_t i = 0; i < num_inputs; i++) {
+                    sot_tokens[i] = get_sot_tokens(config, language_token_ids[i]);
+                }
+            }
+        }
+
+        // chunks are decoded in one batch if their prompts have the same length and timestamps mode, since the
+        // decoder batch shares the KV cache length and logits processing
+        std::map<std::pair<size_t, bool>, std::vector<size_t>> decoder_batches;
+        std::vector<std::vector<int64_t>> prompts(active_inputs.size());
+        for (size_t chunk = 0; chunk < active_inputs.size(); chunk++) {
+            const size_t input = active_inputs[chunk];
+            // long-form audio processing requires timestamps to be enabled
+            const bool return_timestamps =
+                config.return_timestamps || input_features[input].n_frames > feature_extractor.nb_max_frames;
+
+            prompts[chunk] = ov::genai::get_prompt_tokens(context_tokens, config, chunk_offsets[input]);
+            prompts[chunk].insert(prompts[chunk].end(), sot_tokens[input].begin(), sot_tokens[input].end());
+            if (!return_timestamps) {
+                prompts[chunk].push_back(config.no_timestamps_token_id);
+            }
+            decoder_batches[{prompts[chunk].size(), return_timestamps}].push_back(chunk);
+        }
+
+        for (const auto& [batch_key, batch_chunks] : decoder_batches) {
+            const bool return_timestamps = batch_key.second;
+
+            std::vector<SequenceGroup::Ptr> sequence_groups;
+            for (size_t request_id = 0; request_id < batch_chunks.size(); request_id++) {
+                sequence_groups.push_back(
+                    std::make_shared<SequenceGroup>(request_id, prompts[batch_chunks[request_id]], config, 1));
+            }
+            const ov::Tensor batch_hidden_states = batch_chunks.size() == active_inputs.size()
+                                                       ? hidden_states
+                                                       : gather_hidden_states(hidden_states, batch_chunks);
+
+            auto batch_results =
+                decode_batch(decoder, sequence_groups, batch_hidden_states, sampler, return_timestamps, config, raw_metrics);
+            decoder->reset_state();
+
+            for (size_t i = 0; i < batch_chunks.size(); i++) {
+                const size_t input = active_inputs[batch_chunks[i]];
+                const std::vector<int64_t>& chunk_output_tokens = batch_results[i].tokens[0];
+                std::vector<int64_t>& output_tokens = results[input].output_tokens;
+
+                if (return_timestamps) {
+                    const float chunk_time_offset = chunk_offsets[input] * frame_length_in_seconds;
+                    auto extracted_segments = ov::genai::extract_segments(chunk_output_tokens,
+                                                                          config,
+                                                                          feature_extractor.nb_max_frames,
+                                                                          time_precision,
+                                                                          chunk_time_offset);
+                    segments[input].insert(segments[input].end(),
+                                           extracted_segments.segments.begin(),
+                                           extracted_segments.segments.end());
+                    output_tokens.insert(output_tokens.end(),
+                                         extracted_segments.non_timestamp_tokens.begin(),
+                                         extracted_segments.non_timestamp_tokens.end());
+                    chunk_offsets[input] += extracted_segments.last_offset;
+                } else {
+                    output_tokens.insert(output_tokens.end(), chunk_output_tokens.begin(), chunk_output_tokens.end());
+                    chunk_offsets[input] = input_features[input].n_frames;
+                }
+            }
+        }
+
+        auto removed_it = std::remove_if(active_inputs.begin(), active_inputs.end(), [&](size_t input) {
+            return chunk_offsets[input] >= input_features[input].n_frames;
+        });
+        active_inputs.erase(removed_it, active_inputs.end());
+    }
+
+    // inference metrics are shared by the whole batch
+    for (size_t i = 0; i < num_inputs; i++) {
+        auto& perf_metrics = results[i].perf_metrics;
+        perf_metrics.num_input_tokens = 0;
+        perf_metrics.raw_metrics = raw_metrics;
+        perf_metrics.whisper_raw_metrics.word_level_timestamps_processing_durations = {{MicroSeconds(0.0f)}};
+        if (config.return_timestamps) {
+            results[i].segments = std::move(segments[i]);
+        }
+    }
+    return results;
+}
+
+WhisperStreamingTranscriber::WhisperStreamingTranscriber(const WhisperGenerationConfig& config,
+                                                         const WhisperStreamingConfig& streaming_config,
+                                                         const WhisperConfig& model_config,
+                                                         const WhisperContextTokens& context_tokens,
+                                                         ov::InferRequest& encoder,
+                                                         std::shared_ptr<WhisperDecoder> decoder,
+                                                         WhisperFeatureExtractor& feature_extractor,
+                                                         Sampler& sampler)
+    : m_config(config),
+      m_context_tokens(context_tokens),
+      m_encoder(encoder),
+      m_decoder(decoder),
+      m_feature_extractor(feature_extractor),
+      m_sampler(sampler),
+      m_features(feature_extractor) {
+    OPENVINO_ASSERT(!m_config.word_timestamps, "Word-level timestamps are not supported for audio streams");
+    OPENVINO_ASSERT(streaming_config.step_length > 0.f, "step_length must be positive");
+    OPENVINO_ASSERT(streaming_config.max_window_length >= streaming_config.step_length,
+                    "max_window_length must not be less than step_length");
+    // segments are needed to move the window
+    m_config.return_timestamps = true;
+
+    OPENVINO_ASSERT(feature_extractor.sampling_rate != 0, "Sampling Rate for Feature Extractor is 0");
+    m_frame_length_in_seconds = static_cast<float>(feature_extractor.hop_length) / feature_extractor.sampling_rate;
+    m_time_precision = static_cast<float>(feature_extractor.chunk_length) / model_config.max_source_positions;
+    m_step_frames = std::max<size_t>(1, std::lround(streaming_config.step_length / m_frame_length_in_seconds));
+    m_max_window_frames = std::min(feature_extractor.nb_max_frames,
+                                   static_cast<size_t>(std::lround(streaming_config.max_window_length / m_frame_length_in_seconds)));
+}
+
+WhisperStreamingStep WhisperStreamingTranscriber::push(const RawSpeechInput& raw_speech) {
+    m_features.append(raw_speech);
+
+    WhisperStreamingStep result;
+    if (m_features.get_num_frames() < m_transcribed_frames + m_step_frames) {
+        result.partial_tokens = m_agreement.get_partial_tokens();
+        return result;
+    }
+    // a window can't grow past nb_max_frames, so a long piece of audio is transcribed with several windows
+    do {
+        _step(false, result);
+    } while (m_features.get_num_frames() - m_window_start > m_feature_extractor.nb_max_frames);
+    return result;
+}
+
+WhisperStreamingStep WhisperStreamingTranscriber::finish() {
+    m_features.finish();
+
+    WhisperStreamingStep result;
+    while (m_window_start < m_features.get_num_frames()) {
+        _step(true, result);
+    }
+    result.partial_tokens.clear();
+    return result;
+}
+
+void WhisperStreamingTranscriber::_step(bool is_final, WhisperStreamingStep& result) {
+    const size_t num_frames = m_features.get_num_frames();
+    const size_t nb_max_frames = m_feature_extractor.nb_max_frames;
+    const size_t window_frames = std::min(num_frames - m_window_start, nb_max_frames);
+    const bool is_window_full = num_frames - m_window_start >= nb_max_frames;
+    m_transcribed_frames = num_frames;
+
+    RawPerfMetrics raw_metrics;
+    raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+
+    auto window = m_features.get_window(m_window_start);
+    ov::Tensor hidden_state_tensor =
+        encode(m_encoder, window, m_feature_extractor.feature_size, nb_max_frames, raw_metrics);
+
+    if (m_sot_tokens.empty()) {
+        m_sot_tokens = prepare_sot_tokens(hidden_state_tensor, m_decoder, m_config, raw_metrics);
+    }
+    std::vector<int64_t> prompt_tokens = get_prompt_tokens(m_context_tokens, m_config, m_window_start);
+    prompt_tokens.insert(prompt_tokens.end(), m_sot_tokens.begin(), m_sot_tokens.end());
+    // stable tokens of the window are forced, so that only the unstable tail is generated
+    prompt_tokens.insert(prompt_tokens.end(), m_forced_tokens.begin(), m_forced_tokens.end());
+
+    SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(0, prompt_tokens, m_config, 1);
+    const EncodedResults window_result = decode(m_decoder,
+                                                prompt_tokens,
+                                                hidden_state_tensor,
+                                                nullptr,
+                                                m_sampler,
+                                                sequence_group,
+                                                true,
+                                                m_config,
+                                                raw_metrics,
+                                                m_forced_tokens)
+                                             .first;
+    // cross-attention KV cache of the decoder is computed from the encoder output, so it can't be reused for the next
+    // window
+    m_decoder->reset_state();
+
+    std::vector<int64_t> window_tokens = m_forced_tokens;
+    window_tokens.insert(window_tokens.end(), window_result.tokens[0].begin(), window_result.tokens[0].end());
+    // segment times are relative to the window start
+    const auto extracted_segments = extract_segments(window_tokens, m_config, nb_max_frames, m_time_precision);
+    const std::vector<int64_t>& hypothesis = extracted_segments.non_timestamp_tokens;
+
+    auto emit = [&result](const std::vector<int64_t>& stable_tokens) {
+        result.stable_tokens.insert(result.stable_tokens.end(), stable_tokens.begin(), stable_tokens.end());
+    };
+
+    if (is_final && !is_window_full) {
+        emit(m_agreement.commit(hypothesis, hypothesis.size()));
+        result.partial_tokens.clear();
+        _advance_window(num_frames - m_window_start, hypothesis.size());
+        return;
+    }
+
+    emit(m_agreement.update(hypothesis));
+    result.partial_tokens = m_agreement.get_partial_tokens();
+    m_forced_tokens = get_tokens_prefix(window_tokens,
+                                        extracted_segments.segment_ranges,
+                                        std::min(m_agreement.get_num_stable_tokens(), hypothesis.size()));
+
+    // the last finished segment and the last finished one which is stable
+    size_t num_segment_tokens = 0, finished_frames = 0, finished_tokens = 0, stable_frames = 0, stable_tokens = 0;
+    for (const auto& segment : extracted_segments.segments) {
+        if (segment.m_end < 0.f) {
+            break;
+        }
+        num_segment_tokens += segment.m_tokens.size();
+        finished_frames = std::min(window_frames, static_cast<size_t>(std::lround(segment.m_end / m_frame_length_in_seconds)));
+        finished_tokens = num_segment_tokens;
+        if (num_segment_tokens <= m_agreement.get_num_stable_tokens()) {
+            stable_frames = finished_frames;
+            stable_tokens = finished_tokens;
+        }
+    }
+
+    if (is_window_full) {
+        // the window can't grow anymore, so its finished segments become stable as in long-form transcription
+        if (finished_frames == 0) {
+            finished_frames = window_frames;
+            finished_tokens = hypothesis.size();
+        }
+        emit(m_agreement.commit(hypothesis, finished_tokens));
+        _advance_window(finished_frames, finished_tokens);
+        result.partial_tokens = m_agreement.get_partial_tokens();
+    } else if (window_frames > m_max_window_frames && stable_frames > 0) {
+        _advance_window(stable_frames, stable_tokens);
+    }
+}
+
+void WhisperStreamingTranscriber::_advance_window(size_t num_frames, size_t num_tokens) {
+    // timestamps of the forced tokens are relative to the previous window start
+    m_forced_tokens.clear();
+    m_window_start += num_frames;
+    m_features.drop_frames(m_window_start);
+    m_agreement.advance(num_tokens);
+}
+
 }  // namespace genai
 }  // namespace ov
@@ -13,6 +13,7 @@
 #include "sampling/sampler.hpp"
 #include "whisper/config.hpp"
 #include "whisper/feature_extractor.hpp"
+#include "whisper/local_agreement.hpp"
 #include "whisper/models.hpp"
 
 namespace ov {
@@ -42,5 +43,78 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
                                        Sampler& sampler,
                                        Tokenizer& tokenizer);
 
+/**
+ * @brief Transcribes a batch of audio inputs. Each round encodes the next 30s chunks of all unfinished inputs in one
+ * batch and decodes them with a sequence group per chunk, inputs drop out of the batch once their last chunk is done.
+ */
+std::vector<WhisperGenerateResult> whisper_generate_batch(const ov::genai::WhisperGenerationConfig& config,
+                                                          const ov::genai::WhisperConfig& model_config,
+                                                          const WhisperContextTokens& context_tokens,
+                                                          const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                          ov::InferRequest& encoder,
+                                                          std::shared_ptr<WhisperDecoder> decoder,
+                                                          WhisperFeatureExtractor& feature_extractor,
+                                                          Sampler& sampler);
+
+struct WhisperStreamingStep {
+    std::vector<int64_t> stable_tokens;
+    std::vector<int64_t> partial_tokens;
+};
+
+/**
+ * @brief Transcribes an audio stream with bounded latency. Log-mel frames of the received audio are computed
+ * incrementally and a window of frames which starts at the end of the last stable segment is transcribed each time
+ * step_length of new audio arrives. Tokens on which two consecutive hypotheses of the window agree become stable
+ * (local agreement policy). The stable tokens of the window are a forced decoder prefix of its next transcription, so
+ * that only the unstable tail is generated, while the encoder processes the whole window each step as its input length
+ * is fixed. Once the window grows over max_window_length its start moves past the stable segments, so the audio of the
+ * unstable tail is the overlap encoded again with the next window.
+ */
+class WhisperStreamingTranscriber {
+public:
+    WhisperStreamingTranscriber(const WhisperGenerationConfig& config,
+                                const WhisperStreamingConfig& streaming_config,
+                                const WhisperConfig& model_config,
+                                const WhisperContextTokens& context_tokens,
+                                ov::InferRequest& encoder,
+                                std::shared_ptr<WhisperDecoder> decoder,
+                                WhisperFeatureExtractor& feature_extractor,
+                                Sampler& sampler);
+
+    WhisperStreamingStep push(const RawSpeechInput& raw_speech);
+
+    /**
+     * Transcribes the rest of the stream, all its tokens become stable.
+     */
+    WhisperStreamingStep finish();
+
+private:
+    WhisperGenerationConfig m_config;
+    WhisperContextTokens m_context_tokens;
+    ov::InferRequest& m_encoder;
+    std::shared_ptr<WhisperDecoder> m_decoder;
+    WhisperFeatureExtractor& m_feature_extractor;
+    Sampler& m_sampler;
+    WhisperStreamingFeatures m_features;
+    size_t m_step_frames;
+    size_t m_max_window_frames;
+    float m_time_precision;
+    float m_frame_length_in_seconds;
+
+    // detected once for the whole stream
+    std::vector<int64_t> m_sot_tokens;
+    size_t m_window_start = 0;
+    // frames received by the latest transcription of the window
+    size_t m_transcribed_frames = 0;
+    // stable tokens and the latest hypothesis of the window
+    LocalAgreement m_agreement;
+    // the latest transcription of the window up to its last stable token, including timestamps, which is passed to the
+    // decoder as a forced prefix of the next transcription of the window
+    std::vector<int64_t> m_forced_tokens;
+
+    void _step(bool is_final, WhisperStreamingStep& result);
+    void _advance_window(size_t num_frames, size_t num_tokens);
+};
+
 }  // namespace genai
 }  // namespace ov
@@ -74,6 +74,8 @@ from .py_openvino_genai import (
     WhisperPipeline,
     WhisperRawPerfMetrics,
     WhisperPerfMetrics,
+    WhisperStreamingConfig,
+    WhisperStreamingResult,
     WhisperWordTiming,
 )
 
@@ -97,6 +99,7 @@ from .py_openvino_genai import (
     ImageGenerationPerfMetrics,
     RawImageGenerationPerfMetrics,
     TaylorSeerCacheConfig,
+    VAETilingConfig,
 )
 
 # Video generation
@@ -116,6 +119,7 @@ from .py_openvino_genai import (
     GenerationResult,
     GenerationStatus,
     SchedulerConfig,
+    SchedulingPolicy,
     CacheEvictionConfig,
     AggregationMode,
     SparseAttentionMode,
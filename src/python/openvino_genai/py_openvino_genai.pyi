@@ -5,7 +5,7 @@ from __future__ import annotations
 import collections.abc
 import openvino._pyopenvino
 import typing
-__all__: list[str] = ['Adapter', 'AdapterConfig', 'AdaptiveRKVConfig', 'AggregationMode', 'AutoencoderKL', 'AutoencoderKLLTXVideo', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChatHistory', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'DeepSeekR1ReasoningIncrementalParser', 'DeepSeekR1ReasoningParser', 'EncodedGenerationResult', 'EncodedResults', 'ExtendedPerfMetrics', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'IncrementalParser', 'InpaintingPipeline', 'KVCrushAnchorPointMode', 'KVCrushConfig', 'LLMPipeline', 'LTXVideoTransformer3DModel', 'Llama3JsonToolParser', 'Llama3PythonicToolParser', 'MeanStdPair', 'Parser', 'PerfMetrics', 'Phi4ReasoningIncrementalParser', 'Phi4ReasoningParser', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'ReasoningIncrementalParser', 'ReasoningParser', 'SD3Transformer2DModel', 'SDPerModelsPerfMetrics', 'SDPerfMetrics', 'Scheduler', 'SchedulerConfig', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'SummaryStats', 'T5EncoderModel', 'TaylorSeerCacheConfig', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'Text2VideoPipeline', 'TextEmbeddingPipeline', 'TextParserStreamer', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLLMParserWrapper', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'VideoGenerationConfig', 'VideoGenerationPerfMetrics', 'VideoGenerationResult', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'WhisperWordTiming', 'draft_model', 'get_version']
+__all__: list[str] = ['Adapter', 'AdapterConfig', 'AdaptiveRKVConfig', 'AggregationMode', 'AutoencoderKL', 'AutoencoderKLLTXVideo', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChatHistory', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'DeepSeekR1ReasoningIncrementalParser', 'DeepSeekR1ReasoningParser', 'EncodedGenerationResult', 'EncodedResults', 'ExtendedPerfMetrics', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'IncrementalParser', 'InpaintingPipeline', 'KVCrushAnchorPointMode', 'KVCrushConfig', 'LLMPipeline', 'LTXVideoTransformer3DModel', 'Llama3JsonToolParser', 'Llama3PythonicToolParser', 'MeanStdPair', 'Parser', 'PerfMetrics', 'Phi4ReasoningIncrementalParser', 'Phi4ReasoningParser', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'ReasoningIncrementalParser', 'ReasoningParser', 'SD3Transformer2DModel', 'SDPerModelsPerfMetrics', 'SDPerfMetrics', 'Scheduler', 'SchedulerConfig', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'SummaryStats', 'T5EncoderModel', 'TaylorSeerCacheConfig', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'Text2VideoPipeline', 'TextEmbeddingPipeline', 'TextParserStreamer', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VAETilingConfig', 'VLLMParserWrapper', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'VideoGenerationConfig', 'VideoGenerationPerfMetrics', 'VideoGenerationResult', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'WhisperStreamingConfig', 'WhisperStreamingResult', 'WhisperWordTiming', 'draft_model', 'get_version']
 class Adapter:
     """
     Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.
@@ -277,6 +277,11 @@ class AutoencoderKL:
         ...
     def reshape(self, batch_size: typing.SupportsInt, height: typing.SupportsInt, width: typing.SupportsInt) -> AutoencoderKL:
         ...
+    def set_tiling_config(self, tiling_config: VAETilingConfig | None) -> None:
+        """
+                        Makes decode() and encode() process images by overlapping tiles to bound memory consumed by the VAE.
+                        tiling_config (VAETilingConfig | None): Tiling configuration, None processes whole images.
+        """
 class AutoencoderKLLTXVideo:
     """
     AutoencoderKLLTXVideo class for LTX-Video VAE decoding.
@@ -362,6 +367,11 @@ class AutoencoderKLLTXVideo:
                         height (int): Video height.
                         width (int): Video width.
         """
+    def set_tiling_config(self, tiling_config: VAETilingConfig | None) -> None:
+        """
+                        Makes decode() process videos by overlapping spatio-temporal tiles to bound memory consumed by the VAE.
+                        tiling_config (VAETilingConfig | None): Tiling configuration, None decodes whole videos.
+        """
 class CLIPTextModel:
     """
     CLIPTextModel class.
@@ -420,6 +430,10 @@ class CLIPTextModel:
         """
     def get_config(self) -> CLIPTextModel.Config:
         ...
+    def get_num_cache_hits(self) -> int:
+        ...
+    def get_num_cache_misses(self) -> int:
+        ...
     def get_output_tensor(self, idx: typing.SupportsInt) -> openvino._pyopenvino.Tensor:
         ...
     def infer(self, pos_prompt: str, neg_prompt: str, do_classifier_free_guidance: bool) -> openvino._pyopenvino.Tensor:
@@ -937,6 +951,8 @@ class GenerationConfig:
         logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
                         Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
         apply_chat_template: whether to apply chat_template for non-chat scenarios
+        priority:       priority of the request for ContinuousBatching scheduler with SchedulingPolicy.PRIORITY, higher is served first.
+        deadline_ms:    latency target of the request in milliseconds for ContinuousBatching scheduler with SchedulingPolicy.EARLIEST_DEADLINE_FIRST, 0 means no deadline.
     
         repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
         presence_penalty: reduces absolute log prob if the token was generated at least once.
@@ -1003,6 +1019,12 @@ class GenerationConfig:
     def assistant_confidence_threshold(self, arg0: typing.SupportsFloat) -> None:
         ...
     @property
+    def deadline_ms(self) -> int:
+        ...
+    @deadline_ms.setter
+    def deadline_ms(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def diversity_penalty(self) -> float:
         ...
     @diversity_penalty.setter
@@ -1099,6 +1121,12 @@ class GenerationConfig:
     def presence_penalty(self, arg0: typing.SupportsFloat) -> None:
         ...
     @property
+    def priority(self) -> int:
+        ...
+    @priority.setter
+    def priority(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def pruning_ratio(self) -> int:
         ...
     @pruning_ratio.setter
@@ -1436,6 +1464,7 @@ class ImageGenerationConfig:
     prompt_2: str | None
     prompt_3: str | None
     taylorseer_config: openvino_genai.py_openvino_genai.TaylorSeerCacheConfig | None
+    vae_tiling_config: openvino_genai.py_openvino_genai.VAETilingConfig | None
     def __init__(self) -> None:
         ...
     def update_generation_config(self, **kwargs) -> None:
@@ -1506,6 +1535,7 @@ class ImageGenerationPerfMetrics:
         - inference durations for each encoder, ms
         - inference duration of vae_encoder model, ms
         - inference duration of vae_decoder model, ms
+        - text encoder cache hits and misses
     
         Preferable way to access values is via get functions. Getters calculate mean and std values from raw_metrics and return pairs.
         If mean and std were already calculated, getters return cached values.
@@ -1543,6 +1573,12 @@ class ImageGenerationPerfMetrics:
         :param get_first_and_other_trans_infer_duration: Returns the first inference duration and the average duration of other inferences in one generation in milliseconds.
         :type get_first_and_other_trans_infer_duration: tuple
     
+        :param text_encoder_cache_hits: The number of prompts whose text encoder outputs were taken from the text encoder cache enabled by TEXT_ENCODER_CACHE_SIZE_MB environment variable.
+        :type text_encoder_cache_hits: int
+    
+        :param text_encoder_cache_misses: The number of prompts encoded by text encoders while the text encoder cache is enabled.
+        :type text_encoder_cache_misses: int
+    
         :param get_transformer_infer_duration: Returns the mean and standard deviation of one transformer inference in milliseconds.
         :type get_transformer_infer_duration: MeanStdPair
     
@@ -1578,6 +1614,12 @@ class ImageGenerationPerfMetrics:
     @property
     def raw_metrics(self) -> RawImageGenerationPerfMetrics:
         ...
+    @property
+    def text_encoder_cache_hits(self) -> int:
+        ...
+    @property
+    def text_encoder_cache_misses(self) -> int:
+        ...
 class IncrementalParser:
     def __init__(self) -> None:
         ...
@@ -1815,6 +1857,8 @@ class LLMPipeline:
             logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
                             Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
             apply_chat_template: whether to apply chat_template for non-chat scenarios
+            priority:       priority of the request for ContinuousBatching scheduler with SchedulingPolicy.PRIORITY, higher is served first.
+            deadline_ms:    latency target of the request in milliseconds for ContinuousBatching scheduler with SchedulingPolicy.EARLIEST_DEADLINE_FIRST, 0 means no deadline.
         
             repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
             presence_penalty: reduces absolute log prob if the token was generated at least once.
@@ -1872,6 +1916,10 @@ class LLMPipeline:
                     generation_config {ov_genai.GenerationConfig} Genai GenerationConfig. Default is an empty config.
                     kwargs: Device properties.
         """
+    def close_session(self, session_id: str) -> None:
+        ...
+    def create_session(self, session_id: str) -> None:
+        ...
     def finish_chat(self) -> None:
         ...
     def generate(self, inputs: openvino._pyopenvino.Tensor | openvino_genai.py_openvino_genai.TokenizedInputs | str | collections.abc.Sequence[str] | openvino_genai.py_openvino_genai.ChatHistory, generation_config: openvino_genai.py_openvino_genai.GenerationConfig | None = None, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None, **kwargs) -> openvino_genai.py_openvino_genai.EncodedResults | openvino_genai.py_openvino_genai.DecodedResults:
@@ -1912,6 +1960,8 @@ class LLMPipeline:
             logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
                             Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
             apply_chat_template: whether to apply chat_template for non-chat scenarios
+            priority:       priority of the request for ContinuousBatching scheduler with SchedulingPolicy.PRIORITY, higher is served first.
+            deadline_ms:    latency target of the request in milliseconds for ContinuousBatching scheduler with SchedulingPolicy.EARLIEST_DEADLINE_FIRST, 0 means no deadline.
         
             repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
             presence_penalty: reduces absolute log prob if the token was generated at least once.
@@ -1943,6 +1993,8 @@ class LLMPipeline:
         ...
     def get_tokenizer(self) -> Tokenizer:
         ...
+    def resume_session(self, session_id: str) -> None:
+        ...
     def set_generation_config(self, config: GenerationConfig) -> None:
         ...
     def start_chat(self, system_message: str = '') -> None:
@@ -2173,6 +2225,10 @@ class PipelineMetrics:
           This value represents reserved/allocated memory for the KV cache and does not
           distinguish between used and unused portions in dynamic KV cache configurations.
         :type kv_cache_size_in_bytes: int
+    
+        :param copied_kv_cache_size_in_bytes: Size of KV cache blocks copied in the last generation step in bytes, e.g. for copy-on-write of beams or
+          sequences forked for parallel sampling.
+        :type copied_kv_cache_size_in_bytes: int
     """
     def __init__(self) -> None:
         ...
@@ -2183,6 +2239,9 @@ class PipelineMetrics:
     def cache_usage(self) -> float:
         ...
     @property
+    def copied_kv_cache_size_in_bytes(self) -> int:
+        ...
+    @property
     def kv_cache_size_in_bytes(self) -> int:
         ...
     @property
@@ -2500,10 +2559,17 @@ class SchedulerConfig:
         cache_eviction_config       Cache eviction configuration struct.
         use_sparse_attention        Whether to use sparse attention during prefill.
         sparse_attention_config     Sparse attention configuration struct.
+        scheduling_policy           Order in which requests are scheduled and preempted.
+        swap_space                  Size of host memory in GB to keep KV-cache of preempted requests instead of recomputing it.
+        prefix_cache_host_size      Size of host memory tier of prefix cache in GB.
+        prefix_cache_disk_path      Path to a file used for disk tier of prefix cache.
+        prefix_cache_disk_size      Size of disk tier of prefix cache in GB.
     """
     cache_eviction_config: CacheEvictionConfig
     dynamic_split_fuse: bool
     enable_prefix_caching: bool
+    prefix_cache_disk_path: str
+    scheduling_policy: SchedulingPolicy
     sparse_attention_config: SparseAttentionConfig
     use_cache_eviction: bool
     use_sparse_attention: bool
@@ -2535,6 +2601,74 @@ class SchedulerConfig:
     @num_kv_blocks.setter
     def num_kv_blocks(self, arg0: typing.SupportsInt) -> None:
         ...
+    @property
+    def prefix_cache_disk_size(self) -> int:
+        ...
+    @prefix_cache_disk_size.setter
+    def prefix_cache_disk_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def prefix_cache_host_size(self) -> int:
+        ...
+    @prefix_cache_host_size.setter
+    def prefix_cache_host_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def swap_space(self) -> int:
+        ...
+    @swap_space.setter
+    def swap_space(self, arg0: typing.SupportsInt) -> None:
+        ...
+class SchedulingPolicy:
+    """
+    Represents the order in which ContinuousBatching scheduler serves and preempts requests.
+                                   :param SchedulingPolicy.FIFO: Requests are served in the order of their arrival.
+                                   :param SchedulingPolicy.PRIORITY: Requests with higher GenerationConfig.priority are served first and preempted last.
+                                   :param SchedulingPolicy.EARLIEST_DEADLINE_FIRST: Requests with the closest GenerationConfig.deadline_ms are served first, requests without deadline are served last.
+                                   :param SchedulingPolicy.SHORTEST_REMAINING_PROMPT_FIRST: Requests with the smallest number of not yet processed prompt tokens are served first.
+    
+    
+    Members:
+    
+      FIFO
+    
+      PRIORITY
+    
+      EARLIEST_DEADLINE_FIRST
+    
+      SHORTEST_REMAINING_PROMPT_FIRST
+    """
+    EARLIEST_DEADLINE_FIRST: typing.ClassVar[SchedulingPolicy]  # value = <SchedulingPolicy.EARLIEST_DEADLINE_FIRST: 2>
+    FIFO: typing.ClassVar[SchedulingPolicy]  # value = <SchedulingPolicy.FIFO: 0>
+    PRIORITY: typing.ClassVar[SchedulingPolicy]  # value = <SchedulingPolicy.PRIORITY: 1>
+    SHORTEST_REMAINING_PROMPT_FIRST: typing.ClassVar[SchedulingPolicy]  # value = <SchedulingPolicy.SHORTEST_REMAINING_PROMPT_FIRST: 3>
+    __members__: typing.ClassVar[dict[str, SchedulingPolicy]]  # value = {'FIFO': <SchedulingPolicy.FIFO: 0>, 'PRIORITY': <SchedulingPolicy.PRIORITY: 1>, 'EARLIEST_DEADLINE_FIRST': <SchedulingPolicy.EARLIEST_DEADLINE_FIRST: 2>, 'SHORTEST_REMAINING_PROMPT_FIRST': <SchedulingPolicy.SHORTEST_REMAINING_PROMPT_FIRST: 3>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: typing.SupportsInt) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: typing.SupportsInt) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
 class SparseAttentionConfig:
     """
     
@@ -3250,6 +3384,10 @@ class T5EncoderModel:
                         device (str): Device to run the model on (e.g., CPU, GPU).
                         kwargs: Device properties.
         """
+    def get_num_cache_hits(self) -> int:
+        ...
+    def get_num_cache_misses(self) -> int:
+        ...
     def get_output_tensor(self, idx: typing.SupportsInt) -> openvino._pyopenvino.Tensor:
         ...
     def infer(self, pos_prompt: str, neg_prompt: str, do_classifier_free_guidance: bool, max_sequence_length: typing.SupportsInt, **kwargs) -> openvino._pyopenvino.Tensor:
@@ -3258,7 +3396,7 @@ class T5EncoderModel:
         ...
 class TaylorSeerCacheConfig:
     """
-    Configuration for TaylorSeer cache mechanism in diffusion transformers.
+    Configuration for TaylorSeer cache mechanism in diffusion UNets and transformers.
     
     See paper: https://arxiv.org/pdf/2503.06923
     
@@ -3266,6 +3404,7 @@ class TaylorSeerCacheConfig:
       cache_interval: Interval between full computation steps (default: 3, must be >= 2)
       disable_cache_before_step: Step before which caching is disabled for warmup (default: 6)
       disable_cache_after_step: Step after which caching is disabled. If negative, calculated as num_inference_steps + disable_cache_after_step (default: -2)
+      order: Order of the Taylor expansion which predicts the cached steps, 0 reuses the last computed output and 1 extrapolates the last two computed outputs linearly (default: 1)
     """
     def __init__(self) -> None:
         ...
@@ -3297,6 +3436,14 @@ class TaylorSeerCacheConfig:
     @disable_cache_before_step.setter
     def disable_cache_before_step(self, arg0: typing.SupportsInt) -> None:
         ...
+    @property
+    def order(self) -> int:
+        """
+        Order of the Taylor expansion which predicts the cached steps (0 or 1)
+        """
+    @order.setter
+    def order(self, arg0: typing.SupportsInt) -> None:
+        ...
 class Text2ImagePipeline:
     """
     This class is used for generation with text-to-image models.
@@ -3359,6 +3506,22 @@ class Text2ImagePipeline:
         """
     def decode(self, latent: openvino._pyopenvino.Tensor) -> openvino._pyopenvino.Tensor:
         ...
+    def enable_pipelined_generation(self, max_in_flight_requests: typing.SupportsInt = 4) -> None:
+        """
+                        Enables pipelined execution of generate() calls made concurrently by several threads, which then share this pipeline.
+                        Text encoding, denoising and VAE decoding run in background threads, so that the VAE decoding of a request overlaps
+                        the denoising of the next one and the text encoding of the one after it. Must be called after the pipeline is compiled.
+                        max_in_flight_requests (int): Maximum number of requests processed by all stages at once.
+        """
+    def enable_step_batching(self, max_batch_size: typing.SupportsInt = 8) -> None:
+        """
+                        Enables step-level batching of generate() calls made concurrently by several threads, which then share this pipeline.
+                        Latents of requests with the same resolution are denoised by one UNet inference per step, each request keeping its own
+                        scheduler state, timesteps and guidance scale. Requests join and leave the batch between denoising steps.
+                        Supported for Stable Diffusion and Latent Consistency Model pipelines with UNet accepting dynamic batch size.
+                        Requests use clones of the current scheduler; set_scheduler(), set_generation_config(), reshape() and compile() throw afterwards.
+                        max_batch_size (int): Maximum batch size of UNet inference.
+        """
     def export_model(self, export_path: os.PathLike | str | bytes) -> None:
         """
                         Exports compiled models to a specified directory. Can significantly reduce model load time, especially for large models.
@@ -3544,6 +3707,10 @@ class TextEmbeddingPipeline:
                 Useful for database population. If set, the pipeline will fix model shape for inference optimization.
                 Number of documents passed to pipeline should be equal to batch_size.
                 For query embeddings, batch_size should be set to 1 or not set.
+            max_batch_tokens (int, optional):
+                Max number of tokens, including padding, in a single inference of the embedding model.
+                If set, documents are sorted by length and split into micro batches fitting the budget, which run
+                concurrently on several infer requests. Not compatible with batch_size and pad_to_max_length.
             pooling_type (TextEmbeddingPipeline.PoolingType, optional):
                 Pooling strategy applied to the model output tensor. Defaults to PoolingType.CLS.
             normalize (bool, optional):
@@ -3578,6 +3745,12 @@ class TextEmbeddingPipeline:
         def batch_size(self, arg0: typing.SupportsInt | None) -> None:
             ...
         @property
+        def max_batch_tokens(self) -> int | None:
+            ...
+        @max_batch_tokens.setter
+        def max_batch_tokens(self, arg0: typing.SupportsInt | None) -> None:
+            ...
+        @property
         def max_length(self) -> int | None:
             ...
         @max_length.setter
@@ -3694,6 +3867,10 @@ class TextRerankPipeline:
                 If 'True', model input tensors are padded to the maximum length.
             padding_side (str, optional):
                 Side to use for padding "left" or "right"
+            max_batch_tokens (int, optional):
+                Max number of tokens, including padding, in a single inference of the rerank model.
+                If set, documents are sorted by length and split into micro batches fitting the budget, which run
+                concurrently on several infer requests. Not compatible with pad_to_max_length.
         """
         pad_to_max_length: bool | None
         padding_side: str | None
@@ -3704,6 +3881,12 @@ class TextRerankPipeline:
         def __init__(self, **kwargs) -> None:
             ...
         @property
+        def max_batch_tokens(self) -> int | None:
+            ...
+        @max_batch_tokens.setter
+        def max_batch_tokens(self, arg0: typing.SupportsInt | None) -> None:
+            ...
+        @property
         def max_length(self) -> int | None:
             ...
         @max_length.setter
@@ -3966,6 +4149,63 @@ class UNet2DConditionModel:
         ...
     def set_hidden_states(self, tensor_name: str, encoder_hidden_states: openvino._pyopenvino.Tensor) -> None:
         ...
+class VAETilingConfig:
+    """
+    Configuration of tiled VAE inference, which processes overlapping tiles of images and videos to bound VAE memory consumption.
+    
+    Attributes:
+      tile_size: Height and width of tiles in pixels (default: 512)
+      tile_overlap: Minimal overlap of neighbouring tiles in pixels (default: 128)
+      tile_num_frames: Number of video frames per tile, used by video VAEs only (default: 33)
+      frame_overlap: Minimal overlap of neighbouring tiles in video frames, used by video VAEs only (default: 8)
+      num_infer_requests: Number of infer requests which process tiles in parallel (default: 1)
+    """
+    def __init__(self) -> None:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def to_string(self) -> str:
+        ...
+    @property
+    def frame_overlap(self) -> int:
+        """
+        Minimal overlap of neighbouring tiles in video frames
+        """
+    @frame_overlap.setter
+    def frame_overlap(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def num_infer_requests(self) -> int:
+        """
+        Number of infer requests which process tiles in parallel
+        """
+    @num_infer_requests.setter
+    def num_infer_requests(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def tile_num_frames(self) -> int:
+        """
+        Number of video frames per tile
+        """
+    @tile_num_frames.setter
+    def tile_num_frames(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def tile_overlap(self) -> int:
+        """
+        Minimal overlap of neighbouring tiles in pixels
+        """
+    @tile_overlap.setter
+    def tile_overlap(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def tile_size(self) -> int:
+        """
+        Height and width of tiles in pixels
+        """
+    @tile_size.setter
+    def tile_size(self, arg0: typing.SupportsInt) -> None:
+        ...
 class VLLMParserWrapper(Parser):
     def __init__(self, py_parser: typing.Any) -> None:
         """
@@ -4302,6 +4542,8 @@ class VLMRawPerfMetrics:
 class VideoGenerationConfig:
     generator: Generator
     negative_prompt: str | None
+    taylorseer_config: openvino_genai.py_openvino_genai.TaylorSeerCacheConfig | None
+    vae_tiling_config: openvino_genai.py_openvino_genai.VAETilingConfig | None
     def __init__(self) -> None:
         ...
     @property
@@ -4655,6 +4897,7 @@ class WhisperPipeline:
                     models_path (os.PathLike): Path to the model file.
                     device (str): Device to run the model on (e.g., CPU, GPU).
         """
+    @typing.overload
     def generate(self, raw_speech_input: collections.abc.Sequence[typing.SupportsFloat], generation_config: openvino_genai.py_openvino_genai.WhisperGenerationConfig | None = None, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None, **kwargs) -> WhisperDecodedResults:
         """
             High level generate that receives raw speech as a vector of floats and returns decoded output.
@@ -4796,12 +5039,55 @@ class WhisperPipeline:
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
         """
+    def finish_stream(self) -> WhisperStreamingResult:
+        """
+                    Transcribes the rest of the stream and finishes it.
+        
+                    :return: the rest of the stable text with empty partial text
+                    :rtype: WhisperStreamingResult
+        """
+    @typing.overload
+    def generate(self, raw_speech_inputs: collections.abc.Sequence[collections.abc.Sequence[typing.SupportsFloat]], generation_config: openvino_genai.py_openvino_genai.WhisperGenerationConfig | None = None, **kwargs) -> list[WhisperDecodedResults]:
+        """
+            Transcribes a batch of audio inputs. Encoder and decoder run on dynamic batches made of the next 30s chunks of the
+            inputs, the inputs whose transcription is finished drop out of the batch.
+        
+            :param raw_speech_inputs: list of inputs, each of them is a list of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+            :type raw_speech_inputs: list[list[float]]
+        
+            :param generation_config: generation_config, word-level timestamps are not supported for a batch
+            :type generation_config: WhisperGenerationConfig or a dict
+        
+            :return: transcription of each input, performance metrics are the ones of the whole batch
+            :rtype: list[WhisperDecodedResults]
+        """
     def get_generation_config(self) -> WhisperGenerationConfig:
         ...
     def get_tokenizer(self) -> Tokenizer:
         ...
+    def push_audio(self, raw_speech_input: collections.abc.Sequence[typing.SupportsFloat]) -> WhisperStreamingResult:
+        """
+                    Appends audio to the stream and transcribes the received audio once step_length of new audio has arrived.
+        
+                    :param raw_speech_input: next samples of the stream. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+                    :type raw_speech_input: list[float]
+        
+                    :return: text which became stable and the current partial text
+                    :rtype: WhisperStreamingResult
+        """
     def set_generation_config(self, config: WhisperGenerationConfig) -> None:
         ...
+    def start_stream(self, generation_config: WhisperGenerationConfig | None = None, streaming_config: WhisperStreamingConfig | None = None, **kwargs) -> None:
+        """
+                    Starts transcription of an audio stream, which receives audio with push_audio() and is finished with
+                    finish_stream(). A previous stream is dropped. Supported by the stateful pipeline only.
+        
+                    :param generation_config: generation_config, word-level timestamps are not supported for streams
+                    :type generation_config: WhisperGenerationConfig or a dict
+        
+                    :param streaming_config: latency and window settings of the stream
+                    :type streaming_config: WhisperStreamingConfig
+        """
 class WhisperRawPerfMetrics:
     """
     
@@ -4821,6 +5107,50 @@ class WhisperRawPerfMetrics:
     @property
     def word_level_timestamps_processing_durations(self) -> list[float]:
         ...
+class WhisperStreamingConfig:
+    """
+    
+        Latency and window settings of an audio stream transcription.
+    
+        :param step_length: length of new audio in seconds after which the stream is transcribed again, bounds the latency of results. Each step encodes a full 30 s input, so it must be longer than a step takes on the device, 1-2 s suits most devices.
+        :type step_length: float
+    
+        :param max_window_length: once the transcribed window of audio is longer than this length in seconds, its start moves past the stable segments.
+        :type max_window_length: float
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def max_window_length(self) -> float:
+        ...
+    @max_window_length.setter
+    def max_window_length(self, arg0: typing.SupportsFloat) -> None:
+        ...
+    @property
+    def step_length(self) -> float:
+        ...
+    @step_length.setter
+    def step_length(self, arg0: typing.SupportsFloat) -> None:
+        ...
+class WhisperStreamingResult:
+    """
+    
+        Transcription of an audio stream received so far.
+    
+        :param stable_text: text which became stable since the previous result, it isn't revised by the later audio.
+        :type stable_text: str
+    
+        :param partial_text: hypothesis for the rest of the received audio, it's replaced by the partial text of the next result.
+        :type partial_text: str
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def partial_text(self) -> str:
+        ...
+    @property
+    def stable_text(self) -> str:
+        ...
 class WhisperWordTiming:
     """
     Structure to store word-level timestamps
@@ -126,6 +126,11 @@ auto scheduler_config_docstring = R"(
     cache_eviction_config       Cache eviction configuration struct.
     use_sparse_attention        Whether to use sparse attention during prefill.
     sparse_attention_config     Sparse attention configuration struct.
+    scheduling_policy           Order in which requests are scheduled and preempted.
+    swap_space                  Size of host memory in GB to keep KV-cache of preempted requests instead of recomputing it.
+    prefix_cache_host_size      Size of host memory tier of prefix cache in GB.
+    prefix_cache_disk_path      Path to a file used for disk tier of prefix cache.
+    prefix_cache_disk_size      Size of disk tier of prefix cache in GB.
 )";
 
 auto generation_result_docstring = R"(
@@ -170,6 +175,10 @@ auto pipeline_metrics_docstring = R"(
       This value represents reserved/allocated memory for the KV cache and does not
       distinguish between used and unused portions in dynamic KV cache configurations.
     :type kv_cache_size_in_bytes: int
+
+    :param copied_kv_cache_size_in_bytes: Size of KV cache blocks copied in the last generation step in bytes, e.g. for copy-on-write of beams or
+      sequences forked for parallel sampling.
+    :type copied_kv_cache_size_in_bytes: int
 )";
 
 std::ostream& operator << (std::ostream& stream, const GenerationResult& generation_result) {
@@ -375,6 +384,18 @@ void init_continuous_batching_pipeline(py::module_& m) {
             .def_readwrite("xattention_stride", &SparseAttentionConfig::xattention_stride)
             .def("to_string", &SparseAttentionConfig::to_string);
 
+    py::enum_<ov::genai::SchedulingPolicy>(m, "SchedulingPolicy",
+                            R"(Represents the order in which ContinuousBatching scheduler serves and preempts requests.
+                               :param SchedulingPolicy.FIFO: Requests are served in the order of their arrival.
+                               :param SchedulingPolicy.PRIORITY: Requests with higher GenerationConfig.priority are served first and preempted last.
+                               :param SchedulingPolicy.EARLIEST_DEADLINE_FIRST: Requests with the closest GenerationConfig.deadline_ms are served first, requests without deadline are served last.
+                               :param SchedulingPolicy.SHORTEST_REMAINING_PROMPT_FIRST: Requests with the smallest number of not yet processed prompt tokens are served first.
+)")
+            .value("FIFO", ov::genai::SchedulingPolicy::FIFO)
+            .value("PRIORITY", ov::genai::SchedulingPolicy::PRIORITY)
+            .value("EARLIEST_DEADLINE_FIRST", ov::genai::SchedulingPolicy::EARLIEST_DEADLINE_FIRST)
+            .value("SHORTEST_REMAINING_PROMPT_FIRST", ov::genai::SchedulingPolicy::SHORTEST_REMAINING_PROMPT_FIRST);
+
     py::class_<SchedulerConfig>(m, "SchedulerConfig", scheduler_config_docstring)
         .def(py::init<>())
         .def_readwrite("max_num_batched_tokens", &SchedulerConfig::max_num_batched_tokens)
@@ -387,6 +408,11 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def_readwrite("cache_eviction_config", &SchedulerConfig::cache_eviction_config)
         .def_readwrite("use_sparse_attention", &SchedulerConfig::use_sparse_attention)
         .def_readwrite("sparse_attention_config", &SchedulerConfig::sparse_attention_config)
+        .def_readwrite("scheduling_policy", &SchedulerConfig::scheduling_policy)
+        .def_readwrite("swap_space", &SchedulerConfig::swap_space)
+        .def_readwrite("prefix_cache_host_size", &SchedulerConfig::prefix_cache_host_size)
+        .def_readwrite("prefix_cache_disk_path", &SchedulerConfig::prefix_cache_disk_path)
+        .def_readwrite("prefix_cache_disk_size", &SchedulerConfig::prefix_cache_disk_size)
         .def("to_string", &SchedulerConfig::to_string);
 
     py::class_<PipelineMetrics>(m, "PipelineMetrics", pipeline_metrics_docstring)
@@ -396,6 +422,7 @@ void init_continuous_batching_pipeline(py::module_& m) {
             .def_readonly("cache_usage", &PipelineMetrics::cache_usage)
             .def_readonly("avg_cache_usage", &PipelineMetrics::avg_cache_usage)
             .def_readonly("kv_cache_size_in_bytes", &PipelineMetrics::kv_cache_size_in_bytes)
+            .def_readonly("copied_kv_cache_size_in_bytes", &PipelineMetrics::copied_kv_cache_size_in_bytes)
             .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage);
 
     py::class_<ContinuousBatchingPipeline>(m, "ContinuousBatchingPipeline", "This class is used for generation with LLMs with continuous batchig")
@@ -167,6 +167,8 @@ char generation_config_docstring[] = R"(
     logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
                     Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
     apply_chat_template: whether to apply chat_template for non-chat scenarios
+    priority:       priority of the request for ContinuousBatching scheduler with SchedulingPolicy.PRIORITY, higher is served first.
+    deadline_ms:    latency target of the request in milliseconds for ContinuousBatching scheduler with SchedulingPolicy.EARLIEST_DEADLINE_FIRST, 0 means no deadline.
 
     repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
     presence_penalty: reduces absolute log prob if the token was generated at least once.
@@ -450,6 +452,8 @@ void init_generation_config(py::module_& m) {
         .def_readwrite("parsers", &GenerationConfig::parsers, py::keep_alive<1, 2>())
         .def_readwrite("adapters", &GenerationConfig::adapters)
         .def_readwrite("apply_chat_template", &GenerationConfig::apply_chat_template)
+        .def_readwrite("priority", &GenerationConfig::priority)
+        .def_readwrite("deadline_ms", &GenerationConfig::deadline_ms)
         .def("set_eos_token_id", &GenerationConfig::set_eos_token_id, py::arg("tokenizer_eos_token_id"))
         .def("is_beam_search", &GenerationConfig::is_beam_search)
         .def("is_greedy_decoding", &GenerationConfig::is_greedy_decoding)
@@ -77,6 +77,8 @@ void init_clip_text_model(py::module_& m) {
             py::arg("neg_prompt"), 
             py::arg("do_classifier_free_guidance"))
         .def("get_output_tensor", &ov::genai::CLIPTextModel::get_output_tensor, py::arg("idx"))
+        .def("get_num_cache_hits", &ov::genai::CLIPTextModel::get_num_cache_hits)
+        .def("get_num_cache_misses", &ov::genai::CLIPTextModel::get_num_cache_misses)
         .def(
             "compile",
             [](ov::genai::CLIPTextModel& self,
@@ -204,6 +206,8 @@ void init_t5_encoder_model(py::module_& m) {
             py::arg("do_classifier_free_guidance"), 
             py::arg("max_sequence_length"))
         .def("get_output_tensor", &ov::genai::T5EncoderModel::get_output_tensor, py::arg("idx"))
+        .def("get_num_cache_hits", &ov::genai::T5EncoderModel::get_num_cache_hits)
+        .def("get_num_cache_misses", &ov::genai::T5EncoderModel::get_num_cache_misses)
         .def(
             "compile",
             [](ov::genai::T5EncoderModel& self,
@@ -544,6 +548,13 @@ void init_autoencoder_kl(py::module_& m) {
         .def("encode", &ov::genai::AutoencoderKL::encode, py::call_guard<py::gil_scoped_release>(), py::arg("image"), py::arg("generator"))
         .def("get_config", &ov::genai::AutoencoderKL::get_config)
         .def("get_vae_scale_factor", &ov::genai::AutoencoderKL::get_vae_scale_factor)
+        .def("set_tiling_config",
+            &ov::genai::AutoencoderKL::set_tiling_config,
+            py::arg("tiling_config"),
+            R"(
+                Makes decode() and encode() process images by overlapping tiles to bound memory consumed by the VAE.
+                tiling_config (VAETilingConfig | None): Tiling configuration, None processes whole images.
+            )")
         .def("export_model",
             &ov::genai::AutoencoderKL::export_model,
             py::arg("export_path"),
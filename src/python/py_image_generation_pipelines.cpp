@@ -87,6 +87,7 @@ auto image_generation_perf_metrics_docstring = R"(
     - inference durations for each encoder, ms
     - inference duration of vae_encoder model, ms
     - inference duration of vae_decoder model, ms
+    - text encoder cache hits and misses
 
     Preferable way to access values is via get functions. Getters calculate mean and std values from raw_metrics and return pairs.
     If mean and std were already calculated, getters return cached values.
@@ -124,6 +125,12 @@ auto image_generation_perf_metrics_docstring = R"(
     :param get_first_and_other_trans_infer_duration: Returns the first inference duration and the average duration of other inferences in one generation in milliseconds.
     :type get_first_and_other_trans_infer_duration: tuple
 
+    :param text_encoder_cache_hits: The number of prompts whose text encoder outputs were taken from the text encoder cache enabled by TEXT_ENCODER_CACHE_SIZE_MB environment variable.
+    :type text_encoder_cache_hits: int
+
+    :param text_encoder_cache_misses: The number of prompts encoded by text encoders while the text encoder cache is enabled.
+    :type text_encoder_cache_misses: int
+
     :param get_transformer_infer_duration: Returns the mean and standard deviation of one transformer inference in milliseconds.
     :type get_transformer_infer_duration: MeanStdPair
 
@@ -329,13 +336,15 @@ void init_image_generation_pipelines(py::module_& m) {
 
     py::class_<ov::genai::TaylorSeerCacheConfig>(
         m, "TaylorSeerCacheConfig",
-        "Configuration for TaylorSeer cache mechanism in diffusion transformers.\n\n"
+        "Configuration for TaylorSeer cache mechanism in diffusion UNets and transformers.\n\n"
         "See paper: https://arxiv.org/pdf/2503.06923\n\n"
         "Attributes:\n"
         "  cache_interval: Interval between full computation steps (default: 3, must be >= 2)\n"
         "  disable_cache_before_step: Step before which caching is disabled for warmup (default: 6)\n"
         "  disable_cache_after_step: Step after which caching is disabled. If negative, "
-        "calculated as num_inference_steps + disable_cache_after_step (default: -2)")
+        "calculated as num_inference_steps + disable_cache_after_step (default: -2)\n"
+        "  order: Order of the Taylor expansion which predicts the cached steps, 0 reuses the last computed output "
+        "and 1 extrapolates the last two computed outputs linearly (default: 1)")
         .def(py::init<>())
         .def_readwrite("cache_interval", &ov::genai::TaylorSeerCacheConfig::cache_interval,
                       "Interval between full computation steps (must be >= 2)")
@@ -343,9 +352,34 @@ void init_image_generation_pipelines(py::module_& m) {
                       "Step before which caching is disabled for warmup")
         .def_readwrite("disable_cache_after_step", &ov::genai::TaylorSeerCacheConfig::disable_cache_after_step,
                       "Step after which caching is disabled (negative values are relative to num_inference_steps)")
+        .def_readwrite("order", &ov::genai::TaylorSeerCacheConfig::order,
+                      "Order of the Taylor expansion which predicts the cached steps (0 or 1)")
         .def("to_string", &ov::genai::TaylorSeerCacheConfig::to_string)
         .def("__repr__", &ov::genai::TaylorSeerCacheConfig::to_string);
 
+    py::class_<ov::genai::VAETilingConfig>(
+        m, "VAETilingConfig",
+        "Configuration of tiled VAE inference, which processes overlapping tiles of images and videos to bound VAE memory consumption.\n\n"
+        "Attributes:\n"
+        "  tile_size: Height and width of tiles in pixels (default: 512)\n"
+        "  tile_overlap: Minimal overlap of neighbouring tiles in pixels (default: 128)\n"
+        "  tile_num_frames: Number of video frames per tile, used by video VAEs only (default: 33)\n"
+        "  frame_overlap: Minimal overlap of neighbouring tiles in video frames, used by video VAEs only (default: 8)\n"
+        "  num_infer_requests: Number of infer requests which process tiles in parallel (default: 1)")
+        .def(py::init<>())
+        .def_readwrite("tile_size", &ov::genai::VAETilingConfig::tile_size,
+                      "Height and width of tiles in pixels")
+        .def_readwrite("tile_overlap", &ov::genai::VAETilingConfig::tile_overlap,
+                      "Minimal overlap of neighbouring tiles in pixels")
+        .def_readwrite("tile_num_frames", &ov::genai::VAETilingConfig::tile_num_frames,
+                      "Number of video frames per tile")
+        .def_readwrite("frame_overlap", &ov::genai::VAETilingConfig::frame_overlap,
+                      "Minimal overlap of neighbouring tiles in video frames")
+        .def_readwrite("num_infer_requests", &ov::genai::VAETilingConfig::num_infer_requests,
+                      "Number of infer requests which process tiles in parallel")
+        .def("to_string", &ov::genai::VAETilingConfig::to_string)
+        .def("__repr__", &ov::genai::VAETilingConfig::to_string);
+
     py::class_<ov::genai::ImageGenerationConfig>(m, "ImageGenerationConfig", "This class is used for storing generation config for image generation pipeline.")
         .def(py::init<>())
         .def_readwrite("prompt_2", &ov::genai::ImageGenerationConfig::prompt_2)
@@ -364,6 +398,7 @@ void init_image_generation_pipelines(py::module_& m) {
         .def_readwrite("strength", &ov::genai::ImageGenerationConfig::strength)
         .def_readwrite("max_sequence_length", &ov::genai::ImageGenerationConfig::max_sequence_length)
         .def_readwrite("taylorseer_config", &ov::genai::ImageGenerationConfig::taylorseer_config)
+        .def_readwrite("vae_tiling_config", &ov::genai::ImageGenerationConfig::vae_tiling_config)
         .def("validate", &ov::genai::ImageGenerationConfig::validate)
         .def("update_generation_config", [](
             ov::genai::ImageGenerationConfig& config,
@@ -411,6 +446,8 @@ void init_image_generation_pipelines(py::module_& m) {
             return py::make_tuple(first_infer_time, other_infer_avg_time);
         })
         .def("get_unet_infer_duration", &ImageGenerationPerfMetrics::get_unet_infer_duration)
+        .def_readonly("text_encoder_cache_hits", &ImageGenerationPerfMetrics::text_encoder_cache_hits)
+        .def_readonly("text_encoder_cache_misses", &ImageGenerationPerfMetrics::text_encoder_cache_misses)
         .def_readonly("raw_metrics", &ImageGenerationPerfMetrics::raw_metrics);
 
     auto text2image_pipeline = py::class_<ov::genai::Text2ImagePipeline>(m, "Text2ImagePipeline", "This class is used for generation with text-to-image models.")
@@ -443,6 +480,26 @@ void init_image_generation_pipelines(py::module_& m) {
         .def("set_generation_config", &ov::genai::Text2ImagePipeline::set_generation_config, py::arg("config"))
         .def("set_scheduler", &ov::genai::Text2ImagePipeline::set_scheduler, py::arg("scheduler"))
         .def("reshape", &ov::genai::Text2ImagePipeline::reshape, py::arg("num_images_per_prompt"), py::arg("height"), py::arg("width"), py::arg("guidance_scale"))
+        .def("enable_step_batching",
+            &ov::genai::Text2ImagePipeline::enable_step_batching,
+            py::arg("max_batch_size") = 8,
+            R"(
+                Enables step-level batching of generate() calls made concurrently by several threads, which then share this pipeline.
+                Latents of requests with the same resolution are denoised by one UNet inference per step, each request keeping its own
+                scheduler state, timesteps and guidance scale. Requests join and leave the batch between denoising steps.
+                Supported for Stable Diffusion and Latent Consistency Model pipelines with UNet accepting dynamic batch size.
+                Requests use clones of the current scheduler; set_scheduler(), set_generation_config(), reshape() and compile() throw afterwards.
+                max_batch_size (int): Maximum batch size of UNet inference.
+            )")
+        .def("enable_pipelined_generation",
+            &ov::genai::Text2ImagePipeline::enable_pipelined_generation,
+            py::arg("max_in_flight_requests") = 4,
+            R"(
+                Enables pipelined execution of generate() calls made concurrently by several threads, which then share this pipeline.
+                Text encoding, denoising and VAE decoding run in background threads, so that the VAE decoding of a request overlaps
+                the denoising of the next one and the text encoding of the one after it. Must be called after the pipeline is compiled.
+                max_in_flight_requests (int): Maximum number of requests processed by all stages at once.
+            )")
         .def_static("stable_diffusion", &ov::genai::Text2ImagePipeline::stable_diffusion, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("unet"), py::arg("vae"))
         .def_static("latent_consistency_model", &ov::genai::Text2ImagePipeline::latent_consistency_model, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("unet"), py::arg("vae"))
         .def_static("stable_diffusion_xl", &ov::genai::Text2ImagePipeline::stable_diffusion_xl, py::arg("scheduler"), py::arg("clip_text_model"), py::arg("clip_text_model_with_projection"), py::arg("unet"), py::arg("vae"))
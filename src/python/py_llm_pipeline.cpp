@@ -256,6 +256,9 @@ void init_llm_pipeline(py::module_& m) {
                          1);
             pipe.finish_chat();
         })
+        .def("create_session", &LLMPipeline::create_session, py::arg("session_id"))
+        .def("resume_session", &LLMPipeline::resume_session, py::arg("session_id"))
+        .def("close_session", &LLMPipeline::close_session, py::arg("session_id"))
         .def("get_generation_config", &LLMPipeline::get_generation_config, py::return_value_policy::copy)
         .def("set_generation_config", &LLMPipeline::set_generation_config, py::arg("config"));
 
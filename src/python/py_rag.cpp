@@ -34,6 +34,10 @@ Attributes:
         Useful for database population. If set, the pipeline will fix model shape for inference optimization.
         Number of documents passed to pipeline should be equal to batch_size.
         For query embeddings, batch_size should be set to 1 or not set.
+    max_batch_tokens (int, optional):
+        Max number of tokens, including padding, in a single inference of the embedding model.
+        If set, documents are sorted by length and split into micro batches fitting the budget, which run
+        concurrently on several infer requests. Not compatible with batch_size and pad_to_max_length.
     pooling_type (TextEmbeddingPipeline.PoolingType, optional):
         Pooling strategy applied to the model output tensor. Defaults to PoolingType.CLS.
     normalize (bool, optional):
@@ -57,6 +61,10 @@ Attributes:
         If 'True', model input tensors are padded to the maximum length.
     padding_side (str, optional):
         Side to use for padding "left" or "right"
+    max_batch_tokens (int, optional):
+        Max number of tokens, including padding, in a single inference of the rerank model.
+        If set, documents are sorted by length and split into micro batches fitting the budget, which run
+        concurrently on several infer requests. Not compatible with pad_to_max_length.
 )";
 
 }  // namespace
@@ -148,6 +156,7 @@ void init_rag_pipelines(py::module_& m) {
         .def_readwrite("max_length", &TextEmbeddingPipeline::Config::max_length)
         .def_readwrite("pad_to_max_length", &TextEmbeddingPipeline::Config::pad_to_max_length)
         .def_readwrite("batch_size", &TextEmbeddingPipeline::Config::batch_size)
+        .def_readwrite("max_batch_tokens", &TextEmbeddingPipeline::Config::max_batch_tokens)
         .def_readwrite("pooling_type", &TextEmbeddingPipeline::Config::pooling_type)
         .def_readwrite("normalize", &TextEmbeddingPipeline::Config::normalize)
         .def_readwrite("query_instruction", &TextEmbeddingPipeline::Config::query_instruction)
@@ -232,7 +241,8 @@ kwargs: Plugin and/or config properties
         .def_readwrite("top_n", &ov::genai::TextRerankPipeline::Config::top_n)
         .def_readwrite("max_length", &ov::genai::TextRerankPipeline::Config::max_length)
         .def_readwrite("pad_to_max_length", &ov::genai::TextRerankPipeline::Config::pad_to_max_length)
-        .def_readwrite("padding_side", &ov::genai::TextRerankPipeline::Config::padding_side);
+        .def_readwrite("padding_side", &ov::genai::TextRerankPipeline::Config::padding_side)
+        .def_readwrite("max_batch_tokens", &ov::genai::TextRerankPipeline::Config::max_batch_tokens);
 
     text_rerank_pipeline.def(
         py::init([](const std::filesystem::path& models_path,
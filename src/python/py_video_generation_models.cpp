@@ -187,6 +187,13 @@ void init_autoencoder_kl_ltx_video(py::module_& m) {
 
     vae.def("get_config", &ov::genai::AutoencoderKLLTXVideo::get_config)
         .def("get_vae_scale_factor", &ov::genai::AutoencoderKLLTXVideo::get_vae_scale_factor)
+        .def("set_tiling_config",
+             &ov::genai::AutoencoderKLLTXVideo::set_tiling_config,
+             py::arg("tiling_config"),
+             R"(
+                Makes decode() process videos by overlapping spatio-temporal tiles to bound memory consumed by the VAE.
+                tiling_config (VAETilingConfig | None): Tiling configuration, None decodes whole videos.
+            )")
         .def(
             "compile",
             [](ov::genai::AutoencoderKLLTXVideo& self, const std::string& device, const py::kwargs& kwargs) {
@@ -214,7 +221,7 @@ void init_autoencoder_kl_ltx_video(py::module_& m) {
                 width (int): Video width.
             )")
         .def("decode",
-             &ov::genai::AutoencoderKLLTXVideo::decode,
+             py::overload_cast<const ov::Tensor&>(&ov::genai::AutoencoderKLLTXVideo::decode),
              py::call_guard<py::gil_scoped_release>(),
              py::arg("latent"),
              R"(
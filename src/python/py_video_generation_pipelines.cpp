@@ -24,6 +24,8 @@ void init_video_generation_pipelines(py::module_& m) {
         .def_readwrite("guidance_rescale", &ov::genai::VideoGenerationConfig::guidance_rescale)
         .def_readwrite("num_frames", &ov::genai::VideoGenerationConfig::num_frames)
         .def_readwrite("frame_rate", &ov::genai::VideoGenerationConfig::frame_rate)
+        .def_readwrite("taylorseer_config", &ov::genai::VideoGenerationConfig::taylorseer_config)
+        .def_readwrite("vae_tiling_config", &ov::genai::VideoGenerationConfig::vae_tiling_config)
         .def_readwrite("num_videos_per_prompt", &ov::genai::VideoGenerationConfig::num_videos_per_prompt)
         .def_readwrite("negative_prompt", &ov::genai::VideoGenerationConfig::negative_prompt)
         .def_readwrite("generator", &ov::genai::VideoGenerationConfig::generator)
@@ -30,6 +30,8 @@ using ov::genai::WhisperGenerationConfig;
 using ov::genai::WhisperPerfMetrics;
 using ov::genai::WhisperPipeline;
 using ov::genai::WhisperRawPerfMetrics;
+using ov::genai::WhisperStreamingConfig;
+using ov::genai::WhisperStreamingResult;
 using ov::genai::WhisperWordTiming;
 
 namespace pyutils = ov::genai::pybind::utils;
@@ -224,6 +226,40 @@ auto perf_metrics_docstring = R"(
     :type WhisperRawPerfMetrics:
 )";
 
+auto whisper_generate_batch_docstring = R"(
+    Transcribes a batch of audio inputs. Encoder and decoder run on dynamic batches made of the next 30s chunks of the
+    inputs, the inputs whose transcription is finished drop out of the batch.
+
+    :param raw_speech_inputs: list of inputs, each of them is a list of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+    :type raw_speech_inputs: list[list[float]]
+
+    :param generation_config: generation_config, word-level timestamps are not supported for a batch
+    :type generation_config: WhisperGenerationConfig or a dict
+
+    :return: transcription of each input, performance metrics are the ones of the whole batch
+    :rtype: list[WhisperDecodedResults]
+)";
+
+auto whisper_streaming_config_docstring = R"(
+    Latency and window settings of an audio stream transcription.
+
+    :param step_length: length of new audio in seconds after which the stream is transcribed again, bounds the latency of results. Each step encodes a full 30 s input, so it must be longer than a step takes on the device, 1-2 s suits most devices.
+    :type step_length: float
+
+    :param max_window_length: once the transcribed window of audio is longer than this length in seconds, its start moves past the stable segments.
+    :type max_window_length: float
+)";
+
+auto whisper_streaming_result_docstring = R"(
+    Transcription of an audio stream received so far.
+
+    :param stable_text: text which became stable since the previous result, it isn't revised by the later audio.
+    :type stable_text: str
+
+    :param partial_text: hypothesis for the rest of the received audio, it's replaced by the partial text of the next result.
+    :type partial_text: str
+)";
+
 OptionalWhisperGenerationConfig update_whisper_config_from_kwargs(const OptionalWhisperGenerationConfig& config,
                                                                   const py::kwargs& kwargs) {
     if (!config.has_value() && kwargs.empty())
@@ -346,6 +382,20 @@ void init_whisper_pipeline(py::module_& m) {
             return res;
         });
 
+    py::class_<WhisperStreamingConfig>(m, "WhisperStreamingConfig", whisper_streaming_config_docstring)
+        .def(py::init<>())
+        .def_readwrite("step_length", &WhisperStreamingConfig::step_length)
+        .def_readwrite("max_window_length", &WhisperStreamingConfig::max_window_length);
+
+    py::class_<WhisperStreamingResult>(m, "WhisperStreamingResult", whisper_streaming_result_docstring)
+        .def(py::init<>())
+        .def_property_readonly("stable_text", [](const WhisperStreamingResult& result) {
+            return pyutils::handle_utf8(result.stable_text);
+        })
+        .def_property_readonly("partial_text", [](const WhisperStreamingResult& result) {
+            return pyutils::handle_utf8(result.partial_text);
+        });
+
     py::class_<WhisperPipeline>(m, "WhisperPipeline", "Automatic speech recognition pipeline")
         .def(
             py::init([](const std::filesystem::path& models_path, const std::string& device, const py::kwargs& kwargs) {
@@ -381,6 +431,80 @@ void init_whisper_pipeline(py::module_& m) {
             "streamer",
             (whisper_generate_docstring + std::string(" \n ") + whisper_generation_config_docstring).c_str())
 
+        .def(
+            "generate",
+            [](WhisperPipeline& pipe,
+               const std::vector<RawSpeechInput>& raw_speech_inputs,
+               const OptionalWhisperGenerationConfig& generation_config,
+               const py::kwargs& kwargs) {
+                OptionalWhisperGenerationConfig base_config =
+                    generation_config.has_value() ? generation_config : pipe.get_generation_config();
+                auto updated_config = update_whisper_config_from_kwargs(base_config, kwargs);
+
+                std::vector<WhisperDecodedResults> res;
+                {
+                    py::gil_scoped_release rel;
+                    res = pipe.generate(raw_speech_inputs, updated_config);
+                }
+                return res;
+            },
+            py::arg("raw_speech_inputs"),
+            "List of raw speech audios, each of them is a list of floats.",
+            py::arg("generation_config") = std::nullopt,
+            "generation_config",
+            whisper_generate_batch_docstring)
+
+        .def(
+            "start_stream",
+            [](WhisperPipeline& pipe,
+               const OptionalWhisperGenerationConfig& generation_config,
+               const std::optional<WhisperStreamingConfig>& streaming_config,
+               const py::kwargs& kwargs) {
+                OptionalWhisperGenerationConfig base_config =
+                    generation_config.has_value() ? generation_config : pipe.get_generation_config();
+                pipe.start_stream(update_whisper_config_from_kwargs(base_config, kwargs),
+                                  streaming_config.value_or(WhisperStreamingConfig{}));
+            },
+            py::arg("generation_config") = std::nullopt,
+            py::arg("streaming_config") = std::nullopt,
+            R"(
+            Starts transcription of an audio stream, which receives audio with push_audio() and is finished with
+            finish_stream(). A previous stream is dropped. Supported by the stateful pipeline only.
+
+            :param generation_config: generation_config, word-level timestamps are not supported for streams
+            :type generation_config: WhisperGenerationConfig or a dict
+
+            :param streaming_config: latency and window settings of the stream
+            :type streaming_config: WhisperStreamingConfig
+        )")
+        .def(
+            "push_audio",
+            [](WhisperPipeline& pipe, const RawSpeechInput& raw_speech_input) {
+                py::gil_scoped_release rel;
+                return pipe.push_audio(raw_speech_input);
+            },
+            py::arg("raw_speech_input"),
+            R"(
+            Appends audio to the stream and transcribes the received audio once step_length of new audio has arrived.
+
+            :param raw_speech_input: next samples of the stream. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+            :type raw_speech_input: list[float]
+
+            :return: text which became stable and the current partial text
+            :rtype: WhisperStreamingResult
+        )")
+        .def(
+            "finish_stream",
+            [](WhisperPipeline& pipe) {
+                py::gil_scoped_release rel;
+                return pipe.finish_stream();
+            },
+            R"(
+            Transcribes the rest of the stream and finishes it.
+
+            :return: the rest of the stable text with empty partial text
+            :rtype: WhisperStreamingResult
+        )")
         .def("get_tokenizer", &WhisperPipeline::get_tokenizer)
         .def("get_generation_config", &WhisperPipeline::get_generation_config, py::return_value_policy::copy)
         .def("set_generation_config", &WhisperPipeline::set_generation_config, py::arg("config"));
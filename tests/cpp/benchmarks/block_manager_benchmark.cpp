@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Measures the cost of BlockManager bookkeeping done by the scheduler at each generation step
+// (required_blocks_count and append_slots) for a batch of long running sequences.
+//
+// Usage: block_manager_benchmark [num_sequences=256] [context_len=131072] [num_decode_steps=64] [block_size=32] [enable_prefix_caching=0]
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "continuous_batching/block_manager.hpp"
+#include "sequence_group.hpp"
+#include "utils.hpp"
+
+namespace {
+
+size_t get_arg(int argc, char* argv[], int idx, size_t default_value) {
+    return argc > idx ? std::stoul(argv[idx]) : default_value;
+}
+
+double elapsed_ms(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t num_sequences = get_arg(argc, argv, 1, 256);
+    const size_t context_len = get_arg(argc, argv, 2, 131072);
+    const size_t num_decode_steps = get_arg(argc, argv, 3, 64);
+    const size_t block_size = get_arg(argc, argv, 4, 32);
+    const bool enable_prefix_caching = get_arg(argc, argv, 5, 0) != 0;
+
+    const size_t blocks_per_sequence = (context_len + num_decode_steps + block_size - 1) / block_size + 1;
+    ov::genai::BlockManager block_manager(num_sequences * blocks_per_sequence, enable_prefix_caching, block_size);
+
+    std::vector<ov::genai::SequenceGroup::Ptr> sequence_groups;
+    sequence_groups.reserve(num_sequences);
+    for (size_t request_id = 0; request_id < num_sequences; ++request_id) {
+        // distinct prompts, so that prefix caching does not share blocks between sequences
+        ov::genai::TokenIds prompt_ids(context_len, static_cast<int64_t>(request_id));
+        sequence_groups.push_back(std::make_shared<ov::genai::SequenceGroup>(request_id,
+                                                                             prompt_ids,
+                                                                             ov::genai::utils::get_greedy_config(),
+                                                                             block_size));
+    }
+
+    auto prefill_start = std::chrono::steady_clock::now();
+    for (auto& sequence_group : sequence_groups) {
+        sequence_group->schedule_tokens(context_len);
+        block_manager.append_slots(sequence_group);
+        sequence_group->finish_iteration();
+        sequence_group->get_running_sequences()[0]->append_token(0, 0.f);
+    }
+    double prefill_ms = elapsed_ms(prefill_start);
+
+    double required_blocks_ms = 0, append_slots_ms = 0;
+    size_t required_blocks = 0;
+    for (size_t step = 0; step < num_decode_steps; ++step) {
+        for (auto& sequence_group : sequence_groups) {
+            sequence_group->schedule_tokens(1);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (auto& sequence_group : sequence_groups) {
+            required_blocks += block_manager.required_blocks_count(sequence_group);
+        }
+        required_blocks_ms += elapsed_ms(start);
+
+        start = std::chrono::steady_clock::now();
+        for (auto& sequence_group : sequence_groups) {
+            block_manager.append_slots(sequence_group);
+        }
+        append_slots_ms += elapsed_ms(start);
+
+        for (auto& sequence_group : sequence_groups) {
+            sequence_group->finish_iteration();
+            sequence_group->get_running_sequences()[0]->append_token(0, 0.f);
+        }
+    }
+
+    auto free_start = std::chrono::steady_clock::now();
+    for (auto& sequence_group : sequence_groups) {
+        block_manager.free_sequence(sequence_group->get_running_sequences()[0]->get_id());
+    }
+    double free_ms = elapsed_ms(free_start);
+
+    std::cout << "Sequences: " << num_sequences << ", context length: " << context_len << ", block size: " << block_size
+              << ", prefix caching: " << (enable_prefix_caching ? "on" : "off") << std::endl;
+    std::cout << "Prefill allocation: " << prefill_ms << " ms" << std::endl;
+    std::cout << "required_blocks_count per step: " << required_blocks_ms / num_decode_steps << " ms" << std::endl;
+    std::cout << "append_slots per step: " << append_slots_ms / num_decode_steps << " ms" << std::endl;
+    std::cout << "Blocks allocated during decoding: " << required_blocks << std::endl;
+    std::cout << "Free all sequences: " << free_ms << " ms" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Measures log-mel spectrogram extraction done by WhisperFeatureExtractor for long audio, which is dominated by
+// the per-frame FFT and mel filter bank multiply.
+//
+// Usage: whisper_feature_extractor_benchmark [audio_seconds=3600] [num_iterations=3]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "whisper/feature_extractor.hpp"
+
+namespace {
+
+size_t get_arg(int argc, char* argv[], int idx, size_t default_value) {
+    return argc > idx ? std::stoul(argv[idx]) : default_value;
+}
+
+double elapsed_ms(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t audio_seconds = get_arg(argc, argv, 1, 3600);
+    const size_t num_iterations = get_arg(argc, argv, 2, 3);
+
+    // defaults are used if preprocessor_config.json doesn't exist
+    ov::genai::WhisperFeatureExtractor feature_extractor("");
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> noise(-0.05f, 0.05f);
+    std::vector<float> raw_speech(audio_seconds * feature_extractor.sampling_rate);
+    for (size_t i = 0; i < raw_speech.size(); ++i) {
+        raw_speech[i] = 0.5f * std::sin(0.05f * static_cast<float>(i)) + noise(rng);
+    }
+
+    double best_ms = 0.0;
+    size_t n_frames = 0;
+    for (size_t iteration = 0; iteration < num_iterations; ++iteration) {
+        auto start = std::chrono::steady_clock::now();
+        n_frames = feature_extractor.extract(raw_speech).n_frames;
+        const double iteration_ms = elapsed_ms(start);
+        best_ms = iteration == 0 ? iteration_ms : std::min(best_ms, iteration_ms);
+    }
+
+    std::cout << "audio: " << audio_seconds << " s, frames: " << n_frames << std::endl;
+    std::cout << "extract: " << best_ms << " ms (best of " << num_iterations << "), "
+              << best_ms * 1000.0 / n_frames << " us/frame, realtime factor "
+              << audio_seconds * 1000.0 / best_ms << "x" << std::endl;
+    return 0;
+}
@@ -52,3 +52,28 @@ TEST(TestBlockHashStore, general_test) {
     EXPECT_TRUE(block_hash_store.get_lru_block_to_overwrite().empty());
     EXPECT_EQ(block_hash_store.num_blocks(), 0);
 }
+
+TEST(TestBlockHashStore, lru_order_after_restore_and_readd) {
+    ov::genai::OverwritableBlocksHashStore block_hash_store(1);
+    std::vector<ov::genai::KVCacheBlock::Ptr> blocks;
+    for (int i = 0; i < 3; i++) {
+        auto block = std::make_shared<ov::genai::KVCacheBlock>(i);
+        block->set_hash(100 + i);
+        block->set_timestamp(std::chrono::steady_clock::now() + std::chrono::seconds(i));
+        block_hash_store.add(ov::genai::BlocksPerLayer{block});
+        blocks.push_back(block);
+    }
+
+    // restoring the oldest block refreshes its timestamp, so it must become the most recently used one after re-adding
+    auto restored = block_hash_store.get_block_to_restore(100);
+    ASSERT_EQ(restored.size(), 1);
+    restored[0]->set_timestamp(std::chrono::steady_clock::now() + std::chrono::seconds(10));
+    restored[0]->release();
+    block_hash_store.add(restored);
+    EXPECT_EQ(block_hash_store.num_blocks(), 3);
+
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 1);
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 2);
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 0);
+    EXPECT_TRUE(block_hash_store.get_lru_block_to_overwrite().empty());
+}
@@ -111,3 +111,39 @@ TEST(TestBlockManager, CanFreeBlocksFromSequence) {
         bm.free_sequence(sequence->get_id());
     }
 }
+
+TEST(TestBlockManager, block_table_version_changes_only_when_blocks_are_replaced_or_removed) {
+    ov::genai::BlockManager bm = ov::genai::BlockManager(8, false, 4);
+    ov::genai::TokenIds prompt_ids = {10, 0};
+
+    ov::genai::SequenceGroup::Ptr sequence_group =
+        std::make_shared<ov::genai::SequenceGroup>(0,
+                                                   ov::Tensor(ov::element::i64, {prompt_ids.size()}, prompt_ids.data()),
+                                                   ov::genai::utils::get_beam_search_config(),
+                                                   4);
+    auto sequence = sequence_group->get_not_finished_sequences()[0];
+    auto seq_id = sequence->get_id();
+    bm.allocate(sequence, 2);
+    size_t version = bm.get_block_table_version(seq_id);
+
+    bm.allocate(sequence, 2);
+    EXPECT_EQ(bm.get_block_table_version(seq_id), version);
+
+    bm.free_sequence_partially(seq_id, 1);
+    EXPECT_NE(bm.get_block_table_version(seq_id), version);
+    version = bm.get_block_table_version(seq_id);
+
+    bm.free_blocks_from_sequence(seq_id, {{0}});
+    EXPECT_NE(bm.get_block_table_version(seq_id), version);
+    version = bm.get_block_table_version(seq_id);
+
+    // a block table re-created for the same sequence gets a new version
+    bm.free_sequence(seq_id);
+    bm.allocate(sequence, 1);
+    EXPECT_NE(bm.get_block_table_version(seq_id), version);
+
+    bm.fork_sequence(seq_id, 1);
+    EXPECT_NE(bm.get_block_table_version(1), bm.get_block_table_version(seq_id));
+    bm.free_sequence(seq_id);
+    bm.free_sequence(1);
+}
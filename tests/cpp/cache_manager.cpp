@@ -106,3 +106,144 @@ TEST(TestCacheManager, test_dynamic_cache_increase) {
     cache_manager->allocate_cache_if_needed(block_manager.get_total_number_of_kv_blocks());
     ASSERT_EQ(get_total_allocated_bytes(cache_manager), 200 * block_size_in_bytes);
 }
+
+
+TEST(TestCacheManager, test_dynamic_cache_increase_keeps_blocks_in_place) {
+    ov::Core core;
+    const size_t num_decoder_layers = 12;
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request);
+    cache_manager->allocate_cache_if_needed(100);
+
+    std::vector<const void*> cache_data;
+    for (size_t i = 0; i < num_decoder_layers; i++) {
+        for (auto cache : {cache_manager->get_key_cache(i), cache_manager->get_value_cache(i)}) {
+            std::memset(cache.data(), static_cast<int>(i + 1), cache.get_byte_size());
+            cache_data.push_back(cache.data());
+        }
+    }
+
+    cache_manager->allocate_cache_if_needed(200);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 200 * cache_manager->get_block_size_in_bytes());
+
+    // caches grow without moving, and the blocks allocated before keep their contents
+    size_t cache_idx = 0;
+    for (size_t i = 0; i < num_decoder_layers; i++) {
+        for (auto cache : {cache_manager->get_key_cache(i), cache_manager->get_value_cache(i)}) {
+            ASSERT_EQ(cache.data(), cache_data[cache_idx++]);
+            const uint8_t* data = static_cast<const uint8_t*>(cache.data());
+            ASSERT_TRUE(std::all_of(data, data + cache.get_byte_size() / 2, [&](uint8_t value) { return value == i + 1; }));
+        }
+    }
+}
+
+
+TEST(TestCacheManager, test_cache_grows_from_empty) {
+    ov::Core core;
+    const size_t num_decoder_layers = 12;
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request);
+    // the block size is known before any block is allocated
+    const size_t block_data_size = cache_manager->get_block_data_size_in_bytes();
+    ASSERT_EQ(block_data_size, cache_manager->get_block_size_in_bytes());
+
+    cache_manager->allocate_cache_if_needed(1);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), cache_manager->get_block_size_in_bytes());
+    ASSERT_EQ(cache_manager->get_block_data_size_in_bytes(), block_data_size);
+
+    // and after the cache is cleared, so that it grows from 0 blocks again
+    cache_manager->clear();
+    ASSERT_EQ(cache_manager->get_block_data_size_in_bytes(), block_data_size);
+    cache_manager->allocate_cache_if_needed(10);
+    ASSERT_EQ(cache_manager->get_num_allocated_kv_blocks(), 10);
+    ASSERT_EQ(get_total_allocated_bytes(cache_manager), 10 * cache_manager->get_block_size_in_bytes());
+}
+
+
+TEST(TestCacheManager, test_swap_out_and_swap_in) {
+    ov::Core core;
+    const size_t num_decoder_layers = 12;
+    const size_t num_kv_blocks = 8;
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request);
+    size_t block_size_in_bytes = cache_manager->get_block_size_in_bytes();
+    cache_manager->allocate_cache_if_needed(num_kv_blocks);
+    cache_manager->set_swap_space(2 * block_size_in_bytes);
+
+    // fill each block with its index
+    auto fill_cache = [&](bool zero) {
+        for (size_t i = 0; i < num_decoder_layers; i++) {
+            for (auto cache : {cache_manager->get_key_cache(i), cache_manager->get_value_cache(i)}) {
+                size_t cache_block_size = cache.get_byte_size() / num_kv_blocks;
+                for (size_t block_idx = 0; block_idx < num_kv_blocks; block_idx++) {
+                    std::memset(static_cast<uint8_t*>(cache.data()) + block_idx * cache_block_size, zero ? 0 : block_idx, cache_block_size);
+                }
+            }
+        }
+    };
+    fill_cache(false);
+
+    ASSERT_TRUE(cache_manager->can_swap_out(2));
+    ASSERT_FALSE(cache_manager->can_swap_out(3));
+    cache_manager->swap_out(0, std::vector<std::vector<size_t>>(num_decoder_layers, {1, 5}));
+    ASSERT_TRUE(cache_manager->is_swapped_out(0));
+    ASSERT_EQ(cache_manager->get_num_swapped_blocks(0), 2);
+    ASSERT_EQ(cache_manager->get_used_swap_space(), 2 * block_size_in_bytes);
+    ASSERT_FALSE(cache_manager->can_swap_out(1));
+
+    // blocks are reused by other sequences, then swapped out content is restored to other blocks
+    fill_cache(true);
+    cache_manager->swap_in(0, std::vector<std::vector<size_t>>(num_decoder_layers, {6, 2}));
+    ASSERT_FALSE(cache_manager->is_swapped_out(0));
+    ASSERT_EQ(cache_manager->get_used_swap_space(), 0);
+
+    const std::map<size_t, uint8_t> ref_block_values = {{6, 1}, {2, 5}, {0, 0}, {1, 0}, {5, 0}};
+    for (size_t i = 0; i < num_decoder_layers; i++) {
+        for (auto cache : {cache_manager->get_key_cache(i), cache_manager->get_value_cache(i)}) {
+            size_t cache_block_size = cache.get_byte_size() / num_kv_blocks;
+            for (const auto& [block_idx, ref_value] : ref_block_values) {
+                const uint8_t* block_data = static_cast<const uint8_t*>(cache.data()) + block_idx * cache_block_size;
+                ASSERT_TRUE(std::all_of(block_data, block_data + cache_block_size, [&](uint8_t value) { return value == ref_value; }));
+            }
+        }
+    }
+}
+
+
+TEST(TestCacheManager, test_copy_blocks) {
+    ov::Core core;
+    const size_t num_decoder_layers = 12;
+    const size_t num_kv_blocks = 8;
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request);
+    cache_manager->allocate_cache_if_needed(num_kv_blocks);
+
+    // fill each block with its index
+    for (size_t i = 0; i < num_decoder_layers; i++) {
+        for (auto cache : {cache_manager->get_key_cache(i), cache_manager->get_value_cache(i)}) {
+            size_t cache_block_size = cache.get_byte_size() / num_kv_blocks;
+            for (size_t block_idx = 0; block_idx < num_kv_blocks; block_idx++) {
+                std::memset(static_cast<uint8_t*>(cache.data()) + block_idx * cache_block_size, block_idx, cache_block_size);
+            }
+        }
+    }
+
+    const std::map<size_t, std::list<size_t>> block_copy_map = {{1, {3, 5}}, {2, {7}}};
+    ASSERT_EQ(cache_manager->copy_blocks(block_copy_map), 3 * cache_manager->get_block_size_in_bytes());
+    ASSERT_EQ(cache_manager->copy_blocks({}), 0);
+
+    const std::vector<uint8_t> ref_block_values = {0, 1, 2, 1, 4, 1, 6, 2};
+    for (size_t i = 0; i < num_decoder_layers; i++) {
+        for (auto cache : {cache_manager->get_key_cache(i), cache_manager->get_value_cache(i)}) {
+            size_t cache_block_size = cache.get_byte_size() / num_kv_blocks;
+            for (size_t block_idx = 0; block_idx < num_kv_blocks; block_idx++) {
+                const uint8_t* block_data = static_cast<const uint8_t*>(cache.data()) + block_idx * cache_block_size;
+                ASSERT_TRUE(std::all_of(block_data, block_data + cache_block_size, [&](uint8_t value) { return value == ref_block_values[block_idx]; }));
+            }
+        }
+    }
+}
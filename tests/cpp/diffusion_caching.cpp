@@ -509,3 +509,81 @@ TEST_F(TaylorSeerStateTest, NoUpdateInCoolDownPhase) {
     auto expected_factor_0 = CreateTestTensor({3.0f, 6.0f, 9.0f});
     AssertTensorsEqual(state.get_taylor_factor(0), expected_factor_0);
 }
+
+TEST_F(TaylorSeerCacheConfigTest, ToStringContainsOrder) {
+    TaylorSeerCacheConfig config{3, 6, -2, 0};
+    EXPECT_NE(config.to_string().find("order: 0"), std::string::npos);
+}
+
+TEST_F(TaylorSeerCacheConfigTest, InvalidOrder) {
+    TaylorSeerCacheConfig config{3, 0, -1, 2};
+    EXPECT_THROW(
+        {
+            TaylorSeerState state(config, 10);
+            (void)state;
+        },
+        ov::Exception);
+}
+
+TEST_F(TaylorSeerStateTest, ZeroOrderNeedsSingleWarmupStep) {
+    TaylorSeerCacheConfig config{3, 0, -2, 0};
+    TaylorSeerState state(config, 10);
+    EXPECT_TRUE(state.is_active());
+    // Warmup is max(0, 1) = 1, so only step 0 computes
+    EXPECT_TRUE(state.should_compute(0));
+    EXPECT_FALSE(state.should_compute(1));
+    EXPECT_FALSE(state.should_compute(2));
+    EXPECT_TRUE(state.should_compute(3));
+}
+
+TEST_F(TaylorSeerStateTest, ZeroOrderReusesLastOutput) {
+    TaylorSeerCacheConfig config{3, 0, -2, 0};
+    TaylorSeerState state(config, 10);
+
+    auto tensor1 = CreateTestTensor({1.0f, 4.0f});
+    auto tensor2 = CreateTestTensor({3.0f, 6.0f});
+
+    state.update(0, tensor1);
+    // A single update is enough to predict
+    AssertTensorsEqual(state.predict(2), tensor1);
+    EXPECT_THROW(state.get_taylor_factor(1), ov::Exception);
+
+    state.update(3, tensor2);
+    AssertTensorsEqual(state.predict(5), tensor2);
+}
+
+TEST_F(TaylorSeerStateTest, InferOrPredictSkipsCachedSteps) {
+    TaylorSeerCacheConfig config{3, 2, -2};
+    TaylorSeerState state(config, 10);
+
+    std::vector<size_t> computed_steps;
+    std::vector<float> outputs;
+    for (size_t step = 0; step < 10; ++step) {
+        ov::Tensor output = state.infer_or_predict(step, [&] {
+            computed_steps.push_back(step);
+            // the denoiser output grows linearly with the step, so the prediction is exact
+            return CreateTestTensor({2.0f * step + 1.0f});
+        });
+        outputs.push_back(output.data<float>()[0]);
+    }
+
+    EXPECT_EQ(computed_steps, (std::vector<size_t>{0, 1, 4, 7, 8, 9}));
+    for (size_t step = 0; step < 10; ++step) {
+        EXPECT_FLOAT_EQ(outputs[step], 2.0f * step + 1.0f) << "Mismatch at step " << step;
+    }
+}
+
+TEST_F(TaylorSeerStateTest, InferOrPredictComputesEveryStepWhenInactive) {
+    TaylorSeerState state(std::nullopt, 5);
+
+    size_t num_computed_steps = 0;
+    for (size_t step = 0; step < 5; ++step) {
+        ov::Tensor output = state.infer_or_predict(step, [&] {
+            ++num_computed_steps;
+            return CreateTestTensor({static_cast<float>(step)});
+        });
+        EXPECT_FLOAT_EQ(output.data<float>()[0], static_cast<float>(step));
+    }
+    EXPECT_EQ(num_computed_steps, 5);
+    EXPECT_FALSE(state.get_last_update_step().has_value());
+}
@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <filesystem>
+
+#include "visual_language/encoded_image_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+EncodedImage make_encoded_image(float value, size_t num_tokens = 4) {
+    EncodedImage encoded_image;
+    encoded_image.resized_source = ov::Tensor(ov::element::f32, {1, num_tokens, 2});
+    std::fill_n(encoded_image.resized_source.data<float>(), encoded_image.resized_source.get_size(), value);
+    encoded_image.resized_source_size = {2, 3};
+    encoded_image.original_image_size = {20, 30};
+    encoded_image.patches_grid = {1, 2};
+    encoded_image.num_image_tokens = num_tokens;
+    return encoded_image;
+}
+
+ov::Tensor make_image(uint8_t value) {
+    ov::Tensor image(ov::element::u8, {1, 4, 4, 3});
+    std::fill_n(image.data<uint8_t>(), image.get_size(), value);
+    return image;
+}
+}  // namespace
+
+TEST(TestEncodedImageCache, keys_depend_on_model_and_content) {
+    const auto key = EncodedImageCache::compute_key(1, make_image(1));
+    EXPECT_EQ(key, EncodedImageCache::compute_key(1, make_image(1)));
+    EXPECT_NE(key, EncodedImageCache::compute_key(2, make_image(1)));
+    EXPECT_NE(key, EncodedImageCache::compute_key(1, make_image(2)));
+}
+
+TEST(TestEncodedImageCache, evicts_lru_images_over_budget) {
+    const size_t image_size = make_encoded_image(0.f).resized_source.get_byte_size();
+    EncodedImageCache cache(2 * image_size);
+    cache.put(1, make_encoded_image(1.f));
+    cache.put(2, make_encoded_image(2.f));
+    // image 1 becomes the most recently used one
+    ASSERT_TRUE(cache.get(1).has_value());
+
+    cache.put(3, make_encoded_image(3.f));
+    EXPECT_EQ(cache.num_entries(), 2);
+    EXPECT_EQ(cache.size_in_bytes(), 2 * image_size);
+    EXPECT_FALSE(cache.get(2).has_value());
+
+    auto encoded_image = cache.get(1);
+    ASSERT_TRUE(encoded_image.has_value());
+    EXPECT_EQ(encoded_image->resized_source.data<float>()[0], 1.f);
+}
+
+TEST(TestEncodedImageCache, restores_images_from_disk) {
+    auto cache_dir = std::filesystem::temp_directory_path() / "test_encoded_image_cache";
+    std::filesystem::remove_all(cache_dir);
+    {
+        EncodedImageCache cache(1024 * 1024, cache_dir);
+        cache.put(42, make_encoded_image(5.f, 3));
+    }
+
+    EncodedImageCache cache(1024 * 1024, cache_dir);
+    EXPECT_EQ(cache.num_entries(), 0);
+    auto encoded_image = cache.get(42);
+    ASSERT_TRUE(encoded_image.has_value());
+    EXPECT_EQ(cache.num_entries(), 1);
+    EXPECT_EQ(encoded_image->resized_source.get_shape(), ov::Shape({1, 3, 2}));
+    EXPECT_EQ(encoded_image->resized_source.data<float>()[5], 5.f);
+    EXPECT_EQ(encoded_image->resized_source_size.width, 3);
+    EXPECT_EQ(encoded_image->original_image_size.height, 20);
+    EXPECT_EQ(encoded_image->patches_grid.second, 2);
+    EXPECT_EQ(encoded_image->num_image_tokens, 3);
+    EXPECT_FALSE(encoded_image->images_features_projection);
+    EXPECT_FALSE(cache.get(43).has_value());
+    std::filesystem::remove_all(cache_dir);
+}
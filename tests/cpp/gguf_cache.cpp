@@ -0,0 +1,185 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_GGUF
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "openvino/openvino.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/parameter.hpp"
+#include "gguf_utils/gguf.hpp"
+#include "gguf_utils/gguf_modeling.hpp"
+
+namespace {
+
+constexpr size_t GGUF_ALIGNMENT = 32;
+
+struct GGUFTestTensor {
+    std::string name;
+    std::vector<float> data;
+};
+
+// Writes a GGUF v3 file with a string architecture key and 1D f32 tensors
+void write_gguf(const std::filesystem::path& path, const std::vector<GGUFTestTensor>& tensors) {
+    std::vector<char> buffer;
+    auto write = [&buffer](const void* data, size_t size) {
+        const char* bytes = static_cast<const char*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    };
+    auto write_u32 = [&write](uint32_t value) { write(&value, sizeof(value)); };
+    auto write_u64 = [&write](uint64_t value) { write(&value, sizeof(value)); };
+    auto write_string = [&](const std::string& value) {
+        write_u64(value.size());
+        write(value.data(), value.size());
+    };
+    auto align = [&buffer]() {
+        buffer.resize((buffer.size() + GGUF_ALIGNMENT - 1) / GGUF_ALIGNMENT * GGUF_ALIGNMENT, 0);
+    };
+
+    write("GGUF", 4);
+    write_u32(3);  // version
+    write_u64(tensors.size());
+    write_u64(1);  // number of metadata keys
+    write_string("general.architecture");
+    write_u32(GGUF_VALUE_TYPE_STRING);
+    write_string("test");
+
+    uint64_t offset = 0;
+    for (const auto& tensor : tensors) {
+        write_string(tensor.name);
+        write_u32(1);  // number of dimensions
+        write_u64(tensor.data.size());
+        write_u32(GGUF_TYPE_F32);
+        write_u64(offset);
+        offset += (tensor.data.size() * sizeof(float) + GGUF_ALIGNMENT - 1) / GGUF_ALIGNMENT * GGUF_ALIGNMENT;
+    }
+    for (const auto& tensor : tensors) {
+        align();
+        write(tensor.data.data(), tensor.data.size() * sizeof(float));
+    }
+    align();
+
+    std::ofstream file(path, std::ios::binary);
+    file.write(buffer.data(), buffer.size());
+}
+
+std::vector<GGUFTestTensor> make_tensors(size_t num_tensors, size_t tensor_size) {
+    std::vector<GGUFTestTensor> tensors;
+    for (size_t i = 0; i < num_tensors; ++i) {
+        GGUFTestTensor tensor{"blk." + std::to_string(i) + ".attn_q.weight", std::vector<float>(tensor_size)};
+        for (size_t j = 0; j < tensor_size; ++j) {
+            tensor.data[j] = static_cast<float>(i) + static_cast<float>(j) / tensor_size;
+        }
+        tensors.push_back(std::move(tensor));
+    }
+    return tensors;
+}
+
+class GGUFCacheTest : public ::testing::Test {
+protected:
+    std::filesystem::path m_dir;
+
+    void SetUp() override {
+        const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        m_dir = std::filesystem::temp_directory_path() / ("genai_gguf_cache_" + std::string(test_info->name()));
+        std::filesystem::remove_all(m_dir);
+        std::filesystem::create_directories(m_dir);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(m_dir, ec);
+    }
+};
+
+}  // namespace
+
+TEST_F(GGUFCacheTest, fingerprint_depends_on_content_only) {
+    auto tensors = make_tensors(3, 2048);
+    write_gguf(m_dir / "a.gguf", tensors);
+    write_gguf(m_dir / "b.gguf", tensors);
+    EXPECT_EQ(get_gguf_fingerprint((m_dir / "a.gguf").string()), get_gguf_fingerprint((m_dir / "b.gguf").string()));
+
+    // the first, middle and last pages of each tensor are sampled
+    for (size_t position : {size_t(0), size_t(1024), size_t(2047)}) {
+        auto changed_tensors = tensors;
+        changed_tensors[1].data[position] += 1.0f;
+        write_gguf(m_dir / "c.gguf", changed_tensors);
+        EXPECT_NE(get_gguf_fingerprint((m_dir / "a.gguf").string()), get_gguf_fingerprint((m_dir / "c.gguf").string()))
+            << "change at " << position;
+    }
+
+    auto renamed_tensors = tensors;
+    renamed_tensors[2].name = "blk.2.attn_k.weight";
+    write_gguf(m_dir / "d.gguf", renamed_tensors);
+    EXPECT_NE(get_gguf_fingerprint((m_dir / "a.gguf").string()), get_gguf_fingerprint((m_dir / "d.gguf").string()));
+}
+
+TEST_F(GGUFCacheTest, cache_path_depends_on_content) {
+    auto tensors = make_tensors(2, 64);
+    write_gguf(m_dir / "a.gguf", tensors);
+    tensors[0].data[0] += 1.0f;
+    write_gguf(m_dir / "b.gguf", tensors);
+
+    const auto cache_dir = m_dir / "cache";
+    const auto path_a = get_gguf_cache_path((m_dir / "a.gguf").string(), cache_dir);
+    EXPECT_EQ(path_a, get_gguf_cache_path((m_dir / "a.gguf").string(), cache_dir));
+    EXPECT_NE(path_a, get_gguf_cache_path((m_dir / "b.gguf").string(), cache_dir));
+    EXPECT_EQ(path_a.parent_path(), cache_dir);
+    EXPECT_EQ(path_a.extension(), ".xml");
+    // the name has a key of library versions in addition to the content fingerprint
+    EXPECT_NE(path_a.stem().string(), "gguf_" + get_gguf_fingerprint((m_dir / "a.gguf").string()));
+}
+
+TEST_F(GGUFCacheTest, cached_model_is_read_and_saved_next_to_gguf) {
+    const auto gguf_path = m_dir / "model.gguf";
+    write_gguf(gguf_path, make_tensors(2, 64));
+    const auto cache_dir = m_dir / "cache";
+
+    // a model of an unsupported architecture can't be created, so a cache miss throws
+    EXPECT_ANY_THROW(create_from_gguf(gguf_path.string(), false, cache_dir));
+
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2});
+    auto add = std::make_shared<ov::op::v1::Add>(input, input);
+    add->set_friendly_name("cached_add");
+    auto cached_model = std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{input});
+    std::filesystem::create_directories(cache_dir);
+    ov::save_model(cached_model, get_gguf_cache_path(gguf_path.string(), cache_dir).string(), false);
+
+    auto model = create_from_gguf(gguf_path.string(), true, cache_dir);
+    bool has_cached_add = false;
+    for (const auto& op : model->get_ops()) {
+        has_cached_add |= op->get_friendly_name() == "cached_add";
+    }
+    EXPECT_TRUE(has_cached_add);
+    // enable_save_ov_model is honored on a cache hit too
+    EXPECT_TRUE(std::filesystem::exists(m_dir / "openvino_model.xml"));
+}
+
+TEST_F(GGUFCacheTest, tensors_are_unpacked_in_parallel) {
+    auto tensors = make_tensors(16, 100);
+    write_gguf(m_dir / "model.gguf", tensors);
+
+    auto [metadata, arrays, qtypes] = get_gguf_data((m_dir / "model.gguf").string());
+    EXPECT_EQ(std::get<std::string>(metadata.at("general.architecture")), "test");
+    ASSERT_EQ(arrays.size(), tensors.size());
+    for (const auto& tensor : tensors) {
+        const ov::Tensor& array = arrays.at(tensor.name);
+        ASSERT_EQ(array.get_element_type(), ov::element::f32);
+        ASSERT_EQ(array.get_shape(), ov::Shape{tensor.data.size()});
+        EXPECT_EQ(std::memcmp(array.data(), tensor.data.data(), tensor.data.size() * sizeof(float)), 0) << tensor.name;
+
+        const std::string name_prefix = tensor.name.substr(0, tensor.name.size() - std::string(".weight").size());
+        EXPECT_EQ(qtypes.at(name_prefix + ".qtype"), GGUF_TYPE_F32);
+    }
+}
+
+#endif  // ENABLE_GGUF
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "llm/kv_state_store.hpp"
+
+using namespace ov::genai;
+
+namespace {
+// KV cache state of [batch, num_heads, seq_len, head_size] shape
+ov::Tensor make_state(float value, size_t seq_len = 4) {
+    ov::Tensor state(ov::element::f32, {1, 2, seq_len, 8});
+    float* data = state.data<float>();
+    for (size_t i = 0; i < state.get_size(); ++i) {
+        data[i] = value + 0.01f * static_cast<float>(i % 8);
+    }
+    return state;
+}
+}  // namespace
+
+TEST(TestKVStateStore, evicts_lru_sessions_over_budget) {
+    const size_t state_size = make_state(0.f).get_byte_size();
+    KVStateStore store(2 * state_size);
+    ASSERT_TRUE(store.put("a", {{"key", make_state(1.f)}}));
+    ASSERT_TRUE(store.put("b", {{"key", make_state(2.f)}}));
+    // session "a" becomes the most recently used one
+    ASSERT_TRUE(store.get("a").has_value());
+
+    ASSERT_TRUE(store.put("c", {{"key", make_state(3.f)}}));
+    EXPECT_EQ(store.num_entries(), 2);
+    EXPECT_EQ(store.size_in_bytes(), 2 * state_size);
+    EXPECT_FALSE(store.contains("b"));
+
+    auto states = store.get("a");
+    ASSERT_TRUE(states.has_value());
+    ASSERT_EQ(states->size(), 1);
+    EXPECT_EQ(states->at(0).first, "key");
+    EXPECT_EQ(states->at(0).second.data<float>()[0], 1.f);
+
+    // a snapshot exceeding the whole budget is not stored
+    EXPECT_FALSE(store.put("d", {{"key", make_state(4.f, 16)}}));
+    EXPECT_FALSE(store.contains("d"));
+
+    store.erase("a");
+    EXPECT_EQ(store.size_in_bytes(), state_size);
+}
+
+TEST(TestKVStateStore, compresses_states) {
+    const ov::Tensor state = make_state(-1.f);
+    for (auto precision : {ov::element::f16, ov::element::u8}) {
+        KVStateStore store(state.get_byte_size(), precision);
+        ASSERT_TRUE(store.put("a", {{"key", state}, {"beam_idx", ov::Tensor(ov::element::i32, {1})}}));
+        EXPECT_LT(store.size_in_bytes(), state.get_byte_size());
+
+        auto states = store.get("a");
+        ASSERT_TRUE(states.has_value());
+        const ov::Tensor& restored = states->at(0).second;
+        ASSERT_EQ(restored.get_element_type(), ov::element::f32);
+        ASSERT_EQ(restored.get_shape(), state.get_shape());
+        for (size_t i = 0; i < state.get_size(); ++i) {
+            // u8 step is 0.07 / 255 for rows spanning [-1, -0.93]
+            EXPECT_NEAR(restored.data<float>()[i], state.data<const float>()[i], 2e-3f);
+        }
+        EXPECT_EQ(states->at(1).second.get_element_type(), ov::element::i32);
+    }
+}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <random>
 #include <openvino/core/except.hpp>
 
 #include "sampling/logit_processor.hpp"
@@ -128,6 +129,50 @@ TEST(TopKFilteringTest, FilterNotAppliedTopKGreaterThanInputSize) {
     }
 }
 
+TEST(TopKTopPFilteringTest, LargeVocabFilterResultEqualToFullSort) {
+    const size_t vocab_size = 150000;
+    std::mt19937 rng(42);
+    std::normal_distribution<float> distribution(0.f, 1.f);
+    std::vector<float> input(vocab_size);
+    for (auto& value : input) {
+        value = distribution(rng);
+    }
+    auto input_logits = Logits(input.data(), vocab_size);
+    TemperatureLogitTransform(0.7).apply(input_logits);
+
+    std::vector<Token> sorted_tokens;
+    for (size_t i = 0; i < vocab_size; i++) {
+        sorted_tokens.emplace_back(input[i], i);
+    }
+    std::sort(sorted_tokens.begin(), sorted_tokens.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
+    // order of tokens with equal probabilities is not defined, so probabilities are compared instead of indices
+
+    for (size_t top_k : {1, 50, 1000}) {
+        std::vector<float> data = input;
+        auto logits = Logits(data.data(), vocab_size);
+        TopKFilter(top_k).apply(logits);
+        ASSERT_EQ(logits.m_vector.size(), top_k);
+        for (size_t i = 0; i < top_k; i++) {
+            EXPECT_EQ(logits.m_vector[i].m_log_prob, sorted_tokens[i].m_log_prob);
+        }
+    }
+
+    for (float top_p : {0.1f, 0.5f, 0.95f}) {
+        std::vector<float> data = input;
+        auto logits = Logits(data.data(), vocab_size);
+        TopPFilter(top_p).apply(logits);
+        float probability_sum = 0.0f;
+        size_t nucleus_size = 0;
+        while (probability_sum <= top_p) {
+            probability_sum += sorted_tokens[nucleus_size++].m_log_prob;
+        }
+        ASSERT_EQ(logits.m_vector.size(), nucleus_size);
+        for (size_t i = 0; i < nucleus_size; i++) {
+            EXPECT_EQ(logits.m_vector[i].m_log_prob, sorted_tokens[i].m_log_prob);
+        }
+    }
+}
+
 struct RepetitionPenaltyTransformTestStruct {
     static inline const size_t size = 3;
 
@@ -0,0 +1,179 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/genai/lora_adapter.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+constexpr size_t INPUT_SIZE = 4, OUTPUT_SIZE = 3, LORA_RANK = 2;
+
+std::shared_ptr<ov::Model> make_linear_model(const std::string& layer_name = "layer") {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{ov::Dimension::dynamic(), INPUT_SIZE});
+    std::vector<float> weights(OUTPUT_SIZE * INPUT_SIZE);
+    for (size_t i = 0; i < weights.size(); ++i) {
+        weights[i] = 0.1f * static_cast<float>(i % 5) - 0.2f;
+    }
+    auto weights_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{OUTPUT_SIZE, INPUT_SIZE}, weights);
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(input, weights_const, false, true);
+    matmul->set_friendly_name(layer_name);
+    return std::make_shared<ov::Model>(ov::OutputVector{std::make_shared<ov::op::v0::Result>(matmul)}, ov::ParameterVector{input});
+}
+
+// safetensors file with the A and B matrices of a LoRA adapter for the MatMul of make_linear_model()
+Adapter make_adapter(float scale, const std::string& layer_name = "layer") {
+    std::vector<float> lora_a(LORA_RANK * INPUT_SIZE), lora_b(OUTPUT_SIZE * LORA_RANK);
+    for (size_t i = 0; i < lora_a.size(); ++i) {
+        lora_a[i] = scale * static_cast<float>(i + 1) / 8.0f;
+    }
+    for (size_t i = 0; i < lora_b.size(); ++i) {
+        lora_b[i] = scale * (static_cast<float>(i % 3) - 1.0f);
+    }
+    const size_t a_bytes = lora_a.size() * sizeof(float), b_bytes = lora_b.size() * sizeof(float);
+
+    std::string header = "{\"" + layer_name + ".lora_A.weight\":{\"dtype\":\"F32\",\"shape\":[" + std::to_string(LORA_RANK) + "," +
+                         std::to_string(INPUT_SIZE) + "],\"data_offsets\":[0," + std::to_string(a_bytes) + "]}," +
+                         "\"" + layer_name + ".lora_B.weight\":{\"dtype\":\"F32\",\"shape\":[" + std::to_string(OUTPUT_SIZE) + "," +
+                         std::to_string(LORA_RANK) + "],\"data_offsets\":[" + std::to_string(a_bytes) + "," +
+                         std::to_string(a_bytes + b_bytes) + "]}}";
+    header.resize((header.size() + 7) / 8 * 8, ' ');
+
+    ov::Tensor safetensor(ov::element::u8, ov::Shape{8 + header.size() + a_bytes + b_bytes});
+    uint8_t* data = safetensor.data<uint8_t>();
+    uint64_t header_size = header.size();
+    for (size_t i = 0; i < 8; ++i) {
+        data[i] = static_cast<uint8_t>(header_size >> (8 * i));
+    }
+    std::memcpy(data + 8, header.data(), header.size());
+    std::memcpy(data + 8 + header.size(), lora_a.data(), a_bytes);
+    std::memcpy(data + 8 + header.size() + a_bytes, lora_b.data(), b_bytes);
+    return Adapter(safetensor);
+}
+
+ov::Tensor make_input(size_t num_rows, size_t first_row) {
+    ov::Tensor input(ov::element::f32, ov::Shape{num_rows, INPUT_SIZE});
+    float* data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); ++i) {
+        data[i] = static_cast<float>((first_row * INPUT_SIZE + i) % 7) / 7.0f - 0.5f;
+    }
+    return input;
+}
+
+std::vector<float> infer(ov::InferRequest& request, const ov::Tensor& input) {
+    request.set_input_tensor(input);
+    request.infer();
+    ov::Tensor output = request.get_output_tensor();
+    return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+}
+
+void expect_rows_near(const std::vector<float>& actual, size_t first_row, const std::vector<float>& expected) {
+    ASSERT_LE((first_row * OUTPUT_SIZE) + expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(actual[first_row * OUTPUT_SIZE + i], expected[i], 1e-5f) << "at row " << first_row + i / OUTPUT_SIZE;
+    }
+}
+
+class PerTokenLoRATest : public ::testing::Test {
+protected:
+    Adapter m_adapter1 = make_adapter(1.0f), m_adapter2 = make_adapter(-0.5f);
+    std::vector<AdapterConfig> m_configs = {AdapterConfig(m_adapter1, 1.0f), AdapterConfig(), AdapterConfig(m_adapter2, 0.5f)};
+    // {index of a config, number of tokens}
+    std::vector<std::pair<size_t, size_t>> m_token_ranges = {{0, 2}, {1, 1}, {2, 2}};
+
+    // outputs of the rows of each token range inferred alone with the config of the range
+    std::vector<std::vector<float>> infer_solo() {
+        ov::Core core;
+        auto model = make_linear_model();
+        AdapterController controller(model, AdapterConfig({m_adapter1, m_adapter2}, AdapterConfig::MODE_DYNAMIC), "CPU");
+        ov::InferRequest request = core.compile_model(model, "CPU").create_infer_request();
+
+        std::vector<std::vector<float>> outputs;
+        size_t first_row = 0;
+        for (const auto& [config_idx, num_tokens] : m_token_ranges) {
+            controller.apply(request, m_configs[config_idx]);
+            outputs.push_back(infer(request, make_input(num_tokens, first_row)));
+            first_row += num_tokens;
+        }
+        return outputs;
+    }
+};
+
+}  // namespace
+
+TEST_F(PerTokenLoRATest, mixed_batch_matches_solo_inference) {
+    std::vector<std::vector<float>> solo_outputs = infer_solo();
+
+    ov::Core core;
+    auto model = make_linear_model();
+    AdapterController controller(model, AdapterConfig({m_adapter1, m_adapter2}, AdapterConfig::MODE_DYNAMIC), "CPU", true);
+    ov::InferRequest request = core.compile_model(model, "CPU").create_infer_request();
+
+    const size_t num_rows = 5;
+    controller.apply_per_token(request, m_configs, m_token_ranges);
+    std::vector<float> batch_output = infer(request, make_input(num_rows, 0));
+
+    size_t first_row = 0;
+    for (size_t range_idx = 0; range_idx < m_token_ranges.size(); ++range_idx) {
+        expect_rows_near(batch_output, first_row, solo_outputs[range_idx]);
+        first_row += m_token_ranges[range_idx].second;
+    }
+
+    // the same configs in another order reuse the adapters kept in the state
+    std::vector<AdapterConfig> reordered_configs = {m_configs[2], m_configs[0], m_configs[1]};
+    controller.apply_per_token(request, reordered_configs, {{1, 2}, {2, 1}, {0, 2}});
+    batch_output = infer(request, make_input(num_rows, 0));
+    first_row = 0;
+    for (size_t range_idx = 0; range_idx < m_token_ranges.size(); ++range_idx) {
+        expect_rows_near(batch_output, first_row, solo_outputs[range_idx]);
+        first_row += m_token_ranges[range_idx].second;
+    }
+}
+
+TEST_F(PerTokenLoRATest, single_config_is_applied_to_all_tokens_after_mixed_batch) {
+    ov::Core core;
+    auto model = make_linear_model();
+    AdapterController controller(model, AdapterConfig({m_adapter1, m_adapter2}, AdapterConfig::MODE_DYNAMIC), "CPU", true);
+    ov::InferRequest request = core.compile_model(model, "CPU").create_infer_request();
+
+    const size_t num_rows = 5;
+    controller.apply_per_token(request, m_configs, m_token_ranges);
+    infer(request, make_input(num_rows, 0));
+
+    for (const AdapterConfig& config : m_configs) {
+        // reference from a controller which has never seen a mixed batch
+        ov::Core reference_core;
+        auto reference_model = make_linear_model();
+        AdapterController reference_controller(reference_model, AdapterConfig({m_adapter1, m_adapter2}, AdapterConfig::MODE_DYNAMIC), "CPU");
+        ov::InferRequest reference_request = reference_core.compile_model(reference_model, "CPU").create_infer_request();
+        reference_controller.apply(reference_request, config);
+        std::vector<float> expected = infer(reference_request, make_input(num_rows, 0));
+
+        controller.apply(request, config);
+        expect_rows_near(infer(request, make_input(num_rows, 0)), 0, expected);
+
+        // and back to a mixed batch
+        controller.apply_per_token(request, m_configs, m_token_ranges);
+        infer(request, make_input(num_rows, 0));
+    }
+}
+
+TEST(PerTokenLoRALmHeadTest, adapters_targeting_lm_head_are_rejected) {
+    Adapter adapter = make_adapter(1.0f, "lm_head");
+    EXPECT_THROW(AdapterController(make_linear_model("lm_head"), AdapterConfig(adapter, AdapterConfig::MODE_DYNAMIC), "CPU", true),
+                 ov::Exception);
+    // all tokens share the alphas without per token adapters
+    EXPECT_NO_THROW(AdapterController(make_linear_model("lm_head"), AdapterConfig(adapter, AdapterConfig::MODE_DYNAMIC), "CPU"));
+}
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/parameter.hpp"
+#include "rag/micro_batching.hpp"
+
+using namespace ov::genai::utils;
+
+namespace {
+// doubles a batch of single values
+ov::CompiledModel compile_doubling_model(ov::Core& core) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{ov::Dimension::dynamic(), 1});
+    auto add = std::make_shared<ov::op::v1::Add>(input, input);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{input});
+    return core.compile_model(model, "CPU");
+}
+
+void set_rows(ov::InferRequest& request, const std::vector<size_t>& rows) {
+    ov::Tensor input(ov::element::f32, {rows.size(), 1});
+    for (size_t i = 0; i < rows.size(); ++i) {
+        input.data<float>()[i] = static_cast<float>(rows[i]);
+    }
+    request.set_input_tensor(input);
+}
+}  // namespace
+
+TEST(TestMicroBatching, groups_inputs_of_similar_lengths) {
+    std::vector<size_t> lengths = {100, 3, 5, 4, 60, 2, 70};
+    auto micro_batches = split_into_micro_batches(lengths, 128);
+
+    std::vector<std::vector<size_t>> expected_micro_batches = {{5, 1, 3, 2}, {4}, {6}, {0}};
+    EXPECT_EQ(micro_batches, expected_micro_batches);
+
+    // the longest input doesn't fit the budget, so it forms a micro batch of its own
+    micro_batches = split_into_micro_batches(lengths, 50);
+    ASSERT_EQ(micro_batches.size(), 4);
+    EXPECT_EQ(micro_batches.back(), std::vector<size_t>({0}));
+}
+
+TEST(TestMicroBatching, gathers_rows_keeping_padding_side) {
+    // rows of lengths 1, 3 and 2 padded to 4 tokens with right and left padding
+    ov::Tensor input_ids{ov::element::i64, {3, 4}};
+    ov::Tensor attention_mask{ov::element::i64, {3, 4}};
+    for (bool is_left_padded : {false, true}) {
+        const std::vector<int64_t> right_padded_ids = {11, 0, 0, 0, 21, 22, 23, 0, 31, 32, 0, 0};
+        const std::vector<int64_t> right_padded_mask = {1, 0, 0, 0, 1, 1, 1, 0, 1, 1, 0, 0};
+        const std::vector<int64_t> left_padded_ids = {0, 0, 0, 11, 0, 21, 22, 23, 0, 0, 31, 32};
+        const std::vector<int64_t> left_padded_mask = {0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 1, 1};
+        std::copy_n((is_left_padded ? left_padded_ids : right_padded_ids).data(), 12, input_ids.data<int64_t>());
+        std::copy_n((is_left_padded ? left_padded_mask : right_padded_mask).data(), 12, attention_mask.data<int64_t>());
+
+        EXPECT_EQ(get_sequence_lengths(attention_mask), std::vector<size_t>({1, 3, 2}));
+
+        ov::Tensor gathered_ids = gather_padded_rows(input_ids, attention_mask, {2, 0}, -1);
+        ov::Tensor gathered_mask = gather_padded_rows(attention_mask, attention_mask, {2, 0}, 0);
+        ASSERT_EQ(gathered_ids.get_shape(), ov::Shape({2, 2}));
+        const int64_t* ids = gathered_ids.data<int64_t>();
+        const int64_t* mask = gathered_mask.data<int64_t>();
+        std::vector<int64_t> expected_ids = is_left_padded ? std::vector<int64_t>{31, 32, -1, 11} : std::vector<int64_t>{31, 32, 11, -1};
+        std::vector<int64_t> expected_mask = is_left_padded ? std::vector<int64_t>{1, 1, 0, 1} : std::vector<int64_t>{1, 1, 1, 0};
+        EXPECT_EQ(std::vector<int64_t>(ids, ids + 4), expected_ids);
+        EXPECT_EQ(std::vector<int64_t>(mask, mask + 4), expected_mask);
+    }
+}
+
+TEST(TestMicroBatching, failed_micro_batch_waits_for_started_ones) {
+    ov::Core core;
+    ov::CompiledModel compiled_model = compile_doubling_model(core);
+    MicroBatchedInference inference(compiled_model, 2);
+    const std::vector<std::vector<size_t>> micro_batches = {{0, 1}, {2}, {3, 4}, {5}, {6}};
+
+    std::vector<float> outputs(7, -1.f);
+    auto read_outputs = [&outputs](ov::InferRequest& request, const std::vector<size_t>& rows) {
+        const float* data = request.get_output_tensor().data<float>();
+        for (size_t i = 0; i < rows.size(); ++i) {
+            outputs[rows[i]] = data[i];
+        }
+    };
+
+    // micro batch 2 fails to start while micro batch 1 is running
+    inference.start(micro_batches, [](ov::InferRequest& request, const std::vector<size_t>& rows) {
+        OPENVINO_ASSERT(rows.front() != 3, "failed to set inputs");
+        set_rows(request, rows);
+    }, read_outputs);
+    EXPECT_THROW(inference.wait(), ov::Exception);
+    // outputs of the micro batches after the failed one are not read
+    EXPECT_EQ(outputs, std::vector<float>({0.f, 2.f, -1.f, -1.f, -1.f, -1.f, -1.f}));
+
+    // micro batch 1 fails to read outputs, the first error is rethrown
+    std::fill(outputs.begin(), outputs.end(), -1.f);
+    inference.start(micro_batches, set_rows, [&read_outputs](ov::InferRequest& request, const std::vector<size_t>& rows) {
+        OPENVINO_ASSERT(rows.front() != 2, "failed to read outputs");
+        read_outputs(request, rows);
+    });
+    EXPECT_THROW(inference.wait(), ov::Exception);
+    EXPECT_EQ(outputs, std::vector<float>({0.f, 2.f, -1.f, -1.f, -1.f, -1.f, -1.f}));
+
+    // no request is left running, so the inference can be reused
+    std::fill(outputs.begin(), outputs.end(), -1.f);
+    inference.start(micro_batches, set_rows, read_outputs);
+    inference.wait();
+    EXPECT_EQ(outputs, std::vector<float>({0.f, 2.f, 4.f, 6.f, 8.f, 10.f, 12.f}));
+}
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+
+#include "prompt_lookup/ngram_index.hpp"
+
+using ov::genai::NGramIndex;
+
+namespace {
+// straightforward search used by prompt lookup before the index was introduced
+std::vector<int64_t> find_candidates_by_scan(const std::vector<int64_t>& input_ids, size_t num_pred_tokens, size_t max_ngram_size) {
+    if (num_pred_tokens == 0) {
+        return {};
+    }
+    const size_t input_length = input_ids.size();
+    if (max_ngram_size >= input_length) {
+        max_ngram_size = input_length / 2;
+    }
+    for (size_t ngram_size = max_ngram_size; ngram_size > 0; ngram_size--) {
+        for (size_t input_i = 0; input_i + ngram_size < input_length; input_i++) {
+            if (!std::equal(input_ids.end() - ngram_size, input_ids.end(), input_ids.begin() + input_i)) {
+                continue;
+            }
+            size_t start = input_i + ngram_size;
+            size_t available_num_pred = std::min(input_length - start, num_pred_tokens);
+            return {input_ids.begin() + start, input_ids.begin() + start + available_num_pred};
+        }
+    }
+    return {};
+}
+}  // namespace
+
+TEST(TestNGramIndex, matches_scan_with_appends_and_truncations) {
+    const size_t max_ngram_size = 3, num_pred_tokens = 5;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int64_t> token_distribution(0, 5);
+
+    std::vector<int64_t> prompt(50);
+    for (auto& token : prompt) {
+        token = token_distribution(rng);
+    }
+    std::vector<int64_t> generated;
+    NGramIndex index(max_ngram_size);
+
+    for (size_t step = 0; step < 200; ++step) {
+        // emulate rejection of a part of candidates followed by a newly sampled token
+        size_t num_rejected = std::min<size_t>(rng() % 3, generated.size());
+        generated.resize(generated.size() - num_rejected);
+        generated.push_back(token_distribution(rng));
+
+        index.update(prompt, generated);
+        std::vector<int64_t> full_input_ids = prompt;
+        full_input_ids.insert(full_input_ids.end(), generated.begin(), generated.end());
+        ASSERT_EQ(index.size(), full_input_ids.size());
+        ASSERT_EQ(index.find_candidates(num_pred_tokens, max_ngram_size),
+                  find_candidates_by_scan(full_input_ids, num_pred_tokens, max_ngram_size));
+
+        // candidates are appended to the index and then validated
+        for (int64_t token : index.find_candidates(num_pred_tokens, max_ngram_size)) {
+            generated.push_back(token);
+        }
+    }
+}
+
+TEST(TestNGramIndex, detects_replaced_tokens_before_the_last_one) {
+    NGramIndex index(2);
+    std::vector<int64_t> prompt = {5, 2, 4, 1, 2, 3};
+    index.update(prompt, {7, 2});
+    EXPECT_EQ(index.find_candidates(2, 2), std::vector<int64_t>({4, 1}));
+
+    // the generated token before the last one is replaced, while the last one is the same
+    index.update(prompt, {1, 2});
+    ASSERT_EQ(index.size(), 8);
+    EXPECT_EQ(index.find_candidates(2, 2), std::vector<int64_t>({3, 1}));
+}
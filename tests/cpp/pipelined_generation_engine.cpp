@@ -0,0 +1,239 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "image_generation/pipelined_generation_engine.hpp"
+
+using namespace ov::genai;
+using Request = PipelinedGenerationEngine::Request;
+
+namespace {
+
+// blocks the stages which wait for it until it's opened
+class Gate {
+public:
+    void open() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_is_open = true;
+        }
+        m_cv.notify_all();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] { return m_is_open; });
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_is_open = false;
+};
+
+float prompt_to_value(const std::string& prompt) {
+    return static_cast<float>(std::stoi(prompt));
+}
+
+ov::Tensor make_value_tensor(float value) {
+    ov::Tensor tensor(ov::element::f32, ov::Shape{1});
+    tensor.data<float>()[0] = value;
+    return tensor;
+}
+
+// stages computing ((prompt + 1) * 2) - 3 with a short sleep each, so that requests overlap
+PipelinedGenerationEngine::Stages make_arithmetic_stages() {
+    PipelinedGenerationEngine::Stages stages;
+    stages.encode = [](Request& request) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        request.hidden_states["value"] = make_value_tensor(prompt_to_value(request.positive_prompt) + 1.0f);
+    };
+    stages.denoise = [](Request& request) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        return make_value_tensor(request.hidden_states.at("value").data<float>()[0] * 2.0f);
+    };
+    stages.decode = [](Request& request) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return make_value_tensor(request.latent.data<float>()[0] - 3.0f);
+    };
+    return stages;
+}
+
+float expected_value(size_t prompt) {
+    return (static_cast<float>(prompt) + 1.0f) * 2.0f - 3.0f;
+}
+
+}  // namespace
+
+TEST(TestPipelinedGenerationEngine, concurrent_results_match_sequential_ones) {
+    const size_t num_threads = 6, num_requests_per_thread = 5;
+    PipelinedGenerationEngine engine(make_arithmetic_stages(), 3);
+
+    std::vector<std::future<std::vector<float>>> results;
+    for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        results.push_back(std::async(std::launch::async, [&engine, thread_idx] {
+            std::vector<float> values;
+            for (size_t i = 0; i < num_requests_per_thread; ++i) {
+                const size_t prompt = thread_idx * num_requests_per_thread + i;
+                values.push_back(engine.generate(std::to_string(prompt), {}).data<float>()[0]);
+            }
+            return values;
+        }));
+    }
+
+    for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        std::vector<float> values = results[thread_idx].get();
+        ASSERT_EQ(values.size(), num_requests_per_thread);
+        for (size_t i = 0; i < num_requests_per_thread; ++i) {
+            EXPECT_EQ(values[i], expected_value(thread_idx * num_requests_per_thread + i));
+        }
+    }
+}
+
+TEST(TestPipelinedGenerationEngine, error_in_request_does_not_stall_others) {
+    PipelinedGenerationEngine::Stages stages = make_arithmetic_stages();
+    auto encode = stages.encode;
+    auto denoise = stages.denoise;
+    auto decode = stages.decode;
+    // prompts 10, 20 and 30 fail in the text encoding, denoising and decoding stages respectively
+    stages.encode = [encode](Request& request) {
+        OPENVINO_ASSERT(request.positive_prompt != "10", "encoding failed");
+        encode(request);
+    };
+    stages.denoise = [denoise](Request& request) {
+        OPENVINO_ASSERT(request.positive_prompt != "20", "denoising failed");
+        return denoise(request);
+    };
+    stages.decode = [decode](Request& request) {
+        OPENVINO_ASSERT(request.positive_prompt != "30", "decoding failed");
+        return decode(request);
+    };
+    // requests stopped by the callback don't reach the decoding stage
+    auto failing_denoise = stages.denoise;
+    stages.denoise = [failing_denoise](Request& request) {
+        if (request.positive_prompt == "40") {
+            return ov::Tensor(ov::element::u8, ov::Shape{});
+        }
+        return failing_denoise(request);
+    };
+    PipelinedGenerationEngine engine(std::move(stages), 2);
+
+    std::vector<std::future<ov::Tensor>> results;
+    const size_t num_requests = 45;
+    for (size_t prompt = 0; prompt < num_requests; ++prompt) {
+        results.push_back(std::async(std::launch::async, [&engine, prompt] {
+            return engine.generate(std::to_string(prompt), {});
+        }));
+    }
+
+    for (size_t prompt = 0; prompt < num_requests; ++prompt) {
+        if (prompt == 10 || prompt == 20 || prompt == 30) {
+            EXPECT_THROW(results[prompt].get(), ov::Exception) << prompt;
+        } else if (prompt == 40) {
+            EXPECT_TRUE(results[prompt].get().get_shape().empty());
+        } else {
+            EXPECT_EQ(results[prompt].get().data<float>()[0], expected_value(prompt));
+        }
+    }
+
+    // the engine keeps serving requests after the errors
+    EXPECT_EQ(engine.generate("7", {}).data<float>()[0], expected_value(7));
+}
+
+TEST(TestPipelinedGenerationEngine, destructor_completes_requests_in_flight) {
+    const size_t num_requests = 3;
+    Gate denoising_gate;
+    std::atomic<size_t> num_encoded{0};
+    PipelinedGenerationEngine::Stages stages = make_arithmetic_stages();
+    auto encode = stages.encode;
+    auto denoise = stages.denoise;
+    stages.encode = [encode, &num_encoded](Request& request) {
+        encode(request);
+        ++num_encoded;
+    };
+    stages.denoise = [denoise, &denoising_gate](Request& request) {
+        denoising_gate.wait();
+        return denoise(request);
+    };
+    auto engine = std::make_unique<PipelinedGenerationEngine>(std::move(stages), num_requests);
+
+    std::vector<std::future<ov::Tensor>> results;
+    for (size_t prompt = 0; prompt < num_requests; ++prompt) {
+        results.push_back(std::async(std::launch::async, [&engine, prompt] {
+            return engine->generate(std::to_string(prompt), {});
+        }));
+    }
+    // a request is encoded once it's admitted, so all of them are in flight now
+    while (num_encoded < num_requests) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::thread opener([&denoising_gate] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        denoising_gate.open();
+    });
+    engine.reset();
+    opener.join();
+
+    for (size_t prompt = 0; prompt < num_requests; ++prompt) {
+        EXPECT_EQ(results[prompt].get().data<float>()[0], expected_value(prompt));
+    }
+}
+
+TEST(TestPipelinedGenerationEngine, exclusive_action_waits_for_requests_in_flight) {
+    Gate denoising_gate;
+    std::atomic<bool> is_denoising{false}, is_action_done{false};
+    PipelinedGenerationEngine::Stages stages = make_arithmetic_stages();
+    auto denoise = stages.denoise;
+    stages.denoise = [denoise, &denoising_gate, &is_denoising, &is_action_done](Request& request) {
+        is_denoising = true;
+        if (request.positive_prompt == "1") {
+            denoising_gate.wait();
+        } else {
+            // requests submitted while the action is waiting are held back until it's done
+            EXPECT_TRUE(is_action_done);
+        }
+        return denoise(request);
+    };
+    PipelinedGenerationEngine engine(std::move(stages), 2);
+
+    auto first_result = std::async(std::launch::async, [&engine] {
+        return engine.generate("1", {});
+    });
+    while (!is_denoising) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::atomic<bool> is_action_started{false};
+    auto action = std::async(std::launch::async, [&] {
+        engine.run_exclusively([&] {
+            is_action_started = true;
+            // no request is in flight while the action runs
+            EXPECT_EQ(first_result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+            is_action_done = true;
+        });
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    auto second_result = std::async(std::launch::async, [&engine] {
+        return engine.generate("2", {});
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(is_action_started);
+
+    denoising_gate.open();
+    action.get();
+    EXPECT_TRUE(is_action_done);
+    EXPECT_EQ(first_result.get().data<float>()[0], expected_value(1));
+    EXPECT_EQ(second_result.get().data<float>()[0], expected_value(2));
+}
@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <random>
+#include "continuous_batching/prefix_cache_tiers.hpp"
+
+using namespace ov::genai;
+
+namespace {
+std::vector<uint8_t> make_block_data(uint8_t value, size_t size = 8) {
+    return std::vector<uint8_t>(size, value);
+}
+
+// tests can run in parallel processes, so each disk tier gets its own file
+std::filesystem::path get_unique_temp_path() {
+    const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::random_device random_device;
+    return std::filesystem::temp_directory_path() /
+           ("genai_prefix_cache_" + std::string(test_info->name()) + "_" + std::to_string(random_device()) + ".bin");
+}
+}  // namespace
+
+TEST(TestPrefixCacheTiers, host_tier_evicts_lru_blocks) {
+    HostPrefixCacheTier tier(2);
+    EXPECT_TRUE(tier.put(1, make_block_data(1)).empty());
+    EXPECT_TRUE(tier.put(2, make_block_data(2)).empty());
+
+    std::vector<uint8_t> data;
+    // block 1 becomes the most recently used one
+    EXPECT_TRUE(tier.get(1, data));
+    EXPECT_EQ(data, make_block_data(1));
+
+    auto evicted = tier.put(3, make_block_data(3));
+    ASSERT_EQ(evicted.size(), 1);
+    EXPECT_EQ(evicted[0].first, 2);
+    EXPECT_EQ(evicted[0].second, make_block_data(2));
+    EXPECT_EQ(tier.num_blocks(), 2);
+    EXPECT_TRUE(tier.contains(1));
+    EXPECT_FALSE(tier.contains(2));
+    EXPECT_TRUE(tier.contains(3));
+}
+
+TEST(TestPrefixCacheTiers, disk_tier_round_trip) {
+    auto path = get_unique_temp_path();
+    {
+        DiskPrefixCacheTier tier(path, 8, 2);
+        tier.put(1, make_block_data(1));
+        tier.put(2, make_block_data(2));
+        tier.put(3, make_block_data(3));
+        EXPECT_EQ(tier.num_blocks(), 2);
+        EXPECT_FALSE(tier.contains(1));
+
+        std::vector<uint8_t> data;
+        EXPECT_TRUE(tier.get(2, data));
+        EXPECT_EQ(data, make_block_data(2));
+        EXPECT_TRUE(tier.get(3, data));
+        EXPECT_EQ(data, make_block_data(3));
+        EXPECT_FALSE(tier.get(1, data));
+    }
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST(TestPrefixCacheTiers, tiered_cache_cascades_and_promotes) {
+    auto path = get_unique_temp_path();
+    auto host_tier = std::make_shared<HostPrefixCacheTier>(1);
+    auto disk_tier = std::make_shared<DiskPrefixCacheTier>(path, 8, 4);
+    TieredPrefixCache cache;
+    cache.add_tier(host_tier);
+    cache.add_tier(disk_tier);
+
+    cache.store(1, make_block_data(1));
+    cache.store(2, make_block_data(2));
+    // block 1 is evicted from host memory to disk
+    EXPECT_TRUE(host_tier->contains(2));
+    EXPECT_TRUE(disk_tier->contains(1));
+    EXPECT_TRUE(cache.contains(1));
+
+    std::vector<uint8_t> data;
+    EXPECT_TRUE(cache.load(1, data));
+    EXPECT_EQ(data, make_block_data(1));
+    // block 1 is promoted to host memory, block 2 goes to disk
+    EXPECT_TRUE(host_tier->contains(1));
+    EXPECT_TRUE(disk_tier->contains(2));
+    EXPECT_FALSE(cache.load(3, data));
+}
@@ -301,3 +301,82 @@ TEST(SamplerValidationMode, prompt_phase) {
              expected{0, 1, 2, 3};
     ASSERT_EQ(sequence_groups.front()->get_sequences().front()->get_generated_ids(), expected);
 }
+
+TEST(SamplerBeamSearchTest, select_top_log_probs_matches_full_log_softmax) {
+    const size_t batch_size = 2, seq_len = 3, vocab_size = 100, top_k = 8;
+    ov::Tensor logits(ov::element::f32, {batch_size, seq_len, vocab_size});
+    float* data = logits.data<float>();
+    for (size_t i = 0; i < logits.get_size(); ++i) {
+        // values repeat, so that equal log probabilities are present
+        data[i] = static_cast<float>((i * 37) % 23) / 4.0f;
+    }
+    // sorted by index: a banned token, a penalized one and one boosted from the bottom
+    std::vector<Token> adjustments = {{-std::numeric_limits<float>::infinity(), 3}, {-0.5f, 10}, {100.0f, 42}};
+
+    for (size_t batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
+        std::vector<Token> expected = log_softmax(logits, batch_idx);
+        for (const Token& adjustment : adjustments) {
+            expected[adjustment.m_index].m_log_prob += adjustment.m_log_prob;
+        }
+        std::stable_sort(expected.begin(), expected.end(), [](const Token& left, const Token& right) {
+            return left.m_log_prob > right.m_log_prob;
+        });
+
+        std::vector<Token> actual;
+        select_top_log_probs(logits, batch_idx, top_k, adjustments, actual);
+        ASSERT_EQ(actual.size(), top_k);
+        for (size_t i = 0; i < top_k; ++i) {
+            EXPECT_EQ(actual[i].m_index, expected[i].m_index);
+            EXPECT_FLOAT_EQ(actual[i].m_log_prob, expected[i].m_log_prob);
+        }
+    }
+}
+
+namespace {
+
+std::set<int64_t> get_banned_tokens(const NoRepeatNgramBans& bans, const TokenIds& prompt_ids, const TokenIds& generated_ids) {
+    std::vector<Token> adjustments;
+    bans.add_bans(prompt_ids, generated_ids, adjustments);
+    std::set<int64_t> banned_tokens;
+    for (const Token& adjustment : adjustments) {
+        EXPECT_EQ(adjustment.m_log_prob, -std::numeric_limits<float>::infinity());
+        banned_tokens.insert(adjustment.m_index);
+    }
+    return banned_tokens;
+}
+
+}  // namespace
+
+TEST(SamplerNoRepeatNgramTest, bans_prompt_ngrams) {
+    const TokenIds prompt_ids{1, 2, 3, 4, 1, 2, 5};
+    NoRepeatNgramBans bans(prompt_ids, 3);
+    // [1, 2] is followed by 3 and 5 in the prompt
+    EXPECT_EQ(get_banned_tokens(bans, prompt_ids, {6, 1, 2}), (std::set<int64_t>{3, 5}));
+    // [2, 6] doesn't occur before
+    EXPECT_TRUE(get_banned_tokens(bans, prompt_ids, {2, 6}).empty());
+}
+
+TEST(SamplerNoRepeatNgramTest, bans_ngrams_spanning_prompt_and_generation) {
+    const TokenIds prompt_ids{7, 8, 9};
+    NoRepeatNgramBans bans(prompt_ids, 3);
+    // [8, 9, 10] starts in the prompt and ends with the first generated token
+    EXPECT_EQ(get_banned_tokens(bans, prompt_ids, {10, 8, 9}), (std::set<int64_t>{10}));
+    // [9, 10, 11] starts with the last prompt token
+    EXPECT_EQ(get_banned_tokens(bans, prompt_ids, {10, 11, 9, 10}), (std::set<int64_t>{11}));
+    // [10, 11, 12] is generated only
+    EXPECT_EQ(get_banned_tokens(bans, prompt_ids, {10, 11, 12, 10, 11}), (std::set<int64_t>{12}));
+    // the last tokens [9, 10] don't ban anything by themselves
+    EXPECT_TRUE(get_banned_tokens(bans, prompt_ids, {10}).empty());
+}
+
+TEST(SamplerNoRepeatNgramTest, unigrams_ban_every_token_of_sequence) {
+    const TokenIds prompt_ids{3, 1, 3};
+    NoRepeatNgramBans bans(prompt_ids, 1);
+    EXPECT_EQ(get_banned_tokens(bans, prompt_ids, {4}), (std::set<int64_t>{1, 3, 4}));
+}
+
+TEST(SamplerNoRepeatNgramTest, disabled_by_max_size) {
+    const TokenIds prompt_ids{1, 1, 1};
+    NoRepeatNgramBans bans(prompt_ids, std::numeric_limits<size_t>::max());
+    EXPECT_TRUE(get_banned_tokens(bans, prompt_ids, {1, 1}).empty());
+}
@@ -70,9 +70,9 @@ TEST(TestScheduler, general_test) {
 
         std::vector<uint64_t> ref_ids = {0, 1, 2};
         EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, ref_ids);
-        EXPECT_EQ(out1.m_block_tables[idx0][0].size(), 2);
-        EXPECT_EQ(out1.m_block_tables[idx1][0].size(), 2);
-        EXPECT_EQ(out1.m_block_tables[idx2][0].size(), 2);
+        EXPECT_EQ((*out1.m_block_tables[idx0])[0].size(), 2);
+        EXPECT_EQ((*out1.m_block_tables[idx1])[0].size(), 2);
+        EXPECT_EQ((*out1.m_block_tables[idx2])[0].size(), 2);
         // tokens.size() * 2 tokens should be scheduled on prompt phase, corresponding to first three sequences
         EXPECT_EQ(out1.m_total_num_scheduled_tokens, tokens.size() * 3);
         EXPECT_EQ(out1.is_prompt, !scheduler_config.dynamic_split_fuse);
@@ -97,8 +97,8 @@ TEST(TestScheduler, general_test) {
 
         std::vector<uint64_t> ref_ids2 = {0, 1};
         EXPECT_EQ(out3.m_scheduled_sequence_groups_ids, ref_ids2);
-        EXPECT_EQ(out3.m_block_tables[idx0][0].size(), 3);
-        EXPECT_EQ(out3.m_block_tables[idx1][0].size(), 3);
+        EXPECT_EQ((*out3.m_block_tables[idx0])[0].size(), 3);
+        EXPECT_EQ((*out3.m_block_tables[idx1])[0].size(), 3);
         // 2 tokens should be scheduled on generate phase for "0" and "1" sequence, "2" sequence should be preempted
         EXPECT_EQ(out3.m_total_num_scheduled_tokens, 2);
         EXPECT_FALSE(out3.is_prompt);
@@ -116,11 +116,11 @@ TEST(TestScheduler, general_test) {
         auto out4 = scheduler.schedule(requests);
 
         // check that sequence_group3 is fully scehuled
-        EXPECT_EQ(out4.m_block_tables[idx2][0].size(), 2);
-        EXPECT_FALSE(out4.m_block_tables[idx2][0][0]->is_free());
-        EXPECT_EQ(out4.m_block_tables[idx2][0][0]->get_index(), 0);
-        EXPECT_FALSE(out4.m_block_tables[idx2][0][1]->is_free());
-        EXPECT_EQ(out4.m_block_tables[idx2][0][1]->get_index(), 1);
+        EXPECT_EQ((*out4.m_block_tables[idx2])[0].size(), 2);
+        EXPECT_FALSE((*out4.m_block_tables[idx2])[0][0]->is_free());
+        EXPECT_EQ((*out4.m_block_tables[idx2])[0][0]->get_index(), 0);
+        EXPECT_FALSE((*out4.m_block_tables[idx2])[0][1]->is_free());
+        EXPECT_EQ((*out4.m_block_tables[idx2])[0][1]->get_index(), 1);
 
         // requests1[1] should be fully scheduled plus 1 slot for requests[0] for generate phase
         EXPECT_EQ(out4.m_total_num_scheduled_tokens, requests[1]->get_context_len() + 1);
@@ -177,16 +177,16 @@ TEST_P(AppendSlotsSchedulerTest, test_append_slots_considers_all_sequences) {
 
     std::vector<uint64_t> ref_ids = {0, 1};
     EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, ref_ids);
-    EXPECT_EQ(out1.m_block_tables[idx0][0].size(), 2);
-    EXPECT_EQ(out1.m_block_tables[idx1][0].size(), 2);
-    EXPECT_FALSE(out1.m_block_tables[idx0][0][0]->is_free());
-    EXPECT_EQ(out1.m_block_tables[idx0][0][0]->get_index(), 0);
-    EXPECT_FALSE(out1.m_block_tables[idx0][0][1]->is_free());
-    EXPECT_EQ(out1.m_block_tables[idx0][0][1]->get_index(), 1);
-    EXPECT_FALSE(out1.m_block_tables[idx1][0][0]->is_free());
-    EXPECT_EQ(out1.m_block_tables[idx1][0][0]->get_index(), 2);
-    EXPECT_FALSE(out1.m_block_tables[idx1][0][1]->is_free());
-    EXPECT_EQ(out1.m_block_tables[idx1][0][1]->get_index(), 3);
+    EXPECT_EQ((*out1.m_block_tables[idx0])[0].size(), 2);
+    EXPECT_EQ((*out1.m_block_tables[idx1])[0].size(), 2);
+    EXPECT_FALSE((*out1.m_block_tables[idx0])[0][0]->is_free());
+    EXPECT_EQ((*out1.m_block_tables[idx0])[0][0]->get_index(), 0);
+    EXPECT_FALSE((*out1.m_block_tables[idx0])[0][1]->is_free());
+    EXPECT_EQ((*out1.m_block_tables[idx0])[0][1]->get_index(), 1);
+    EXPECT_FALSE((*out1.m_block_tables[idx1])[0][0]->is_free());
+    EXPECT_EQ((*out1.m_block_tables[idx1])[0][0]->get_index(), 2);
+    EXPECT_FALSE((*out1.m_block_tables[idx1])[0][1]->is_free());
+    EXPECT_EQ((*out1.m_block_tables[idx1])[0][1]->get_index(), 3);
     EXPECT_EQ(out1.m_total_num_scheduled_tokens, tokens.size() * 2);
     EXPECT_EQ(out1.is_prompt, !scheduler_config.dynamic_split_fuse);
     for (auto seq: requests) {
@@ -199,13 +199,13 @@ TEST_P(AppendSlotsSchedulerTest, test_append_slots_considers_all_sequences) {
     auto out2 = scheduler.schedule(requests);
 
     // 1-st sequence now should use 3 kv-blocks
-    EXPECT_EQ(out2.m_block_tables[idx0][0].size(), 3);
-    EXPECT_FALSE(out2.m_block_tables[idx0][0][0]->is_free());
-    EXPECT_EQ(out2.m_block_tables[idx0][0][0]->get_index(), 0);
-    EXPECT_FALSE(out2.m_block_tables[idx0][0][1]->is_free());
-    EXPECT_EQ(out2.m_block_tables[idx0][0][1]->get_index(), 1);
-    EXPECT_FALSE(out2.m_block_tables[idx0][0][2]->is_free());
-    EXPECT_EQ(out2.m_block_tables[idx0][0][2]->get_index(), 4);
+    EXPECT_EQ((*out2.m_block_tables[idx0])[0].size(), 3);
+    EXPECT_FALSE((*out2.m_block_tables[idx0])[0][0]->is_free());
+    EXPECT_EQ((*out2.m_block_tables[idx0])[0][0]->get_index(), 0);
+    EXPECT_FALSE((*out2.m_block_tables[idx0])[0][1]->is_free());
+    EXPECT_EQ((*out2.m_block_tables[idx0])[0][1]->get_index(), 1);
+    EXPECT_FALSE((*out2.m_block_tables[idx0])[0][2]->is_free());
+    EXPECT_EQ((*out2.m_block_tables[idx0])[0][2]->get_index(), 4);
 
     // 1 token was scheduled for generate phase
     EXPECT_EQ(out2.m_total_num_scheduled_tokens, 1);
@@ -283,10 +283,10 @@ TEST_P(PartialPreemptionSchedulerTest, test_partial_preemption) {
     EXPECT_EQ(block_table2[1]->get_index(), 4);
 
     EXPECT_EQ(out2.m_total_num_scheduled_tokens, 1);
-    EXPECT_EQ(out2.m_block_tables[idx0][0][0]->get_index(), 0);
-    EXPECT_EQ(out2.m_block_tables[idx0][0][1]->get_index(), 1);
-    EXPECT_EQ(out2.m_block_tables[idx0][0][2]->get_index(), 2);
-    EXPECT_EQ(out2.m_block_tables[idx0][0][3]->get_index(), 5);
+    EXPECT_EQ((*out2.m_block_tables[idx0])[0][0]->get_index(), 0);
+    EXPECT_EQ((*out2.m_block_tables[idx0])[0][1]->get_index(), 1);
+    EXPECT_EQ((*out2.m_block_tables[idx0])[0][2]->get_index(), 2);
+    EXPECT_EQ((*out2.m_block_tables[idx0])[0][3]->get_index(), 5);
 
     // finish first sequence
     requests[0]->get_running_sequences()[0]->set_status(SequenceStatus::FINISHED);
@@ -299,9 +299,9 @@ TEST_P(PartialPreemptionSchedulerTest, test_partial_preemption) {
 
     // last token should be recomputed
     EXPECT_EQ(out3.m_total_num_scheduled_tokens, 1);
-    EXPECT_EQ(out3.m_block_tables[idx1][0][0]->get_index(), 3);
-    EXPECT_EQ(out3.m_block_tables[idx1][0][1]->get_index(), 4);
-    EXPECT_EQ(out3.m_block_tables[idx1][0][2]->get_index(), 0);
+    EXPECT_EQ((*out3.m_block_tables[idx1])[0][0]->get_index(), 3);
+    EXPECT_EQ((*out3.m_block_tables[idx1])[0][1]->get_index(), 4);
+    EXPECT_EQ((*out3.m_block_tables[idx1])[0][2]->get_index(), 0);
 
     block_table2 = scheduler.get_block_tables(*(*sequence_group2)[0])[0];
     EXPECT_EQ(block_table2.size(), 3);
@@ -473,11 +473,11 @@ TEST(TestScheduler, test_partially_preempted_prompt) {
         EXPECT_EQ(block_table1[1]->get_index(), 1);
         EXPECT_EQ(block_table1[2]->get_index(), 2);
         EXPECT_EQ(block_table1[3]->get_index(), 5);
-        EXPECT_EQ(out2.m_block_tables[idx0][0].size(), 4);
-        EXPECT_EQ(out2.m_block_tables[idx0][0][0]->get_index(), 0);
-        EXPECT_EQ(out2.m_block_tables[idx0][0][1]->get_index(), 1);
-        EXPECT_EQ(out2.m_block_tables[idx0][0][2]->get_index(), 2);
-        EXPECT_EQ(out2.m_block_tables[idx0][0][3]->get_index(), 5);
+        EXPECT_EQ((*out2.m_block_tables[idx0])[0].size(), 4);
+        EXPECT_EQ((*out2.m_block_tables[idx0])[0][0]->get_index(), 0);
+        EXPECT_EQ((*out2.m_block_tables[idx0])[0][1]->get_index(), 1);
+        EXPECT_EQ((*out2.m_block_tables[idx0])[0][2]->get_index(), 2);
+        EXPECT_EQ((*out2.m_block_tables[idx0])[0][3]->get_index(), 5);
 
         std::vector<uint64_t> ref_ids = {0};
         EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, ref_ids);
@@ -517,9 +517,9 @@ TEST(TestScheduler, test_partially_preempted_prompt) {
             EXPECT_EQ(out3.m_total_num_scheduled_tokens, 12);
         }
 
-        EXPECT_EQ(out3.m_block_tables[idx1][0][0]->get_index(), 3);
-        EXPECT_EQ(out3.m_block_tables[idx1][0][1]->get_index(), 4);
-        EXPECT_EQ(out3.m_block_tables[idx1][0][2]->get_index(), 0);
+        EXPECT_EQ((*out3.m_block_tables[idx1])[0][0]->get_index(), 3);
+        EXPECT_EQ((*out3.m_block_tables[idx1])[0][1]->get_index(), 4);
+        EXPECT_EQ((*out3.m_block_tables[idx1])[0][2]->get_index(), 0);
 
         auto block_table2 = scheduler.get_block_tables(*(*sequence_group2)[0])[0];
         EXPECT_EQ(block_table2.size(), 3);
@@ -765,11 +765,11 @@ TEST(TestScheduler, test_partially_preempted_prompt_not_allowed) {
     ASSERT_EQ(block_table1[0][1]->get_index(), 1);
     ASSERT_EQ(block_table1[0][2]->get_index(), 2);
     ASSERT_EQ(block_table1[0][3]->get_index(), 3);
-    ASSERT_EQ(out2.m_block_tables[idx0][0].size(), 4);
-    ASSERT_EQ(out2.m_block_tables[idx0][0][0]->get_index(), 0);
-    ASSERT_EQ(out2.m_block_tables[idx0][0][1]->get_index(), 1);
-    ASSERT_EQ(out2.m_block_tables[idx0][0][2]->get_index(), 2);
-    ASSERT_EQ(out2.m_block_tables[idx0][0][3]->get_index(), 3);
+    ASSERT_EQ((*out2.m_block_tables[idx0])[0].size(), 4);
+    ASSERT_EQ((*out2.m_block_tables[idx0])[0][0]->get_index(), 0);
+    ASSERT_EQ((*out2.m_block_tables[idx0])[0][1]->get_index(), 1);
+    ASSERT_EQ((*out2.m_block_tables[idx0])[0][2]->get_index(), 2);
+    ASSERT_EQ((*out2.m_block_tables[idx0])[0][3]->get_index(), 3);
 
     std::vector<uint64_t> ref_ids = {0};
     ASSERT_EQ(out2.m_scheduled_sequence_groups_ids, ref_ids);
@@ -792,9 +792,9 @@ TEST(TestScheduler, test_partially_preempted_prompt_not_allowed) {
     // prompt should be fully scheduled
     ASSERT_EQ(out3.m_total_num_scheduled_tokens, 12);
 
-    ASSERT_EQ(out3.m_block_tables[idx1][0][0]->get_index(), 4);
-    ASSERT_EQ(out3.m_block_tables[idx1][0][1]->get_index(), 5);
-    ASSERT_EQ(out3.m_block_tables[idx1][0][2]->get_index(), 0);
+    ASSERT_EQ((*out3.m_block_tables[idx1])[0][0]->get_index(), 4);
+    ASSERT_EQ((*out3.m_block_tables[idx1])[0][1]->get_index(), 5);
+    ASSERT_EQ((*out3.m_block_tables[idx1])[0][2]->get_index(), 0);
 
     auto block_table2 = scheduler.get_block_tables(*(*sequence_group2)[0]);
     ASSERT_EQ(block_table2[0].size(), 3);
@@ -859,11 +859,11 @@ TEST(TestScheduler, test_partially_preempted_prompt_not_allowed2) {
     ASSERT_EQ(block_table1[0][1]->get_index(), 1);
     ASSERT_EQ(block_table1[0][2]->get_index(), 2);
     ASSERT_EQ(block_table1[0][3]->get_index(), 3);
-    ASSERT_EQ(out2.m_block_tables[idx0][0].size(), 4);
-    ASSERT_EQ(out2.m_block_tables[idx0][0][0]->get_index(), 0);
-    ASSERT_EQ(out2.m_block_tables[idx0][0][1]->get_index(), 1);
-    ASSERT_EQ(out2.m_block_tables[idx0][0][2]->get_index(), 2);
-    ASSERT_EQ(out2.m_block_tables[idx0][0][3]->get_index(), 3);
+    ASSERT_EQ((*out2.m_block_tables[idx0])[0].size(), 4);
+    ASSERT_EQ((*out2.m_block_tables[idx0])[0][0]->get_index(), 0);
+    ASSERT_EQ((*out2.m_block_tables[idx0])[0][1]->get_index(), 1);
+    ASSERT_EQ((*out2.m_block_tables[idx0])[0][2]->get_index(), 2);
+    ASSERT_EQ((*out2.m_block_tables[idx0])[0][3]->get_index(), 3);
 
     std::vector<uint64_t> ref_ids = {0};
     ASSERT_EQ(out2.m_scheduled_sequence_groups_ids, ref_ids);
@@ -886,9 +886,9 @@ TEST(TestScheduler, test_partially_preempted_prompt_not_allowed2) {
     // prompt should be fully scheduled + generated tokens concatenated to prompt (10 + 2)
     ASSERT_EQ(out3.m_total_num_scheduled_tokens, 12);
 
-    ASSERT_EQ(out3.m_block_tables[idx1][0][0]->get_index(), 4);
-    ASSERT_EQ(out3.m_block_tables[idx1][0][1]->get_index(), 5);
-    ASSERT_EQ(out3.m_block_tables[idx1][0][2]->get_index(), 0);
+    ASSERT_EQ((*out3.m_block_tables[idx1])[0][0]->get_index(), 4);
+    ASSERT_EQ((*out3.m_block_tables[idx1])[0][1]->get_index(), 5);
+    ASSERT_EQ((*out3.m_block_tables[idx1])[0][2]->get_index(), 0);
 
     auto block_table2 = scheduler.get_block_tables(*(*sequence_group2)[0]);
     ASSERT_EQ(block_table2[0].size(), 3);
@@ -1111,3 +1111,246 @@ TEST(TestScheduler, prefix_caching_embeddings_test) {
          }
     }
 }
+
+TEST(TestScheduler, priority_policy_schedules_high_priority_prompt_first) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 8;
+    scheduler_config.num_kv_blocks = 6;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.scheduling_policy = SchedulingPolicy::PRIORITY;
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    auto low_priority_config = utils::get_greedy_config();
+    auto high_priority_config = utils::get_greedy_config();
+    high_priority_config.priority = 10;
+    SequenceGroup::Ptr low_priority_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                            low_priority_config, 4);
+    SequenceGroup::Ptr high_priority_group = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                             high_priority_config, 4);
+    auto low_priority_seq_id = (*low_priority_group)[0]->get_id();
+    auto high_priority_seq_id = (*high_priority_group)[0]->get_id();
+    std::vector<SequenceGroup::Ptr> requests = {low_priority_group, high_priority_group};
+
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    auto out = scheduler.schedule(requests);
+
+    // high priority request is moved to the front and takes the whole megabatch
+    EXPECT_EQ(requests[0], high_priority_group);
+    std::vector<uint64_t> ref_ids = {0};
+    EXPECT_EQ(out.m_scheduled_sequence_groups_ids, ref_ids);
+    EXPECT_EQ(out.m_total_num_scheduled_tokens, tokens.size());
+    EXPECT_TRUE(out.m_block_tables.count(high_priority_seq_id));
+    EXPECT_FALSE(out.m_block_tables.count(low_priority_seq_id));
+}
+
+TEST(TestScheduler, earliest_deadline_first_policy) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 8;
+    scheduler_config.num_kv_blocks = 6;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.scheduling_policy = SchedulingPolicy::EARLIEST_DEADLINE_FIRST;
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    auto late_deadline_config = utils::get_greedy_config();
+    late_deadline_config.deadline_ms = 100000;
+    auto early_deadline_config = utils::get_greedy_config();
+    early_deadline_config.deadline_ms = 100;
+    SequenceGroup::Ptr no_deadline_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                           utils::get_greedy_config(), 4);
+    SequenceGroup::Ptr late_deadline_group = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                             late_deadline_config, 4);
+    SequenceGroup::Ptr early_deadline_group = std::make_shared<SequenceGroup>(2, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                              early_deadline_config, 4);
+    std::vector<SequenceGroup::Ptr> requests = {no_deadline_group, late_deadline_group, early_deadline_group};
+
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    auto out = scheduler.schedule(requests);
+
+    std::vector<SequenceGroup::Ptr> ref_requests = {early_deadline_group, late_deadline_group, no_deadline_group};
+    EXPECT_EQ(requests, ref_requests);
+    EXPECT_TRUE(out.m_block_tables.count((*early_deadline_group)[0]->get_id()));
+    EXPECT_EQ(out.m_block_tables.size(), 1);
+}
+
+TEST(TestScheduler, priority_policy_preempts_low_priority_group) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 6;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.scheduling_policy = SchedulingPolicy::PRIORITY;
+
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    auto high_priority_config = utils::get_greedy_config();
+    high_priority_config.priority = 5;
+    // the low priority request arrives first, with FIFO policy the last one would be preempted
+    SequenceGroup::Ptr low_priority_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                            utils::get_greedy_config(), 4);
+    SequenceGroup::Ptr high_priority_group1 = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                              high_priority_config, 4);
+    SequenceGroup::Ptr high_priority_group2 = std::make_shared<SequenceGroup>(2, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                              high_priority_config, 4);
+    auto low_priority_seq_id = (*low_priority_group)[0]->get_id();
+    std::vector<SequenceGroup::Ptr> requests = {low_priority_group, high_priority_group1, high_priority_group2};
+
+    // schedule 3 sequence groups that use all 6 kv blocks
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    auto out1 = scheduler.schedule(requests);
+    EXPECT_EQ(out1.m_total_num_scheduled_tokens, tokens.size() * 3);
+    for (auto seq: requests) {
+        seq->finish_iteration();
+    }
+
+    // high priority groups require new blocks on generate phase, low priority group is preempted to free them
+    auto out2 = scheduler.schedule(requests);
+
+    std::vector<uint64_t> ref_ids = {0, 1};
+    EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, ref_ids);
+    EXPECT_EQ(requests[2], low_priority_group);
+    EXPECT_EQ(out2.m_total_num_scheduled_tokens, 2);
+    EXPECT_FALSE(scheduler.has_block_table(low_priority_seq_id));
+    EXPECT_TRUE(scheduler.has_block_table((*high_priority_group1)[0]->get_id()));
+    EXPECT_TRUE(scheduler.has_block_table((*high_priority_group2)[0]->get_id()));
+}
+
+TEST(TestScheduler, prefix_caching_separates_prefix_cache_salts) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = false;
+    scheduler_config.enable_prefix_caching = true;
+    std::vector<uint64_t> prompt_tokens = {0,1,2,3,4,5,6,7,8,9,10,11};
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    auto make_request = [&](uint64_t request_id, size_t salt) {
+        SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {prompt_tokens.size()}, prompt_tokens.data()),
+                                                                            utils::get_greedy_config(), 4);
+        sequence_group->set_prefix_cache_salt(salt);
+        return sequence_group;
+    };
+
+    // identical prompts hash differently under different salts, the salt 0 keeps the original hashes
+    SequenceGroup::Ptr unsalted = make_request(0, 0), salted = make_request(1, 1), same_salted = make_request(2, 1);
+    for (size_t content_length : {4, 8, 12}) {
+        EXPECT_NE((*unsalted)[0]->get_hash(content_length), (*salted)[0]->get_hash(content_length));
+        EXPECT_EQ((*salted)[0]->get_hash(content_length), (*same_salted)[0]->get_hash(content_length));
+    }
+
+    // fill the cache with blocks of the salt 1
+    std::vector<SequenceGroup::Ptr> requests = {salted};
+    scheduler.restore_cached_blocks(salted);
+    auto out = scheduler.schedule(requests);
+    EXPECT_EQ(out.m_total_num_scheduled_tokens, prompt_tokens.size());
+    salted->get_running_sequences()[0]->append_token(23, 0.7);
+    salted->finish_iteration();
+    auto sequence = salted->get_running_sequences()[0];
+    sequence->set_status(SequenceStatus::FINISHED);
+    scheduler.free_sequence(sequence->get_id());
+
+    // blocks computed under another salt are not reused
+    SequenceGroup::Ptr other_salted = make_request(3, 2);
+    scheduler.restore_cached_blocks(other_salted);
+    EXPECT_EQ(other_salted->get_num_processed_tokens(), 0);
+    scheduler.restore_cached_blocks(unsalted);
+    EXPECT_EQ(unsalted->get_num_processed_tokens(), 0);
+
+    // blocks computed under the same salt are reused
+    scheduler.restore_cached_blocks(same_salted);
+    EXPECT_GT(same_salted->get_num_processed_tokens(), 0);
+}
+
+TEST(TestScheduler, swap_in_keeps_prefix_cache_tiers_consistent) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 8;
+    scheduler_config.num_kv_blocks = 6;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.enable_prefix_caching = true;
+    scheduler_config.swap_space = 1;
+    scheduler_config.prefix_cache_host_size = 1;
+
+    const size_t num_decoder_layers = 12, block_size = 4;
+    auto cache_manager = init_cache_manager(scheduler_config);
+    Scheduler scheduler = Scheduler(block_size, cache_manager, scheduler_config, num_decoder_layers, false);
+    const size_t block_data_size = cache_manager->get_block_data_size_in_bytes();
+
+    auto get_block_indices = [&](uint64_t seq_id, size_t logical_block_idx) {
+        std::vector<size_t> block_indices;
+        for (const auto& layer_blocks : scheduler.get_block_tables(seq_id)) {
+            block_indices.push_back(layer_blocks[logical_block_idx]->get_index());
+        }
+        return block_indices;
+    };
+    auto fill_blocks = [&](uint64_t seq_id, auto get_value) {
+        for (size_t i = 0; i < scheduler.get_block_tables(seq_id)[0].size(); ++i) {
+            cache_manager->write_block(get_block_indices(seq_id, i), std::vector<uint8_t>(block_data_size, get_value(i)));
+        }
+    };
+
+    int64_t next_token = 100;
+    std::vector<SequenceGroup::Ptr> requests;
+    auto step = [&]() {
+        scheduler.schedule(requests);
+        for (auto& group : requests) {
+            if (group->get_num_scheduled_tokens() > 0 && group->requires_sampling())
+                group->get_running_sequences()[0]->append_token(next_token++, 0.5);
+            group->finish_iteration();
+        }
+    };
+
+    std::vector<uint64_t> prompt_a = {0,1,2,3,4,5,6,7}, prompt_c = {10,11,12,13,14,15,16,17};
+    SequenceGroup::Ptr group_a = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {prompt_a.size()}, prompt_a.data()),
+                                                                 utils::get_greedy_config(), block_size);
+    SequenceGroup::Ptr group_c = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {prompt_c.size()}, prompt_c.data()),
+                                                                 utils::get_greedy_config(), block_size);
+    auto seq_a_id = (*group_a)[0]->get_id(), seq_c_id = (*group_c)[0]->get_id();
+    requests = {group_a, group_c};
+    scheduler.restore_cached_blocks(group_a);
+    scheduler.restore_cached_blocks(group_c);
+
+    // both groups fill the cache, then the first one needs a new block and the second one is swapped out
+    const uint8_t swapped_value = 0xC0;
+    for (size_t i = 0; i < 20 && !scheduler.is_swapped_out(group_c); ++i) {
+        step();
+        if (scheduler.has_block_table(seq_c_id))
+            fill_blocks(seq_c_id, [&](size_t) { return swapped_value; });
+    }
+    ASSERT_TRUE(scheduler.is_swapped_out(group_c));
+
+    // the first group takes over the freed blocks of the swapped out group
+    for (size_t i = 0; i < 20 && scheduler.get_block_tables(seq_a_id)[0].size() < scheduler_config.num_kv_blocks; ++i) {
+        step();
+    }
+    ASSERT_EQ(scheduler.get_block_tables(seq_a_id)[0].size(), scheduler_config.num_kv_blocks);
+    ASSERT_TRUE(scheduler.is_swapped_out(group_c));
+
+    // finished group leaves its blocks in the prefix cache, swap in overwrites some of them
+    fill_blocks(seq_a_id, [](size_t logical_block_idx) { return static_cast<uint8_t>(logical_block_idx + 1); });
+    TokenIds tokens_a = group_a->get_prompt_ids();
+    const auto& generated_ids = (*group_a)[0]->get_generated_ids();
+    tokens_a.insert(tokens_a.end(), generated_ids.begin(), generated_ids.end());
+    (*group_a)[0]->set_status(SequenceStatus::FINISHED);
+    scheduler.free_sequence(seq_a_id);
+    clear_finished_sequences(requests);
+    step();
+    ASSERT_FALSE(scheduler.is_swapped_out(group_c));
+
+    // a prompt with the prefix of the finished group restores overwritten blocks from prefix cache tiers
+    const size_t num_prefix_blocks = scheduler_config.num_kv_blocks - 1;
+    TokenIds prompt_d(tokens_a.begin(), tokens_a.begin() + num_prefix_blocks * block_size);
+    SequenceGroup::Ptr group_d = std::make_shared<SequenceGroup>(2, prompt_d, utils::get_greedy_config(), block_size);
+    auto seq_d_id = (*group_d)[0]->get_id();
+    scheduler.restore_cached_blocks(group_d);
+    size_t num_blocks_restored_from_kv_cache = scheduler.get_block_tables(seq_d_id)[0].size();
+    requests.push_back(group_d);
+    scheduler.schedule(requests);
+
+    size_t num_restored_blocks = (group_d->get_num_processed_tokens() + block_size - 1) / block_size;
+    EXPECT_GT(num_restored_blocks, num_blocks_restored_from_kv_cache);
+    std::vector<uint8_t> block_data;
+    for (size_t i = 0; i < num_restored_blocks; ++i) {
+        cache_manager->read_block(get_block_indices(seq_d_id, i), block_data);
+        EXPECT_EQ(block_data, std::vector<uint8_t>(block_data_size, static_cast<uint8_t>(i + 1)));
+    }
+}
@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/parameter.hpp"
+#include "image_generation/text_encoder_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+// a fake encoder output of shape [batch, 2] whose rows hold the lengths of the prompts
+std::vector<ov::Tensor> fake_encode(const std::vector<std::string>& prompts) {
+    ov::Tensor output(ov::element::f32, {prompts.size(), 2});
+    for (size_t i = 0; i < prompts.size(); ++i) {
+        output.data<float>()[2 * i] = output.data<float>()[2 * i + 1] = static_cast<float>(prompts[i].size());
+    }
+    return {output};
+}
+
+ov::CompiledModel compile_add_model(ov::Core& core, const ov::AnyMap& properties) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 2});
+    auto add = std::make_shared<ov::op::v1::Add>(input, input);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{input});
+    return core.compile_model(model, "CPU", properties);
+}
+
+std::vector<float> get_values(const ov::Tensor& tensor) {
+    return std::vector<float>(tensor.data<float>(), tensor.data<float>() + tensor.get_size());
+}
+}  // namespace
+
+TEST(TestTextEncoderCache, keys_depend_on_model_and_prompt) {
+    const auto key = TextEncoderCache::compute_key("model", "prompt");
+    EXPECT_EQ(key, TextEncoderCache::compute_key("model", "prompt"));
+    EXPECT_NE(key, TextEncoderCache::compute_key("model_2", "prompt"));
+    EXPECT_NE(key, TextEncoderCache::compute_key("model", "prompt_2"));
+    // a model id can't be confused with a prompt prefix
+    EXPECT_NE(TextEncoderCache::compute_key("ab", "c"), TextEncoderCache::compute_key("a", "bc"));
+    EXPECT_NE(TextEncoderCache::get_unique_model_id(), TextEncoderCache::get_unique_model_id());
+}
+
+TEST(TestTextEncoderCache, evicts_lru_outputs_over_budget) {
+    const size_t output_size = fake_encode({"a"}).front().get_byte_size();
+    TextEncoderCache cache(2 * output_size);
+    cache.put("1", fake_encode({"a"}));
+    cache.put("2", fake_encode({"b"}));
+    // outputs 1 become the most recently used ones
+    ASSERT_TRUE(cache.get("1").has_value());
+
+    cache.put("3", fake_encode({"c"}));
+    EXPECT_EQ(cache.num_entries(), 2);
+    EXPECT_EQ(cache.size_in_bytes(), 2 * output_size);
+    EXPECT_FALSE(cache.get("2").has_value());
+    EXPECT_TRUE(cache.get("1").has_value());
+    EXPECT_TRUE(cache.get("3").has_value());
+}
+
+TEST(TestTextEncoderCache, encodes_missing_prompts_only) {
+    TextEncoderCache cache(1024);
+    std::vector<std::vector<std::string>> encoded_prompts;
+    auto encode = [&](const std::vector<std::string>& prompts) {
+        encoded_prompts.push_back(prompts);
+        return fake_encode(prompts);
+    };
+
+    size_t num_hits = 0;
+    auto outputs = cache.encode("model", {"negative", "cat"}, false, encode, num_hits);
+    EXPECT_EQ(num_hits, 0);
+    EXPECT_EQ(get_values(outputs.at(0)), std::vector<float>({8, 8, 3, 3}));
+
+    // the negative prompt is shared, only the new positive one is encoded
+    outputs = cache.encode("model", {"negative", "horse"}, false, encode, num_hits);
+    EXPECT_EQ(num_hits, 1);
+    EXPECT_EQ(encoded_prompts.back(), std::vector<std::string>({"horse"}));
+    EXPECT_EQ(outputs.at(0).get_shape(), ov::Shape({2, 2}));
+    EXPECT_EQ(get_values(outputs.at(0)), std::vector<float>({8, 8, 5, 5}));
+
+    outputs = cache.encode("model", {"horse"}, false, encode, num_hits);
+    EXPECT_EQ(num_hits, 1);
+    EXPECT_EQ(encoded_prompts.size(), 2);
+    EXPECT_EQ(get_values(outputs.at(0)), std::vector<float>({5, 5}));
+
+    // other models don't share outputs
+    cache.encode("model_2", {"horse"}, false, encode, num_hits);
+    EXPECT_EQ(num_hits, 0);
+    EXPECT_EQ(encoded_prompts.size(), 3);
+}
+
+TEST(TestTextEncoderCache, encodes_all_prompts_on_miss_for_static_batch) {
+    TextEncoderCache cache(1024);
+    std::vector<std::vector<std::string>> encoded_prompts;
+    auto encode = [&](const std::vector<std::string>& prompts) {
+        encoded_prompts.push_back(prompts);
+        return fake_encode(prompts);
+    };
+
+    size_t num_hits = 0;
+    cache.encode("model", {"negative", "cat"}, true, encode, num_hits);
+    auto outputs = cache.encode("model", {"negative", "horse"}, true, encode, num_hits);
+    EXPECT_EQ(num_hits, 0);
+    EXPECT_EQ(encoded_prompts.back(), std::vector<std::string>({"negative", "horse"}));
+    EXPECT_EQ(get_values(outputs.at(0)), std::vector<float>({8, 8, 5, 5}));
+
+    outputs = cache.encode("model", {"negative", "cat"}, true, encode, num_hits);
+    EXPECT_EQ(num_hits, 2);
+    EXPECT_EQ(encoded_prompts.size(), 2);
+    EXPECT_EQ(get_values(outputs.at(0)), std::vector<float>({8, 8, 3, 3}));
+}
+
+TEST(TestTextEncoderCache, skips_outputs_without_prompt_rows) {
+    TextEncoderCache cache(1024);
+    // e.g. a model reshaped to batch size 2 encoding a single prompt
+    auto encode = [](const std::vector<std::string>& prompts) {
+        return fake_encode({prompts.front(), prompts.front()});
+    };
+
+    size_t num_hits = 0;
+    auto outputs = cache.encode("model", {"cat"}, true, encode, num_hits);
+    EXPECT_EQ(num_hits, 0);
+    EXPECT_EQ(outputs.at(0).get_shape(), ov::Shape({2, 2}));
+    EXPECT_EQ(cache.num_entries(), 0);
+}
+
+TEST(TestTextEncoderCache, compiled_model_ids_depend_on_compile_properties) {
+    ov::Core core;
+    const auto accurate_model = compile_add_model(core, {ov::hint::execution_mode(ov::hint::ExecutionMode::ACCURACY)});
+    const auto fast_model = compile_add_model(core, {ov::hint::execution_mode(ov::hint::ExecutionMode::PERFORMANCE)});
+
+    const auto id = TextEncoderCache::get_compiled_model_id("model", "CPU", accurate_model);
+    EXPECT_EQ(id, TextEncoderCache::get_compiled_model_id("model", "CPU", accurate_model));
+    EXPECT_NE(id, TextEncoderCache::get_compiled_model_id("model", "CPU", fast_model));
+    EXPECT_NE(id, TextEncoderCache::get_compiled_model_id("model_2", "CPU", accurate_model));
+    EXPECT_NE(id, TextEncoderCache::get_compiled_model_id("model", "GPU", accurate_model));
+    // the id is built from the base one, so it doesn't grow when a model is compiled again
+    EXPECT_EQ(id.find("model|CPU|"), 0);
+    EXPECT_NE(id.find(ov::hint::inference_precision.name()), std::string::npos);
+}
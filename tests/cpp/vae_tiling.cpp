@@ -0,0 +1,115 @@
+// Copyright (C) 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/runtime/core.hpp"
+#include "image_generation/vae_tiling.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// multiplies its input by 2 and optionally moves channels to the last axis, which is enough to check that tiles are
+// cut, placed and blended back correctly
+ov::InferRequest get_dummy_vae_request(size_t rank, bool channels_last) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape::dynamic(rank));
+    auto two = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{}, {2.0f});
+    ov::Output<ov::Node> output = std::make_shared<ov::op::v1::Multiply>(input, two);
+    if (channels_last) {
+        std::vector<int64_t> order = rank == 5 ? std::vector<int64_t>{0, 2, 3, 4, 1} : std::vector<int64_t>{0, 2, 3, 1};
+        auto order_const = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{order.size()}, order);
+        output = std::make_shared<ov::op::v1::Transpose>(output, order_const);
+    }
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{output}, ov::ParameterVector{input});
+    return ov::Core().compile_model(model, "CPU").create_infer_request();
+}
+
+ov::Tensor get_input(const ov::Shape& shape) {
+    ov::Tensor input(ov::element::f32, shape);
+    float* data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); ++i) {
+        data[i] = static_cast<float>(i % 97) / 97.0f;
+    }
+    return input;
+}
+
+}  // namespace
+
+TEST(TestVAETiling, tile_begins_cover_axis) {
+    EXPECT_EQ(get_tile_begins(4, 8, 2), std::vector<size_t>({0}));
+    EXPECT_EQ(get_tile_begins(10, 4, 1), std::vector<size_t>({0, 3, 6}));
+    // the last tile is flush with the end even if it isn't aligned
+    EXPECT_EQ(get_tile_begins(64, 32, 8, 8), std::vector<size_t>({0, 24, 32}));
+    EXPECT_THROW(get_tile_begins(10, 4, 4), ov::Exception);
+}
+
+TEST(TestVAETiling, blend_weights_sum_to_one) {
+    const size_t size = 37, tile_size = 12;
+    std::vector<size_t> begins = get_tile_begins(size, tile_size, 4);
+    std::vector<float> sum(size, 0.0f);
+    for (size_t i = 0; i < begins.size(); ++i) {
+        size_t prev_end = i > 0 ? begins[i - 1] + tile_size : begins[i];
+        size_t next_begin = i + 1 < begins.size() ? begins[i + 1] : begins[i] + tile_size;
+        std::vector<float> weights = get_blend_weights(begins[i], begins[i] + tile_size, prev_end, next_begin);
+        for (size_t j = 0; j < tile_size; ++j) {
+            sum[begins[i] + j] += weights[j];
+        }
+    }
+    for (float weight : sum) {
+        EXPECT_NEAR(weight, 1.0f, 1e-6f);
+    }
+}
+
+TEST(TestVAETiling, tiled_image_matches_whole_image) {
+    ov::InferRequest request = get_dummy_vae_request(4, true);
+    ov::Tensor input = get_input({1, 4, 21, 30});
+
+    request.set_input_tensor(input);
+    request.infer();
+    ov::Tensor expected = request.get_output_tensor();
+
+    std::vector<ov::InferRequest> requests;
+    init_tile_infer_requests(requests, request, 3);
+    VAETilingParams params;
+    params.tile_size = {1, 8, 8};
+    params.overlap = {0, 3, 2};
+    ov::Tensor tiled = infer_tiled(requests, input, params);
+
+    ASSERT_EQ(tiled.get_shape(), expected.get_shape());
+    for (size_t i = 0; i < expected.get_size(); ++i) {
+        EXPECT_NEAR(tiled.data<float>()[i], expected.data<float>()[i], 1e-5f);
+    }
+}
+
+TEST(TestVAETiling, tiled_video_streams_frames) {
+    ov::InferRequest request = get_dummy_vae_request(5, true);
+    ov::Tensor input = get_input({1, 3, 9, 10, 12});
+
+    request.set_input_tensor(input);
+    request.infer();
+    ov::Tensor expected = request.get_output_tensor();
+
+    std::vector<ov::InferRequest> requests;
+    init_tile_infer_requests(requests, request, 2);
+    VAETilingParams params;
+    params.tile_size = {4, 6, 6};
+    params.overlap = {1, 2, 2};
+
+    std::vector<float> streamed;
+    size_t num_chunks = 0;
+    infer_tiled(requests, input, params, [&](const ov::Tensor& frames) {
+        ++num_chunks;
+        streamed.insert(streamed.end(), frames.data<float>(), frames.data<float>() + frames.get_size());
+    });
+
+    EXPECT_GT(num_chunks, 1);
+    ASSERT_EQ(streamed.size(), expected.get_size());
+    for (size_t i = 0; i < expected.get_size(); ++i) {
+        EXPECT_NEAR(streamed[i], expected.data<float>()[i], 1e-5f);
+    }
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef _WIN32
+#    define _USE_MATH_DEFINES
+#endif
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+#include "whisper/feature_extractor.hpp"
+#include "whisper/fft.hpp"
+
+using namespace ov::genai;
+
+TEST(TestWhisperStreamingFeatures, matches_offline_extraction) {
+    // defaults are used if preprocessor_config.json doesn't exist
+    WhisperFeatureExtractor feature_extractor("");
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> noise(-0.1f, 0.1f);
+    std::vector<float> raw_speech(feature_extractor.sampling_rate * 2 + 123);
+    for (size_t i = 0; i < raw_speech.size(); ++i) {
+        raw_speech[i] = 0.5f * std::sin(0.05f * static_cast<float>(i)) + noise(rng);
+    }
+    const WhisperFeatures expected = feature_extractor.extract(raw_speech);
+
+    WhisperStreamingFeatures features(feature_extractor);
+    std::uniform_int_distribution<size_t> chunk_size(1, 3000);
+    size_t num_frames = 0;
+    for (size_t offset = 0; offset < raw_speech.size();) {
+        const size_t size = std::min(chunk_size(rng), raw_speech.size() - offset);
+        features.append({raw_speech.begin() + offset, raw_speech.begin() + offset + size});
+        offset += size;
+        // frames are computed as soon as their samples arrive
+        EXPECT_GE(features.get_num_frames(), num_frames);
+        num_frames = features.get_num_frames();
+        if (offset > feature_extractor.n_fft / 2) {
+            EXPECT_EQ(num_frames, (offset + feature_extractor.n_fft / 2 - feature_extractor.n_fft) / feature_extractor.hop_length + 1);
+        }
+    }
+    features.finish();
+    // the last frames overlap the end of the audio
+    EXPECT_EQ(features.get_num_frames(), (raw_speech.size() + feature_extractor.n_fft / 2) / feature_extractor.hop_length + 1);
+
+    ASSERT_EQ(expected.n_frames, feature_extractor.nb_max_frames);
+    const std::vector<float> window = features.get_window(0);
+    ASSERT_EQ(window.size(), expected.data.size());
+    for (size_t i = 0; i < window.size(); ++i) {
+        ASSERT_FLOAT_EQ(window[i], expected.data[i]) << "at " << i;
+    }
+
+    // a window starting later is the same spectrogram shifted by the dropped frames, up to the normalization
+    const size_t shift = 100;
+    features.drop_frames(shift);
+    const std::vector<float> shifted = features.get_window(shift);
+    const size_t n_frames = feature_extractor.nb_max_frames;
+    EXPECT_NEAR(shifted[0] - shifted[1], window[shift] - window[shift + 1], 1e-5f);
+    EXPECT_NEAR(shifted[n_frames + 10] - shifted[n_frames + 20], window[n_frames + shift + 10] - window[n_frames + shift + 20], 1e-5f);
+}
+
+TEST(TestRealFFT, matches_naive_dft) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> signal(-1.f, 1.f);
+    // Whisper's n_fft, radix 4 only, radix 2 and 3, a generic odd radix 7 and odd sizes without the split step
+    for (size_t size : {400, 16, 30, 14, 2, 401, 15, 7, 1}) {
+        std::vector<float> input(size);
+        for (auto& value : input) {
+            value = signal(rng);
+        }
+        RealFFT fft(size);
+        std::vector<std::complex<float>> output(size / 2 + 1), work(fft.get_work_size());
+        fft.transform(input.data(), output.data(), work.data());
+
+        for (size_t k = 0; k <= size / 2; ++k) {
+            std::complex<double> expected;
+            for (size_t n = 0; n < size; ++n) {
+                expected += static_cast<double>(input[n]) * std::polar(1.0, -2.0 * M_PI * static_cast<double>(k * n) / static_cast<double>(size));
+            }
+            EXPECT_NEAR(output[k].real(), expected.real(), 1e-4) << "size " << size << ", bin " << k;
+            EXPECT_NEAR(output[k].imag(), expected.imag(), 1e-4) << "size " << size << ", bin " << k;
+        }
+    }
+}
@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "whisper/local_agreement.hpp"
+
+using namespace ov::genai;
+using Tokens = std::vector<int64_t>;
+
+TEST(TestLocalAgreement, commits_tokens_of_consecutive_hypotheses_agreement) {
+    LocalAgreement agreement;
+    EXPECT_EQ(agreement.update({1, 2, 3}), Tokens{});
+    EXPECT_EQ(agreement.get_partial_tokens(), Tokens({1, 2, 3}));
+
+    EXPECT_EQ(agreement.update({1, 2, 4, 5}), Tokens({1, 2}));
+    EXPECT_EQ(agreement.get_partial_tokens(), Tokens({4, 5}));
+
+    EXPECT_EQ(agreement.update({1, 2, 4, 5, 6}), Tokens({4, 5}));
+    EXPECT_EQ(agreement.get_num_stable_tokens(), 4);
+    EXPECT_EQ(agreement.get_partial_tokens(), Tokens({6}));
+}
+
+TEST(TestLocalAgreement, diverging_hypothesis_continues_stable_tokens) {
+    LocalAgreement agreement;
+    agreement.update({1, 2, 3});
+    ASSERT_EQ(agreement.update({1, 2, 3}), Tokens({1, 2, 3}));
+
+    // hypotheses revise emitted token 2, their tokens past the emitted ones are neither lost nor repeated
+    EXPECT_EQ(agreement.update({1, 9, 3, 4}), Tokens{});
+    EXPECT_EQ(agreement.get_partial_tokens(), Tokens({4}));
+    EXPECT_EQ(agreement.update({1, 9, 3, 4, 5}), Tokens({4}));
+    EXPECT_EQ(agreement.get_partial_tokens(), Tokens({5}));
+
+    // a shorter diverging hypothesis doesn't make emitted tokens unstable
+    EXPECT_EQ(agreement.update({7}), Tokens{});
+    EXPECT_EQ(agreement.get_num_stable_tokens(), 4);
+    EXPECT_EQ(agreement.get_partial_tokens(), Tokens{});
+}
+
+TEST(TestLocalAgreement, diverging_tokens_are_committed_before_window_advances) {
+    LocalAgreement agreement;
+    agreement.update({1, 2});
+    ASSERT_EQ(agreement.update({1, 2}), Tokens({1, 2}));
+
+    // a full window commits its finished segments although the hypothesis doesn't start with the stable tokens
+    const Tokens hypothesis = {7, 8, 9, 10};
+    agreement.update(hypothesis);
+    EXPECT_EQ(agreement.commit(hypothesis, 3), Tokens({9}));
+    agreement.advance(3);
+    EXPECT_EQ(agreement.get_num_stable_tokens(), 0);
+    EXPECT_EQ(agreement.get_partial_tokens(), Tokens({10}));
+
+    // the next window starts with the unfinished segment
+    EXPECT_EQ(agreement.update({10, 11}), Tokens({10}));
+}
+
+TEST(TestLocalAgreement, final_commit_emits_rest_of_diverging_hypothesis) {
+    LocalAgreement agreement;
+    agreement.update({1, 2, 3});
+    ASSERT_EQ(agreement.update({1, 2, 3, 4}), Tokens({1, 2, 3}));
+
+    // finish() commits the whole last hypothesis and moves the window to the end of the stream
+    const Tokens hypothesis = {1, 5, 3, 4, 6};
+    EXPECT_EQ(agreement.commit(hypothesis, hypothesis.size()), Tokens({4, 6}));
+    agreement.advance(hypothesis.size());
+    EXPECT_EQ(agreement.get_num_stable_tokens(), 0);
+    EXPECT_EQ(agreement.get_partial_tokens(), Tokens{});
+}
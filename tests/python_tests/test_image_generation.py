@@ -4,6 +4,9 @@
 import pytest
 import subprocess  # nosec B404
 import logging
+import threading
+import time
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
 import numpy as np
 import openvino as ov
@@ -239,6 +242,114 @@ class TestTaylorSeerImageGeneration:
         assert len(callback_calls) > 0
 
 
+def _assert_images_close(image, reference):
+    # batched UNet inference may round differently than the solo one
+    assert image.data.shape == reference.data.shape
+    assert np.abs(image.data.astype(np.int32) - reference.data.astype(np.int32)).max() <= 2
+
+
+class TestStepBatching:
+    GENERATION_ARGS = [
+        {"prompt": "a cat", "num_inference_steps": 4, "rng_seed": 11},
+        {"prompt": "a dog on the grass", "num_inference_steps": 2, "rng_seed": 22},
+        {"prompt": "a red car", "num_inference_steps": 6, "rng_seed": 33, "num_images_per_prompt": 2},
+        {"prompt": "a house", "num_inference_steps": 3, "rng_seed": 44},
+    ]
+
+    def _generate_solo(self, model_dir, generation_args):
+        pipe = ov_genai.Text2ImagePipeline(model_dir, "CPU")
+        return [pipe.generate(args["prompt"], width=64, height=64, **{k: v for k, v in args.items() if k != "prompt"})
+                for args in generation_args]
+
+    def test_batched_output_matches_solo(self, image_generation_model):
+        solo_images = self._generate_solo(image_generation_model, self.GENERATION_ARGS)
+
+        pipe = ov_genai.Text2ImagePipeline(image_generation_model, "CPU")
+        pipe.enable_step_batching(max_batch_size=8)
+
+        def generate(args):
+            return pipe.generate(args["prompt"], width=64, height=64, **{k: v for k, v in args.items() if k != "prompt"})
+
+        with ThreadPoolExecutor(max_workers=len(self.GENERATION_ARGS)) as executor:
+            batched_images = list(executor.map(generate, self.GENERATION_ARGS))
+
+        for image, reference in zip(batched_images, solo_images):
+            _assert_images_close(image, reference)
+
+    def test_request_is_admitted_while_others_run(self, image_generation_model):
+        long_args = {"prompt": "a long request", "num_inference_steps": 20, "rng_seed": 5}
+        short_args = {"prompt": "a short request", "num_inference_steps": 2, "rng_seed": 6}
+        solo_images = self._generate_solo(image_generation_model, [long_args, short_args])
+
+        pipe = ov_genai.Text2ImagePipeline(image_generation_model, "CPU")
+        pipe.enable_step_batching(max_batch_size=4)
+
+        long_request_started = threading.Event()
+        short_request_done = threading.Event()
+        long_steps_after_short_request = []
+
+        def long_callback(step, num_steps, latent):
+            long_request_started.set()
+            if short_request_done.is_set():
+                long_steps_after_short_request.append(step)
+            # slow the long request down, so that it's still running when the short one is done
+            time.sleep(0.05)
+            return False
+
+        with ThreadPoolExecutor(max_workers=2) as executor:
+            long_future = executor.submit(pipe.generate, long_args["prompt"], width=64, height=64,
+                                          num_inference_steps=long_args["num_inference_steps"], rng_seed=long_args["rng_seed"],
+                                          callback=long_callback)
+            assert long_request_started.wait(timeout=60)
+            short_image = pipe.generate(short_args["prompt"], width=64, height=64,
+                                        num_inference_steps=short_args["num_inference_steps"], rng_seed=short_args["rng_seed"])
+            short_request_done.set()
+            long_image = long_future.result()
+
+        # the short request joined the running batch and left it before the long one was done
+        assert len(long_steps_after_short_request) > 0
+        _assert_images_close(long_image, solo_images[0])
+        _assert_images_close(short_image, solo_images[1])
+
+    def test_request_exceeding_batch_size_is_rejected(self, image_generation_model):
+        pipe = ov_genai.Text2ImagePipeline(image_generation_model, "CPU")
+        pipe.enable_step_batching(max_batch_size=2)
+        with pytest.raises(RuntimeError, match="exceeds max_batch_size"):
+            pipe.generate("a cat", width=64, height=64, num_inference_steps=2, num_images_per_prompt=4, guidance_scale=1.0)
+
+    def test_taylorseer_config_is_rejected(self, image_generation_model):
+        pipe = ov_genai.Text2ImagePipeline(image_generation_model, "CPU")
+        pipe.enable_step_batching(max_batch_size=4)
+        with pytest.raises(RuntimeError, match="TaylorSeer caching can't be applied"):
+            pipe.generate("a cat", width=64, height=64, num_inference_steps=2, taylorseer_config=ov_genai.TaylorSeerCacheConfig())
+
+    def test_custom_scheduler_is_used(self, image_generation_model):
+        scheduler_config_path = Path(image_generation_model) / "scheduler" / "scheduler_config.json"
+        generation_args = {"num_inference_steps": 4, "rng_seed": 11}
+
+        solo_pipe = ov_genai.Text2ImagePipeline(image_generation_model, "CPU")
+        solo_pipe.set_scheduler(ov_genai.Scheduler.from_config(scheduler_config_path, ov_genai.Scheduler.Type.DDIM))
+        solo_image = solo_pipe.generate("a cat", width=64, height=64, **generation_args)
+
+        pipe = ov_genai.Text2ImagePipeline(image_generation_model, "CPU")
+        pipe.set_scheduler(ov_genai.Scheduler.from_config(scheduler_config_path, ov_genai.Scheduler.Type.DDIM))
+        pipe.enable_step_batching(max_batch_size=4)
+        _assert_images_close(pipe.generate("a cat", width=64, height=64, **generation_args), solo_image)
+
+    def test_reconfiguration_is_rejected(self, image_generation_model):
+        pipe = ov_genai.Text2ImagePipeline(image_generation_model, "CPU")
+        pipe.enable_step_batching(max_batch_size=4)
+        scheduler_config_path = Path(image_generation_model) / "scheduler" / "scheduler_config.json"
+        with pytest.raises(RuntimeError, match="once step batching is enabled"):
+            pipe.set_scheduler(ov_genai.Scheduler.from_config(scheduler_config_path))
+        with pytest.raises(RuntimeError, match="once step batching is enabled"):
+            pipe.set_generation_config(pipe.get_generation_config())
+        with pytest.raises(RuntimeError, match="once step batching is enabled"):
+            pipe.reshape(num_images_per_prompt=1, height=64, width=64, guidance_scale=1.0)
+        with pytest.raises(RuntimeError, match="once step batching is enabled"):
+            pipe.compile("CPU")
+
+
 def _construct_reshaped(model_dir):
     pipe = ov_genai.Text2ImagePipeline(model_dir)
     pipe.reshape(
@@ -399,6 +399,62 @@ def test_generate_works_same_before_and_after_chat(ov_pipe: ov_genai.LLMPipeline
     
     assert res_after_chat == res_before_chat
 
+@pytest.mark.parametrize("llm_model", CHAT_MODELS_LIST, indirect=True)
+def test_generate_works_same_before_and_after_closed_session(llm_model: OVConvertedModelSchema) -> None:
+    ov_pipe = create_ov_pipeline(llm_model.models_path, pipeline_type=PipelineType.STATEFUL)
+
+    generation_config_kwargs, _ = CHAT_INPUTS[0]
+    ov_generation_config = ov_genai.GenerationConfig(**generation_config_kwargs)
+    ov_generation_config.apply_chat_template = False
+
+    res_before_session = ov_pipe.generate(QUESTIONS[0], generation_config=ov_generation_config)
+
+    ov_pipe.create_session("first")
+    ov_pipe.generate(QUESTIONS[0], generation_config=ov_generation_config)
+    ov_pipe.create_session("second")
+    ov_pipe.generate(QUESTIONS[1], generation_config=ov_generation_config)
+    # closing an inactive session keeps the active one
+    ov_pipe.close_session("first")
+    ov_pipe.close_session("second")
+
+    # the calls are not chat turns, so the second one doesn't continue the first one
+    for _ in range(2):
+        res_after_session = ov_pipe.generate(QUESTIONS[0], generation_config=ov_generation_config)
+        assert res_after_session == res_before_session
+
+@pytest.mark.parametrize("llm_model", [CHAT_MODELS_LIST[0]], indirect=True)
+@pytest.mark.parametrize("session_cache_precision", [None, ov.Type.f16, ov.Type.u8], ids=["original", "f16", "u8"])
+def test_resumed_session_continues_chat(llm_model: OVConvertedModelSchema, session_cache_precision: ov.Type | None) -> None:
+    ov_config = get_default_llm_properties()
+    if session_cache_precision is not None:
+        ov_config["session_cache_precision"] = session_cache_precision
+    ov_pipe = create_ov_pipeline(llm_model.models_path, pipeline_type=PipelineType.STATEFUL, ov_config=ov_config)
+
+    generation_config_kwargs, _ = CHAT_INPUTS[0]
+    ov_generation_config = ov_genai.GenerationConfig(**generation_config_kwargs)
+
+    ov_pipe.create_session("uninterrupted")
+    ref_answers = [ov_pipe.generate(question, generation_config=ov_generation_config) for question in QUESTIONS[:2]]
+    ov_pipe.close_session("uninterrupted")
+
+    ov_pipe.create_session("resumed")
+    answers = [ov_pipe.generate(QUESTIONS[0], generation_config=ov_generation_config)]
+    # another session replaces the KV cache, the first one is restored from the session store
+    ov_pipe.create_session("other")
+    ov_pipe.generate(QUESTIONS[2], generation_config=ov_generation_config)
+    ov_pipe.resume_session("resumed")
+    answers.append(ov_pipe.generate(QUESTIONS[1], generation_config=ov_generation_config))
+    ov_pipe.close_session("other")
+    ov_pipe.close_session("resumed")
+
+    assert answers == ref_answers
+
+
+@pytest.mark.parametrize("llm_model", [CHAT_MODELS_LIST[0]], indirect=True)
+def test_session_cache_requires_sdpa_backend(llm_model: OVConvertedModelSchema) -> None:
+    with pytest.raises(RuntimeError, match="ATTENTION_BACKEND"):
+        ov_genai.LLMPipeline(llm_model.models_path, "CPU", session_cache_size=16)
+
 #
 # Streaming with callback
 #
@@ -674,6 +674,31 @@ def dataset_embeddings_genai_default_config_refs(emb_model, dataset_documents):
     return run_text_embedding_genai(models_path, dataset_documents, None, "embed_documents")
 
 
+@pytest.mark.parametrize("emb_model", ["mixedbread-ai/mxbai-embed-xsmall-v1"], indirect=True)
+@pytest.mark.parametrize(
+    "config",
+    [
+        TextEmbeddingPipeline.Config(max_batch_tokens=1),
+        TextEmbeddingPipeline.Config(max_batch_tokens=256),
+        TextEmbeddingPipeline.Config(max_batch_tokens=256, max_length=50),
+    ],
+    ids=[
+        "max_batch_tokens=1",
+        "max_batch_tokens=256",
+        "max_batch_tokens=256,max_length=50",
+    ],
+)
+def test_micro_batched_configs(emb_model, dataset_documents, config, dataset_embeddings_genai_default_config_refs):
+    models_path = emb_model.models_path
+    result = run_text_embedding_genai(models_path, dataset_documents, config, "embed_documents")
+
+    if config.max_length:
+        refs = run_text_embedding_genai(models_path, dataset_documents, TextEmbeddingPipeline.Config(max_length=config.max_length), "embed_documents")
+    else:
+        refs = dataset_embeddings_genai_default_config_refs
+    validate_embedding_results(refs, result)
+
+
 @pytest.mark.parametrize("emb_model", ["mixedbread-ai/mxbai-embed-xsmall-v1"], indirect=True)
 @pytest.mark.parametrize(
     "config",
@@ -772,10 +797,12 @@ def test_rerank_constructors(rerank_model):
     [
         TextRerankPipeline.Config(),
         TextRerankPipeline.Config(top_n=10),
+        TextRerankPipeline.Config(top_n=10, max_batch_tokens=256),
     ],
     ids=[
         "top_n=default",
         "top_n=10",
+        "top_n=10,max_batch_tokens=256",
     ],
 )
 def test_rerank_documents(rerank_model, dataset_documents, query, config):
@@ -121,3 +121,73 @@ def test_encoded_prompts(tmp_path, encoded_prompt, model_id):
             streamer.write(token_chunk)
         streamer.end()
         assert ''.join(accumulated) == ov_tokenizer.decode(encoded_prompt)
+
+
+def load_ov_tokenizer(tmp_path, model_id):
+    model_cached = snapshot_download(model_id)  # required to avoid HF rate limits
+    hf_tokenizer = retry_request(lambda: AutoTokenizer.from_pretrained(model_cached, trust_remote_code=True))
+    convert_and_save_tokenizer(hf_tokenizer, tmp_path)
+    return Tokenizer(tmp_path)
+
+
+# Lines without new line symbols which are several times longer than the decoding window of TextStreamer,
+# so the window is moved forward several times while the text is streamed.
+long_line_prompts = [*map(lambda x: str.encode(x, 'unicode_escape'), [
+    " ".join(f"word{i}, it's" for i in range(80)),
+    # characters which are split across several tokens
+    "如果您有任何疑问，请联系我们，我们将予以解答。" * 8,
+    "Тестовая строка с émojis 🙂🚀 и 룅튜 " * 10,
+])]
+
+
+@pytest.mark.parametrize("model_id", tokenizer_model_ids)
+@pytest.mark.parametrize("prompt", long_line_prompts)
+def test_long_line_is_streamed_with_window_rollover(tmp_path, prompt, model_id):
+    prompt = prompt.decode('unicode_escape')
+    ov_tokenizer = load_ov_tokenizer(tmp_path, model_id)
+    tokens = ov_tokenizer.encode(prompt=prompt, add_special_tokens=False).input_ids.data[0].tolist()
+    expected = ov_tokenizer.decode(tokens)
+
+    accumulated = []
+    streamer = TextStreamer(ov_tokenizer, lambda x: accumulated.append(x))
+    for chunk_size in [1, 3, 5]:
+        accumulated.clear()
+        for token_chunk in chunks(tokens, chunk_size):
+            streamer.write(token_chunk)
+            streamed = ''.join(accumulated)
+            # the text streamed so far is final, a multi-byte character is never printed partially
+            assert expected.startswith(streamed)
+            assert '�' not in streamed
+        # the text is printed as it's generated rather than when the line ends
+        assert len(''.join(accumulated)) > len(expected) // 2
+        streamer.end()
+        assert ''.join(accumulated) == expected
+
+
+@pytest.mark.parametrize("model_id", tokenizer_model_ids)
+@pytest.mark.parametrize("encoded_prompt", encoded_prompts)
+def test_end_flushes_delayed_text(tmp_path, encoded_prompt, model_id):
+    ov_tokenizer = load_ov_tokenizer(tmp_path, model_id)
+    expected = ov_tokenizer.decode(encoded_prompt)
+
+    accumulated = []
+    streamer = TextStreamer(ov_tokenizer, lambda x: accumulated.append(x))
+    for token in encoded_prompt:
+        streamer.write(token)
+    # the text of the last tokens is delayed until end() is called
+    assert expected.startswith(''.join(accumulated))
+
+    streamer.end()
+    assert ''.join(accumulated) == expected
+
+    # nothing is left to flush
+    num_chunks = len(accumulated)
+    streamer.end()
+    assert len(accumulated) == num_chunks
+
+    # the streamer starts from scratch after end()
+    accumulated.clear()
+    for token in encoded_prompt:
+        streamer.write(token)
+    streamer.end()
+    assert ''.join(accumulated) == expected
@@ -530,6 +530,33 @@ def test_longform_audio(model_descr, sample_from_dataset):
     assert "".join(streamer_result) == hf_result["text"]
 
 
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.xfail(condition=(sys.platform == "darwin"), reason="Ticket - 173169")
+def test_generate_batch_matches_sequential(model_descr):
+    _, _, _, genai_pipe = read_whisper_model(model_descr)
+    samples = get_whisper_dataset(language="en", long_form=True)
+    # a clip shorter than a chunk, clips of a few chunks with the last one partial, and a whole sample, so that the inputs
+    # drop out of the batch at different chunks
+    raw_speech_inputs = [samples[0][: 5 * 16000], samples[1][: 47 * 16000], samples[2][: 31 * 16000], samples[3]]
+
+    config = genai_pipe.get_generation_config()
+    config.return_timestamps = True
+    # the language is detected for each input
+    config.language = None
+
+    sequential_results = [genai_pipe.generate(raw_speech_input, config) for raw_speech_input in raw_speech_inputs]
+    batch_results = genai_pipe.generate(raw_speech_inputs, config)
+
+    assert len(batch_results) == len(raw_speech_inputs)
+    for batch_result, sequential_result in zip(batch_results, sequential_results):
+        assert batch_result.texts == sequential_result.texts
+        assert len(batch_result.chunks) == len(sequential_result.chunks)
+        for batch_chunk, sequential_chunk in zip(batch_result.chunks, sequential_result.chunks):
+            assert batch_chunk.text == sequential_chunk.text
+            assert batch_chunk.start_ts == pytest.approx(sequential_chunk.start_ts, abs=0.01)
+            assert batch_chunk.end_ts == pytest.approx(sequential_chunk.end_ts, abs=0.01)
+
+
 @pytest.mark.parametrize("model_descr", get_whisper_models_list())
 @pytest.mark.xfail(condition=(sys.platform == "darwin"), reason="Ticket - 173169")
 def test_shortform(model_descr):